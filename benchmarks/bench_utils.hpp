@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   bench_utils.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#ifndef STATICLIB_IO_BENCHMARKS_BENCH_UTILS_HPP
+#define STATICLIB_IO_BENCHMARKS_BENCH_UTILS_HPP
+
+#include <cstdint>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Generates reproducible pseudo-random binary input of specified size
+ * 
+ * @param size input size in bytes
+ * @param seed generator seed
+ * @return generated input
+ */
+inline std::string make_binary_input(size_t size, uint64_t seed = 42) {
+    std::string res;
+    res.resize(size);
+    uint64_t state = seed | 1;
+    for (size_t i = 0; i < size; i++) {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        res[i] = static_cast<char>(state & 0xff);
+    }
+    return res;
+}
+
+/**
+ * Generates reproducible text input of specified size,
+ * consisting of lines of varying length
+ * 
+ * @param size input size in bytes
+ * @param ending line ending
+ * @return generated input
+ */
+inline std::string make_text_input(size_t size, const std::string& ending = "\n") {
+    static const std::string alphabet = "abcdefghijklmnopqrstuvwxyz0123456789 ";
+    std::string res;
+    res.reserve(size + 128);
+    size_t line = 0;
+    while (res.size() < size) {
+        size_t len = 16 + (line * 37) % 96;
+        for (size_t i = 0; i < len; i++) {
+            res.push_back(alphabet[(line + i * 7) % alphabet.size()]);
+        }
+        res.append(ending);
+        line += 1;
+    }
+    res.resize(size);
+    return res;
+}
+
+/**
+ * Runs benchmarks and collects results, results are printed
+ * as a JSON document to be compared between runs
+ */
+class bench_report {
+    struct result {
+        std::string name;
+        uint64_t bytes;
+        uint64_t iterations;
+        double seconds;
+    };
+
+    std::string suite;
+    std::vector<result> results;
+    double min_seconds;
+    uint64_t checksum = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param suite benchmark suite name
+     * @param min_seconds min run time for each benchmark
+     */
+    explicit bench_report(std::string suite, double min_seconds = 0.25) :
+    suite(std::move(suite)),
+    min_seconds(min_seconds) { }
+
+    /**
+     * Runs specified function repeatedly until min run time is reached
+     * 
+     * @param name benchmark name
+     * @param bytes number of bytes processed by one function call
+     * @param fun benchmark function, returns value used as a checksum
+     *        to prevent the work from being optimized out
+     */
+    void run(const std::string& name, uint64_t bytes, std::function<uint64_t()> fun) {
+        // warmup
+        checksum += fun();
+        uint64_t iterations = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0;
+        do {
+            checksum += fun();
+            iterations += 1;
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        } while (elapsed < min_seconds);
+        results.push_back({name, bytes, iterations, elapsed});
+    }
+
+    /**
+     * Prints collected results as a JSON document
+     * 
+     * @param out output stream
+     */
+    void print(std::ostream& out = std::cout) const {
+        out << "{\n  \"suite\": \"" << suite << "\",\n  \"checksum\": " << checksum << ",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            const result& re = results[i];
+            double total_bytes = static_cast<double>(re.bytes) * static_cast<double>(re.iterations);
+            double ns_per_byte = total_bytes > 0 ? re.seconds * 1e9 / total_bytes : 0;
+            double mb_per_sec = re.seconds > 0 ? total_bytes / re.seconds / (1024 * 1024) : 0;
+            out << (0 == i ? "\n" : ",\n");
+            out << "    {\"name\": \"" << re.name << "\", \"bytes\": " << re.bytes <<
+                    ", \"iterations\": " << re.iterations << std::fixed << std::setprecision(4) <<
+                    ", \"ns_per_byte\": " << ns_per_byte << ", \"mb_per_sec\": " << mb_per_sec << "}";
+            out.unsetf(std::ios_base::floatfield);
+        }
+        out << "\n  ]\n}" << std::endl;
+    }
+};
+
+#endif /* STATICLIB_IO_BENCHMARKS_BENCH_UTILS_HPP */
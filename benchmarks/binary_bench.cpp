@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   binary_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:40 AM
+ */
+#include "staticlib/io/operations.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/buffered_source.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 24;
+
+// source that does not lend its data
+class plain_source {
+    sl::io::array_source src;
+
+public:
+    explicit plain_source(const std::string& data) :
+    src(data) { }
+
+    std::streamsize read(sl::io::span<char> span) {
+        return src.read(span);
+    }
+};
+
+void bench_scalar(bench_report& report, const std::string& input) {
+    size_t count = input.size() / 4;
+    report.run("naive/read_exact_shift", input.size(), [&input, count] {
+        auto src = plain_source(input);
+        uint64_t res = 0;
+        std::array<char, 4> buf;
+        for (size_t i = 0; i < count; i++) {
+            sl::io::read_exact(src, {buf.data(), buf.size()});
+            const unsigned char* ptr = reinterpret_cast<const unsigned char*>(buf.data());
+            res += (static_cast<uint32_t>(ptr[0]) << 24) | (static_cast<uint32_t>(ptr[1]) << 16) |
+                    (static_cast<uint32_t>(ptr[2]) << 8) | static_cast<uint32_t>(ptr[3]);
+        }
+        return res;
+    });
+    report.run("read_be/array_source", input.size(), [&input, count] {
+        auto src = sl::io::array_source(input);
+        uint64_t res = 0;
+        for (size_t i = 0; i < count; i++) {
+            res += sl::io::read_be<uint32_t>(src);
+        }
+        return res;
+    });
+    report.run("read_be/buffered_source", input.size(), [&input, count] {
+        auto src = sl::io::make_buffered_source(plain_source(input));
+        uint64_t res = 0;
+        for (size_t i = 0; i < count; i++) {
+            res += sl::io::read_be<uint32_t>(src);
+        }
+        return res;
+    });
+}
+
+void bench_arrays(bench_report& report, const std::string& input) {
+    std::vector<uint32_t> values(input.size() / 4);
+    report.run("read_be_array/uint32", input.size(), [&input, &values] {
+        auto src = sl::io::array_source(input);
+        sl::io::read_be_array<uint32_t>(src, {values.data(), values.size()});
+        return static_cast<uint64_t>(values.back());
+    });
+    report.run("write_be/uint32", input.size(), [&values] {
+        auto sink = sl::io::string_sink();
+        for (uint32_t val : values) {
+            sl::io::write_be(sink, val);
+        }
+        return static_cast<uint64_t>(sink.get_string().size());
+    });
+    report.run("write_be_array/uint32", input.size(), [&values] {
+        auto sink = sl::io::string_sink();
+        sl::io::write_be_array<uint32_t>(sink, {values.data(), values.size()});
+        return static_cast<uint64_t>(sink.get_string().size());
+    });
+}
+
+void bench_varint(bench_report& report, const std::string& input) {
+    auto sink = sl::io::string_sink();
+    for (size_t i = 0; i + 4 <= input.size(); i += 4) {
+        uint32_t val = 0;
+        std::memcpy(std::addressof(val), input.data() + i, 4);
+        sl::io::write_varint(sink, val >> (val & 31));
+    }
+    std::string encoded = sink.get_string();
+    report.run("read_varint/array_source", encoded.size(), [&encoded] {
+        auto src = sl::io::array_source(encoded);
+        uint64_t res = 0;
+        while (sl::io::size_hint(src) > 0) {
+            res += sl::io::read_varint(src);
+        }
+        return res;
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("binary");
+        bench_scalar(report, input);
+        bench_arrays(report, input);
+        bench_varint(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
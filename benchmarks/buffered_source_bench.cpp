@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   buffered_source_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/buffered_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "bench_utils.hpp"
+#include "plain_memory_source.hpp"
+
+const size_t input_size = 1 << 22;
+
+void bench_read_line(bench_report& report, const std::string& name, const std::string& ending) {
+    auto input = make_text_input(input_size, ending);
+    report.run(name, input.size(), [input, ending] {
+        auto src = sl::io::make_buffered_source(plain_memory_source(input));
+        uint64_t lines = 0;
+        for (;;) {
+            auto line = src.read_line(ending);
+            if (line.empty()) break;
+            lines += 1;
+        }
+        return lines;
+    });
+}
+
+void bench_read_small(bench_report& report) {
+    auto input = make_binary_input(input_size);
+    report.run("read/16_bytes", input.size(), [input] {
+        auto src = sl::io::make_buffered_source(plain_memory_source(input));
+        std::array<char, 16> buf;
+        uint64_t res = 0;
+        while (std::char_traits<char>::eof() != src.read(buf)) {
+            res += static_cast<unsigned char>(buf[0]);
+        }
+        return res;
+    });
+}
+
+int main() {
+    try {
+        bench_report report("buffered_source");
+        bench_read_line(report, "read_line/lf", "\n");
+        bench_read_line(report, "read_line/crlf", "\r\n");
+        bench_read_small(report);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
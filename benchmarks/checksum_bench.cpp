@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   checksum_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:50 AM
+ */
+#include "staticlib/io/checksum_sink.hpp"
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/checksum_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 24;
+const size_t chunk_size = 4096;
+
+std::vector<std::pair<std::string, sl::io::checksum_algorithm>> algorithms() {
+    return {
+        {"crc32", sl::io::checksum_algorithm::crc32},
+        {"crc32c", sl::io::checksum_algorithm::crc32c},
+        {"adler32", sl::io::checksum_algorithm::adler32},
+        {"xxh64", sl::io::checksum_algorithm::xxh64}
+    };
+}
+
+void bench_source(bench_report& report, const std::string& input) {
+    for (auto& en : algorithms()) {
+        auto alg = en.second;
+        report.run("checksum_source/" + en.first, input.size(), [&input, alg] {
+            auto src = sl::io::make_checksum_source(sl::io::array_source(input), alg);
+            auto sink = sl::io::null_sink();
+            sl::io::copy_all(src, sink);
+            return src.get_checksum();
+        });
+    }
+}
+
+void bench_sink(bench_report& report, const std::string& input) {
+    for (auto& en : algorithms()) {
+        auto alg = en.second;
+        report.run("checksum_sink/" + en.first, input.size(), [&input, alg] {
+            auto sink = sl::io::make_checksum_sink(sl::io::null_sink(), alg);
+            for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+                sl::io::write_all(sink, {input.data() + pos, chunk_size});
+            }
+            return sink.get_checksum();
+        });
+    }
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("checksum");
+        bench_source(report, input);
+        bench_sink(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   deflate_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 9:50 PM
+ */
+
+#include "staticlib/io/deflate_sink.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/counting_sink.hpp"
+#include "staticlib/io/inflate_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/parallel_block_compress_sink.hpp"
+#include "staticlib/io/pipeline.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 22;
+const size_t chunk_size = 4096;
+const size_t message_size = 1024;
+
+void bench_deflate(bench_report& report, const std::string& input) {
+    std::vector<int> levels = {1, 6, 9};
+    for (int level : levels) {
+        auto suffix = "/level_" + std::to_string(level);
+        report.run("deflate/outside_pipeline" + suffix, input.size(), [&input, level] {
+            // whole input is compressed in memory first
+            auto deflater = sl::io::detail_deflate::deflater(sl::io::deflate_format::gzip, level, 15);
+            deflater.compress(input);
+            deflater.finish();
+            auto sink = sl::io::make_counting_sink(sl::io::null_sink());
+            sl::io::write_all(sink, deflater.get_output());
+            return sink.get_count();
+        });
+        report.run("deflate/pipeline" + suffix, input.size(), [&input, level] {
+            auto dest = sl::io::make_counting_sink(sl::io::null_sink());
+            auto sink = dest | sl::io::deflate(sl::io::deflate_format::gzip, level);
+            for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+                sl::io::write_all(sink, {input.data() + pos, chunk_size});
+            }
+            sink.finish();
+            return dest.get_count();
+        });
+    }
+}
+
+void bench_parallel(bench_report& report, const std::string& input) {
+    std::vector<size_t> workers = {1, 2, 4};
+    for (size_t wcount : workers) {
+        report.run("deflate_parallel/workers_" + std::to_string(wcount), input.size(), [&input, wcount] {
+            auto options = sl::io::parallel_block_options();
+            options.level = 6;
+            options.workers = wcount;
+            auto dest = sl::io::make_counting_sink(sl::io::null_sink());
+            auto sink = sl::io::make_parallel_block_compress_sink(dest, options);
+            for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+                sl::io::write_all(sink, {input.data() + pos, chunk_size});
+            }
+            sink.finish();
+            return dest.get_count();
+        });
+    }
+}
+
+void bench_pooling(bench_report& report, const std::string& input) {
+    report.run("deflate_messages/new_sink", input.size(), [&input] {
+        auto dest = sl::io::make_counting_sink(sl::io::null_sink());
+        for (size_t pos = 0; pos < input.size(); pos += message_size) {
+            auto sink = sl::io::make_deflate_sink(dest, sl::io::deflate_format::zlib, 1);
+            sl::io::write_all(sink, {input.data() + pos, message_size});
+        }
+        return dest.get_count();
+    });
+    report.run("deflate_messages/reset_sink", input.size(), [&input] {
+        auto dest = sl::io::make_counting_sink(sl::io::null_sink());
+        auto sink = sl::io::make_deflate_sink(dest, sl::io::deflate_format::zlib, 1);
+        for (size_t pos = 0; pos < input.size(); pos += message_size) {
+            sl::io::write_all(sink, {input.data() + pos, message_size});
+            sink.finish();
+            sink.reset();
+        }
+        return dest.get_count();
+    });
+}
+
+void bench_inflate(bench_report& report, const std::string& input) {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = dest | sl::io::deflate(sl::io::deflate_format::gzip);
+        sl::io::write_all(sink, input);
+    }
+    const std::string& compressed = dest.get_string();
+    report.run("inflate/outside_pipeline", input.size(), [&compressed, &input] {
+        // whole output is decompressed in memory first
+        auto src = sl::io::make_inflate_source(sl::io::array_source(compressed), sl::io::deflate_format::gzip);
+        auto output = std::string(input.size(), '\0');
+        size_t read = sl::io::read_all(src, {std::addressof(output.front()), output.size()});
+        auto sink = sl::io::make_counting_sink(sl::io::null_sink());
+        sl::io::write_all(sink, {output.data(), read});
+        return sink.get_count();
+    });
+    report.run("inflate/pipeline", input.size(), [&compressed] {
+        auto src = sl::io::array_source(compressed) | sl::io::inflate(sl::io::deflate_format::gzip);
+        auto sink = sl::io::make_counting_sink(sl::io::null_sink());
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+int main() {
+    try {
+        auto input = make_text_input(input_size);
+        bench_report report("deflate");
+        bench_deflate(report, input);
+        bench_parallel(report, input);
+        bench_pooling(report, input);
+        bench_inflate(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   digest_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 6:50 AM
+ */
+#include "staticlib/io/digest_sink.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/blake3.hpp"
+#include "staticlib/io/digest_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/sha256.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 26;
+const size_t chunk_size = 1 << 16;
+
+// digest state is created by the specified function for each iteration
+template<typename Factory>
+void bench_sink(bench_report& report, const std::string& name, const std::string& input, Factory make_digest) {
+    report.run("digest_sink/" + name, input.size(), [&input, &make_digest] {
+        auto sink = sl::io::make_digest_sink(sl::io::null_sink(), make_digest());
+        for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+            sl::io::write_all(sink, {input.data() + pos, chunk_size});
+        }
+        return static_cast<uint64_t>(sink.get_digest()[0]);
+    });
+}
+
+void bench_source(bench_report& report, const std::string& input) {
+    report.run("digest_source/sha256", input.size(), [&input] {
+        auto src = sl::io::make_digest_source<sl::io::sha256>(sl::io::array_source(input));
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(src, sink);
+        return static_cast<uint64_t>(src.get_digest()[0]);
+    });
+    report.run("digest_source/blake3", input.size(), [&input] {
+        auto src = sl::io::make_digest_source<sl::io::blake3>(sl::io::array_source(input));
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(src, sink);
+        return static_cast<uint64_t>(src.get_digest()[0]);
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("digest");
+        bench_sink(report, "sha256", input, [] {
+            return sl::io::sha256();
+        });
+        bench_sink(report, "blake3", input, [] {
+            return sl::io::blake3();
+        });
+        bench_sink(report, "blake3_workers_2", input, [] {
+            return sl::io::blake3(2);
+        });
+        bench_sink(report, "blake3_workers_4", input, [] {
+            return sl::io::blake3(4);
+        });
+        bench_source(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   framed_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 9:30 AM
+ */
+#include "staticlib/io/framed_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/framed_sink.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 24;
+const size_t frame_size = 100;
+
+std::string write_frames(const std::string& input, sl::io::frame_options options) {
+    auto sink = sl::io::make_framed_sink(sl::io::string_sink(), options);
+    for (size_t pos = 0; pos + frame_size <= input.size(); pos += frame_size) {
+        std::string frame = input.substr(pos, frame_size);
+        if (sl::io::frame_format::delimited == options.format) {
+            for (char& ch : frame) {
+                ch = '\n' == ch ? ' ' : ch;
+            }
+        }
+        sink.write_frame(frame);
+    }
+    return sink.get_sink().get_string();
+}
+
+void bench_sink(bench_report& report, const std::string& input) {
+    report.run("framed_sink/length_varint", input.size(), [&input] {
+        auto options = sl::io::frame_options();
+        options.format = sl::io::frame_format::length_varint;
+        auto sink = sl::io::make_framed_sink(sl::io::null_sink(), options);
+        for (size_t pos = 0; pos + frame_size <= input.size(); pos += frame_size) {
+            sink.write_frame({input.data() + pos, frame_size});
+        }
+        return static_cast<uint64_t>(input.size());
+    });
+}
+
+void bench_source(bench_report& report, const std::string& input, const std::string& name,
+        sl::io::frame_format format) {
+    auto options = sl::io::frame_options();
+    options.format = format;
+    auto framed = write_frames(input, options);
+    report.run("framed_source/" + name, framed.size(), [&framed, options] {
+        auto src = sl::io::make_framed_source(sl::io::array_source(framed), options);
+        uint64_t res = 0;
+        while (src.next_frame()) {
+            res += src.get_frame().size();
+        }
+        return res;
+    });
+}
+
+// length prefix and allocated payload read separately for each frame
+void bench_naive(bench_report& report, const std::string& input) {
+    auto framed = write_frames(input, sl::io::frame_options());
+    report.run("naive/read_exact", framed.size(), [&framed] {
+        auto src = sl::io::array_source(framed);
+        uint64_t res = 0;
+        std::array<char, 4> prefix;
+        while (framed.size() - res > 0) {
+            sl::io::read_exact(src, {prefix.data(), prefix.size()});
+            size_t len = (static_cast<size_t>(static_cast<unsigned char>(prefix[2])) << 8) |
+                    static_cast<unsigned char>(prefix[3]);
+            std::string payload;
+            payload.resize(len);
+            sl::io::read_exact(src, {&payload.front(), len});
+            res += 4 + payload.size();
+        }
+        return res;
+    });
+}
+
+int main() {
+    try {
+        auto input = make_text_input(input_size);
+        bench_report report("framed");
+        bench_sink(report, input);
+        bench_source(report, input, "length_be32", sl::io::frame_format::length_be32);
+        bench_source(report, input, "length_varint", sl::io::frame_format::length_varint);
+        bench_source(report, input, "delimited", sl::io::frame_format::delimited);
+        bench_naive(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   hex_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/hex_sink.hpp"
+#include "staticlib/io/hex_source.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "bench_utils.hpp"
+#include "plain_memory_source.hpp"
+
+const size_t input_size = 1 << 22;
+
+void bench_hex_sink(bench_report& report, const std::string& input) {
+    report.run("hex_sink/string_sink_direct", input.size(), [&input] {
+        auto sink = sl::io::make_hex_sink(sl::io::string_sink());
+        sl::io::write_all(sink, input);
+        return sink.get_sink().get_string().size();
+    });
+    report.run("hex_sink/null_sink_buffered", input.size(), [&input] {
+        auto sink = sl::io::make_hex_sink(sl::io::null_sink());
+        sl::io::write_all(sink, input);
+        return sink.flush();
+    });
+}
+
+void bench_hex_source(bench_report& report, const std::string& hex) {
+    report.run("hex_source/array_source_direct", hex.size(), [&hex] {
+        auto src = sl::io::make_hex_source(sl::io::array_source(hex));
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+    report.run("hex_source/plain_buffered", hex.size(), [&hex] {
+        auto src = sl::io::make_hex_source(plain_memory_source(hex));
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        auto hex = sl::io::string_to_hex(input);
+        bench_report report("hex");
+        bench_hex_sink(report, input);
+        bench_hex_source(report, hex);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
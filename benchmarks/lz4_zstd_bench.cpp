@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_zstd_bench.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 2:10 AM
+ */
+#include "staticlib/io/lz4_sink.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/counting_sink.hpp"
+#include "staticlib/io/lz4_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/zstd_sink.hpp"
+#include "staticlib/io/zstd_source.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 23;
+const size_t chunk_size = 4096;
+
+template<typename Options>
+uint64_t compress_lz4(const std::string& input, Options options) {
+    auto dest = sl::io::make_counting_sink(sl::io::null_sink());
+    auto sink = sl::io::make_lz4_sink(dest, std::move(options));
+    for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+        sl::io::write_all(sink, {input.data() + pos, chunk_size});
+    }
+    sink.finish();
+    return dest.get_count();
+}
+
+template<typename Options>
+uint64_t compress_zstd(const std::string& input, Options options) {
+    auto dest = sl::io::make_counting_sink(sl::io::null_sink());
+    auto sink = sl::io::make_zstd_sink(dest, std::move(options));
+    for (size_t pos = 0; pos < input.size(); pos += chunk_size) {
+        sl::io::write_all(sink, {input.data() + pos, chunk_size});
+    }
+    sink.finish();
+    return dest.get_count();
+}
+
+void bench_lz4(bench_report& report, const std::string& input) {
+    std::vector<size_t> workers = {0, 2, 4};
+    for (size_t wcount : workers) {
+        report.run("lz4/workers_" + std::to_string(wcount), input.size(), [&input, wcount] {
+            auto options = sl::io::lz4_options();
+            options.workers = wcount;
+            return compress_lz4(input, options);
+        });
+    }
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = sl::io::make_lz4_sink(dest);
+        sl::io::write_all(sink, input);
+    }
+    const std::string& compressed = dest.get_string();
+    report.run("unlz4", input.size(), [&compressed] {
+        auto src = sl::io::make_lz4_source(sl::io::array_source(compressed));
+        auto sink = sl::io::make_counting_sink(sl::io::null_sink());
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+void bench_zstd(bench_report& report, const std::string& input) {
+    std::vector<int> levels = {1, 3, 9};
+    for (int level : levels) {
+        report.run("zstd/level_" + std::to_string(level), input.size(), [&input, level] {
+            auto options = sl::io::zstd_options();
+            options.level = level;
+            return compress_zstd(input, options);
+        });
+    }
+    std::vector<size_t> workers = {2, 4};
+    for (size_t wcount : workers) {
+        report.run("zstd/level_3/workers_" + std::to_string(wcount), input.size(), [&input, wcount] {
+            auto options = sl::io::zstd_options();
+            options.workers = wcount;
+            return compress_zstd(input, options);
+        });
+    }
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = sl::io::make_zstd_sink(dest);
+        sl::io::write_all(sink, input);
+    }
+    const std::string& compressed = dest.get_string();
+    report.run("unzstd", input.size(), [&compressed] {
+        auto src = sl::io::make_zstd_source(sl::io::array_source(compressed));
+        auto sink = sl::io::make_counting_sink(sl::io::null_sink());
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+int main() {
+    try {
+        auto input = make_text_input(input_size);
+        bench_report report("lz4_zstd");
+        bench_lz4(report, input);
+        bench_zstd(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   multi_source_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/multi_source.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+
+#include "bench_utils.hpp"
+#include "plain_memory_source.hpp"
+
+const size_t input_size = 1 << 16;
+const size_t sources_count = 256;
+
+void bench_multi(bench_report& report, const std::string& input) {
+    report.run("multi_source/array_source_borrow_read", input.size() * sources_count, [&input] {
+        auto vec = std::vector<sl::io::array_source>();
+        for (size_t i = 0; i < sources_count; i++) {
+            vec.emplace_back(input);
+        }
+        auto src = sl::io::make_multi_source(std::move(vec));
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+    report.run("multi_source/plain", input.size() * sources_count, [&input] {
+        auto vec = std::vector<plain_memory_source>();
+        for (size_t i = 0; i < sources_count; i++) {
+            vec.emplace_back(input);
+        }
+        auto src = sl::io::make_multi_source(std::move(vec));
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("multi_source");
+        bench_multi(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
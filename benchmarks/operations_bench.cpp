@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   operations_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/operations.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/buffered_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+
+#include "bench_utils.hpp"
+#include "plain_memory_source.hpp"
+
+const size_t input_size = 1 << 24;
+
+void bench_copy_buffer_sizes(bench_report& report, const std::string& input) {
+    std::vector<size_t> sizes = {64, 512, 4096, 65536};
+    for (size_t size : sizes) {
+        report.run("copy_all/plain/buffer_" + std::to_string(size), input.size(), [&input, size] {
+            auto src = plain_memory_source(input);
+            auto sink = sl::io::null_sink();
+            auto buf = std::vector<char>(size);
+            return sl::io::copy_all(src, sink, buf);
+        });
+    }
+}
+
+void bench_copy_lending(bench_report& report, const std::string& input) {
+    report.run("copy_all/array_source_next_chunk", input.size(), [&input] {
+        auto src = sl::io::array_source(input);
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+    report.run("copy_all/buffered_source_borrow_read", input.size(), [&input] {
+        auto src = sl::io::make_buffered_source(plain_memory_source(input));
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+void bench_read_all(bench_report& report, const std::string& input) {
+    report.run("read_all/plain", input.size(), [&input] {
+        auto src = plain_memory_source(input);
+        auto buf = std::vector<char>(input.size());
+        return sl::io::read_all(src, buf);
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("operations");
+        bench_copy_buffer_sizes(report, input);
+        bench_copy_lending(report, input);
+        bench_read_all(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipeline_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/pipeline.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/io/any_sink.hpp"
+#include "staticlib/io/any_source.hpp"
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "bench_utils.hpp"
+#include "plain_memory_source.hpp"
+
+const size_t input_size = 1 << 22;
+
+void bench_pipeline(bench_report& report, const std::string& hex) {
+    report.run("hex_decode/hand_nested", hex.size(), [&hex] {
+        auto src = sl::io::make_counting_source(sl::io::make_hex_source(
+                sl::io::make_limited_source(sl::io::array_source(hex), hex.size())));
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(src, sink);
+        return src.get_count();
+    });
+    report.run("hex_decode/pipeline", hex.size(), [&hex] {
+        auto src = sl::io::array_source(hex) | sl::io::limit(hex.size()) | sl::io::hex_decode() | sl::io::count();
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(src, sink);
+        return src.get_count();
+    });
+    report.run("hex_encode/hand_nested", hex.size() / 2, [&hex] {
+        auto dest = sl::io::string_sink();
+        auto sink = sl::io::make_hex_sink(sl::io::make_counting_sink(sl::io::make_buffered_sink(dest)));
+        sl::io::write_all(sink, {hex.data(), hex.size() / 2});
+        sink.flush();
+        return sink.get_sink().get_count();
+    });
+    report.run("hex_encode/pipeline", hex.size() / 2, [&hex] {
+        auto dest = sl::io::string_sink();
+        auto sink = dest | sl::io::buffer() | sl::io::count() | sl::io::hex_encode();
+        sl::io::write_all(sink, {hex.data(), hex.size() / 2});
+        sink.flush();
+        return sink.get_sink().get_count();
+    });
+}
+
+void bench_any(bench_report& report, const std::string& input) {
+    std::vector<size_t> sizes = {16, 4096};
+    for (size_t size : sizes) {
+        report.run("read/direct/buffer_" + std::to_string(size), input.size(), [&input, size] {
+            auto src = plain_memory_source(input);
+            auto sink = sl::io::null_sink();
+            auto buf = std::vector<char>(size);
+            return sl::io::copy_all(src, sink, buf);
+        });
+        report.run("read/any_source/buffer_" + std::to_string(size), input.size(), [&input, size] {
+            auto src = sl::io::make_any_source(plain_memory_source(input));
+            auto sink = sl::io::make_any_sink(sl::io::null_sink());
+            auto buf = std::vector<char>(size);
+            return sl::io::copy_all(src, sink, buf);
+        });
+    }
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        auto hex = sl::io::string_to_hex(input);
+        bench_report report("pipeline");
+        bench_pipeline(report, hex);
+        bench_any(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   plain_memory_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#ifndef STATICLIB_IO_BENCHMARKS_PLAIN_MEMORY_SOURCE_HPP
+#define STATICLIB_IO_BENCHMARKS_PLAIN_MEMORY_SOURCE_HPP
+
+#include <cstring>
+#include <ios>
+#include <string>
+
+#include "staticlib/io/span.hpp"
+
+// memory source that supports only copying reads,
+// used as a baseline for sources that lend their data
+class plain_memory_source {
+    const std::string* data;
+    size_t idx = 0;
+
+public:
+    explicit plain_memory_source(const std::string& data) :
+    data(std::addressof(data)) { }
+
+    plain_memory_source(const plain_memory_source&) = delete;
+
+    plain_memory_source& operator=(const plain_memory_source&) = delete;
+
+    plain_memory_source(plain_memory_source&& other) STATICLIB_NOEXCEPT :
+    data(other.data),
+    idx(other.idx) { }
+
+    plain_memory_source& operator=(plain_memory_source&& other) STATICLIB_NOEXCEPT {
+        data = other.data;
+        idx = other.idx;
+        return *this;
+    }
+
+    std::streamsize read(sl::io::span<char> span) {
+        size_t avail = data->size() - idx;
+        if (0 == avail) {
+            return std::char_traits<char>::eof();
+        }
+        size_t len = span.size() <= avail ? span.size() : avail;
+        std::memcpy(span.data(), data->data() + idx, len);
+        idx += len;
+        return static_cast<std::streamsize>(len);
+    }
+};
+
+#endif /* STATICLIB_IO_BENCHMARKS_PLAIN_MEMORY_SOURCE_HPP */
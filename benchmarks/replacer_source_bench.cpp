@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   replacer_source_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/replacer_source.hpp"
+
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 20;
+
+std::string make_template(size_t size) {
+    std::string res;
+    res.reserve(size + 64);
+    while (res.size() < size) {
+        res.append("lorem ipsum {{foo}} dolor sit {{bar}} amet\n");
+    }
+    return res;
+}
+
+void bench_replacer(bench_report& report, const std::string& input) {
+    auto values = std::map<std::string, std::string>{{"foo", "42"}, {"bar", "baz"}};
+    report.run("replacer_source/copy_all", input.size(), [&input, &values] {
+        auto src = sl::io::make_replacer_source(sl::io::string_source(input), values,
+                [](const std::string& err) {
+                    throw sl::io::io_exception(err);
+                });
+        auto sink = sl::io::null_sink();
+        return sl::io::copy_all(src, sink);
+    });
+}
+
+void bench_str_replace(bench_report& report, const std::string& input) {
+    auto values = std::map<std::string, std::string>{{"foo", "42"}, {"bar", "baz"}};
+    report.run("str_replace", input.size(), [&input, &values] {
+        return sl::io::str_replace(input, values).size();
+    });
+}
+
+int main() {
+    try {
+        auto input = make_template(input_size);
+        bench_report report("replacer_source");
+        bench_replacer(report, input);
+        bench_str_replace(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
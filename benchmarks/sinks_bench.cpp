@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   sinks_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/array_sink.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "staticlib/io/buffered_sink.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 22;
+
+template<typename Sink>
+void write_chunks(Sink& sink, const std::string& input, size_t chunk) {
+    for (size_t i = 0; i < input.size(); i += chunk) {
+        size_t len = input.size() - i < chunk ? input.size() - i : chunk;
+        sl::io::write_all(sink, {input.data() + i, len});
+    }
+}
+
+void bench_string_sink(bench_report& report, const std::string& input) {
+    report.run("string_sink/growth_16", input.size(), [&input] {
+        auto sink = sl::io::string_sink();
+        write_chunks(sink, input, 16);
+        return sink.get_string().size();
+    });
+    report.run("string_sink/growth_4096", input.size(), [&input] {
+        auto sink = sl::io::string_sink();
+        write_chunks(sink, input, 4096);
+        return sink.get_string().size();
+    });
+}
+
+void bench_array_sink(bench_report& report, const std::string& input) {
+    report.run("array_sink/growth_16", input.size(), [&input] {
+        auto sink = sl::io::make_array_sink();
+        write_chunks(sink, input, 16);
+        auto span = sink.release();
+        size_t size = span.size();
+        std::free(span.data());
+        return size;
+    });
+    report.run("array_sink/growth_4096", input.size(), [&input] {
+        auto sink = sl::io::make_array_sink();
+        write_chunks(sink, input, 4096);
+        auto span = sink.release();
+        size_t size = span.size();
+        std::free(span.data());
+        return size;
+    });
+}
+
+void bench_buffered_sink(bench_report& report, const std::string& input) {
+    report.run("buffered_sink/write_16", input.size(), [&input] {
+        auto sink = sl::io::make_buffered_sink(sl::io::null_sink());
+        write_chunks(sink, input, 16);
+        return sink.flush();
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("sinks");
+        bench_string_sink(report, input);
+        bench_array_sink(report, input);
+        bench_buffered_sink(report, input);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   streambuf_bench.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "staticlib/io/streambuf_sink.hpp"
+#include "staticlib/io/streambuf_source.hpp"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "staticlib/io/buffered_streambuf.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/source_istream.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "bench_utils.hpp"
+
+const size_t input_size = 1 << 22;
+
+// previous implementation, used as a baseline
+class sgetn_source {
+    std::streambuf* streambuf;
+
+public:
+    explicit sgetn_source(std::streambuf* streambuf) :
+    streambuf(streambuf) { }
+
+    std::streamsize read(sl::io::span<char> span) {
+        std::streamsize res = streambuf->sgetn(span.data(), span.size_signed());
+        if (res > 0) {
+            return res;
+        } else if (0 == res && std::char_traits<char>::eof() == streambuf->sbumpc()) {
+            return std::char_traits<char>::eof();
+        } else {
+            streambuf->sungetc();
+            return res;
+        }
+    }
+};
+
+// previous implementation, used as a baseline
+class sputn_sink {
+    std::streambuf* streambuf;
+
+public:
+    explicit sputn_sink(std::streambuf* streambuf) :
+    streambuf(streambuf) { }
+
+    std::streamsize write(sl::io::span<const char> span) {
+        return streambuf->sputn(span.data(), span.size_signed());
+    }
+
+    std::streamsize flush() {
+        return streambuf->pubsync();
+    }
+};
+
+template<typename Source, size_t BufferSize>
+uint64_t read_streambuf(std::streambuf* sb) {
+    auto src = Source(sb);
+    auto sink = sl::io::null_sink();
+    std::array<char, BufferSize> buf;
+    return sl::io::copy_all(src, sink, buf);
+}
+
+template<typename Sink, size_t BufferSize>
+uint64_t write_streambuf(std::streambuf* sb, const std::string& input) {
+    auto sink = Sink(sb);
+    auto src = sl::io::string_source(input);
+    std::array<char, BufferSize> buf;
+    uint64_t res = sl::io::copy_all(src, sink, buf);
+    sink.flush();
+    return res;
+}
+
+void bench_streambuf_source(bench_report& report, const std::string& input, const std::string& path) {
+    report.run("streambuf_source/stringbuf/64", input.size(), [&input] {
+        std::stringbuf buf(input, std::ios_base::in);
+        return read_streambuf<sl::io::streambuf_source, 64>(std::addressof(buf));
+    });
+    report.run("sgetn_source/stringbuf/64", input.size(), [&input] {
+        std::stringbuf buf(input, std::ios_base::in);
+        return read_streambuf<sgetn_source, 64>(std::addressof(buf));
+    });
+    report.run("streambuf_source/stringbuf/4096", input.size(), [&input] {
+        std::stringbuf buf(input, std::ios_base::in);
+        return read_streambuf<sl::io::streambuf_source, 4096>(std::addressof(buf));
+    });
+    report.run("sgetn_source/stringbuf/4096", input.size(), [&input] {
+        std::stringbuf buf(input, std::ios_base::in);
+        return read_streambuf<sgetn_source, 4096>(std::addressof(buf));
+    });
+    report.run("streambuf_source/filebuf/64", input.size(), [&path] {
+        std::filebuf buf;
+        buf.open(path, std::ios_base::in | std::ios_base::binary);
+        return read_streambuf<sl::io::streambuf_source, 64>(std::addressof(buf));
+    });
+    report.run("sgetn_source/filebuf/64", input.size(), [&path] {
+        std::filebuf buf;
+        buf.open(path, std::ios_base::in | std::ios_base::binary);
+        return read_streambuf<sgetn_source, 64>(std::addressof(buf));
+    });
+    report.run("streambuf_source/filebuf/4096", input.size(), [&path] {
+        std::filebuf buf;
+        buf.open(path, std::ios_base::in | std::ios_base::binary);
+        return read_streambuf<sl::io::streambuf_source, 4096>(std::addressof(buf));
+    });
+    report.run("sgetn_source/filebuf/4096", input.size(), [&path] {
+        std::filebuf buf;
+        buf.open(path, std::ios_base::in | std::ios_base::binary);
+        return read_streambuf<sgetn_source, 4096>(std::addressof(buf));
+    });
+}
+
+void bench_streambuf_sink(bench_report& report, const std::string& input, const std::string& path) {
+    report.run("streambuf_sink/stringbuf/64", input.size(), [&input] {
+        std::stringbuf buf(std::ios_base::out);
+        return write_streambuf<sl::io::streambuf_sink, 64>(std::addressof(buf), input);
+    });
+    report.run("sputn_sink/stringbuf/64", input.size(), [&input] {
+        std::stringbuf buf(std::ios_base::out);
+        return write_streambuf<sputn_sink, 64>(std::addressof(buf), input);
+    });
+    report.run("streambuf_sink/filebuf/64", input.size(), [&input, &path] {
+        std::filebuf buf;
+        buf.open(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        return write_streambuf<sl::io::streambuf_sink, 64>(std::addressof(buf), input);
+    });
+    report.run("sputn_sink/filebuf/64", input.size(), [&input, &path] {
+        std::filebuf buf;
+        buf.open(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        return write_streambuf<sputn_sink, 64>(std::addressof(buf), input);
+    });
+}
+
+void bench_getline(bench_report& report, const std::string& text) {
+    report.run("getline/istringstream", text.size(), [&text] {
+        std::istringstream stream(text);
+        std::string line;
+        uint64_t res = 0;
+        while (std::getline(stream, line)) {
+            res += line.size();
+        }
+        return res;
+    });
+    report.run("getline/source_istream", text.size(), [&text] {
+        auto stream = sl::io::make_source_istream_ptr(sl::io::string_source(text));
+        std::string line;
+        uint64_t res = 0;
+        while (std::getline(*stream, line)) {
+            res += line.size();
+        }
+        return res;
+    });
+}
+
+void bench_ostream(bench_report& report, const std::string& text) {
+    report.run("ostream/ostringstream", text.size(), [&text] {
+        std::ostringstream stream;
+        stream << text;
+        return static_cast<uint64_t>(stream.str().size());
+    });
+    report.run("ostream/buffered_ostreambuf", text.size(), [&text] {
+        auto sink = sl::io::string_sink();
+        {
+            auto sb = sl::io::make_buffered_ostreambuf(sink);
+            std::ostream stream(std::addressof(sb));
+            stream << text;
+        }
+        return static_cast<uint64_t>(sink.get_string().size());
+    });
+}
+
+int main() {
+    try {
+        auto input = make_binary_input(input_size);
+        bench_report report("streambuf");
+        std::string path = "streambuf_bench.tmp";
+        {
+            std::filebuf buf;
+            buf.open(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+            buf.sputn(input.data(), static_cast<std::streamsize>(input.size()));
+        }
+        bench_streambuf_source(report, input, path);
+        bench_streambuf_sink(report, input, path);
+        std::remove(path.c_str());
+        auto text = make_text_input(input_size, "\n");
+        bench_getline(report, text);
+        bench_ostream(report, text);
+        report.print();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
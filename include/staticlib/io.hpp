@@ -26,37 +26,93 @@
 
 #include "staticlib/config.hpp"
 
+#include "staticlib/io/any_sink.hpp"
+#include "staticlib/io/any_source.hpp"
+#include "staticlib/io/any_storage.hpp"
 #include "staticlib/io/array_sink.hpp"
 #include "staticlib/io/array_source.hpp"
+#include "staticlib/io/blake3.hpp"
+#include "staticlib/io/block_workers.hpp"
 #include "staticlib/io/buffered_sink.hpp"
 #include "staticlib/io/buffered_source.hpp"
+#include "staticlib/io/buffered_streambuf.hpp"
+#include "staticlib/io/byte_order.hpp"
+#include "staticlib/io/channel.hpp"
+#include "staticlib/io/channel_sink.hpp"
+#include "staticlib/io/channel_source.hpp"
+#include "staticlib/io/checksum.hpp"
+#include "staticlib/io/checksum_sink.hpp"
+#include "staticlib/io/checksum_source.hpp"
+#include "staticlib/io/combining_sink.hpp"
 #include "staticlib/io/copying_source.hpp"
 #include "staticlib/io/counting_sink.hpp"
 #include "staticlib/io/counting_source.hpp"
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/deflate_sink.hpp"
+#include "staticlib/io/deflater.hpp"
+#include "staticlib/io/digest_sink.hpp"
+#include "staticlib/io/digest_source.hpp"
 #include "staticlib/io/flushable_sink.hpp"
+#include "staticlib/io/frame_input.hpp"
+#include "staticlib/io/framed_format.hpp"
+#include "staticlib/io/framed_sink.hpp"
+#include "staticlib/io/framed_source.hpp"
 #include "staticlib/io/hex_sink.hpp"
 #include "staticlib/io/hex_source.hpp"
 #include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/inflate_source.hpp"
+#include "staticlib/io/inflater.hpp"
+#include "staticlib/io/instrumented_sink.hpp"
+#include "staticlib/io/instrumented_source.hpp"
 #include "staticlib/io/io_exception.hpp"
 #include "staticlib/io/limited_source.hpp"
+#include "staticlib/io/lz4_compressor.hpp"
+#include "staticlib/io/lz4_decompressor.hpp"
+#include "staticlib/io/lz4_format.hpp"
+#include "staticlib/io/lz4_sink.hpp"
+#include "staticlib/io/lz4_source.hpp"
+#include "staticlib/io/memory_ring.hpp"
 #include "staticlib/io/memory_sink.hpp"
 #include "staticlib/io/multi_source.hpp"
 #include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operation_metrics.hpp"
 #include "staticlib/io/operations.hpp"
+#include "staticlib/io/parallel_block_compress_sink.hpp"
+#include "staticlib/io/parallel_copy.hpp"
+#include "staticlib/io/pipe.hpp"
+#include "staticlib/io/pipe_sink.hpp"
+#include "staticlib/io/pipe_source.hpp"
+#include "staticlib/io/pipe_state.hpp"
+#include "staticlib/io/pipeline.hpp"
 #include "staticlib/io/reference_sink.hpp"
 #include "staticlib/io/reference_source.hpp"
 #include "staticlib/io/replacer_source.hpp"
+#include "staticlib/io/ring_memory_sink.hpp"
+#include "staticlib/io/ring_memory_source.hpp"
+#include "staticlib/io/seekable.hpp"
+#include "staticlib/io/sha256.hpp"
 #include "staticlib/io/shared_sink.hpp"
 #include "staticlib/io/shared_source.hpp"
+#include "staticlib/io/sink_ostream.hpp"
 #include "staticlib/io/source_istream.hpp"
 #include "staticlib/io/span.hpp"
+#include "staticlib/io/streambuf_access.hpp"
 #include "staticlib/io/streambuf_sink.hpp"
 #include "staticlib/io/streambuf_source.hpp"
 #include "staticlib/io/string_sink.hpp"
 #include "staticlib/io/string_source.hpp"
+#include "staticlib/io/synchronized_sink.hpp"
+#include "staticlib/io/synchronized_source.hpp"
+#include "staticlib/io/traits.hpp"
 #include "staticlib/io/unbuffered_streambuf.hpp"
 #include "staticlib/io/unique_sink.hpp"
 #include "staticlib/io/unique_source.hpp"
+#include "staticlib/io/xxhash.hpp"
+#include "staticlib/io/zstd_compressor.hpp"
+#include "staticlib/io/zstd_decompressor.hpp"
+#include "staticlib/io/zstd_format.hpp"
+#include "staticlib/io/zstd_sink.hpp"
+#include "staticlib/io/zstd_source.hpp"
 
 #endif /* STATICLIB_IO_HPP */
 
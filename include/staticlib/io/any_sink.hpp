@@ -0,0 +1,280 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   any_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#ifndef STATICLIB_IO_ANY_SINK_HPP
+#define STATICLIB_IO_ANY_SINK_HPP
+
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/any_storage.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/unique_sink.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Type-erased sink wrapper, can hold any sink type. Small sinks
+ * (up to 64 bytes with non-throwing move constructor) are stored inline,
+ * larger ones are allocated on heap. Each "write" and "flush" call is dispatched
+ * through a single indirect call, so writing large chunks
+ * keeps the dispatch overhead small.
+ */
+class any_sink {
+    /**
+     * Operations table for stored sink type
+     */
+    struct vtable {
+        void (*destroy)(detail_any::storage_type&);
+        void (*move)(detail_any::storage_type&, detail_any::storage_type&);
+        std::streamsize (*write)(detail_any::storage_type&, span<const char>);
+        std::streamsize (*flush)(detail_any::storage_type&);
+        bool heap;
+    };
+
+    /**
+     * Operations table instance for the specified sink type
+     */
+    template<typename Sink, bool heap>
+    struct vtable_for {
+        static std::streamsize write(detail_any::storage_type& st, span<const char> span) {
+            return detail_any::holder<Sink, heap>::get(st)->write(span);
+        }
+
+        static std::streamsize flush(detail_any::storage_type& st) {
+            return detail_any::holder<Sink, heap>::get(st)->flush();
+        }
+
+        static const vtable value;
+    };
+
+    /**
+     * Sink storage
+     */
+    detail_any::storage_type storage;
+    /**
+     * Operations table, null if this instance is empty
+     */
+    const vtable* vt;
+
+public:
+    /**
+     * Constructor, creates empty instance
+     */
+    any_sink() STATICLIB_NOEXCEPT :
+    vt(nullptr) { }
+
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     */
+    template<typename Sink,
+            class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type,
+            class = typename std::enable_if<!std::is_same<Sink, any_sink>::value>::type>
+    explicit any_sink(Sink&& sink) :
+    vt(std::addressof(vtable_for<Sink, !detail_any::fits_inline<Sink>::value>::value)) {
+        detail_any::holder<Sink>::create(storage, std::move(sink));
+    }
+
+    /**
+     * Constructor, takes the ownership of the sink held
+     * by specified unique sink without moving it
+     * 
+     * @param sink unique sink
+     */
+    template<typename Sink>
+    explicit any_sink(unique_sink<Sink>&& sink) :
+    vt(nullptr) {
+        Sink* ptr = sink.release();
+        if (nullptr != ptr) {
+            detail_any::holder<Sink, true>::adopt(storage, ptr);
+            vt = std::addressof(vtable_for<Sink, true>::value);
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    any_sink(const any_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    any_sink& operator=(const any_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    any_sink(any_sink&& other) STATICLIB_NOEXCEPT :
+    vt(other.vt) {
+        if (nullptr != vt) {
+            vt->move(other.storage, storage);
+            other.vt = nullptr;
+        }
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    any_sink& operator=(any_sink&& other) STATICLIB_NOEXCEPT {
+        if (this != std::addressof(other)) {
+            reset();
+            if (nullptr != other.vt) {
+                other.vt->move(other.storage, storage);
+                vt = other.vt;
+                other.vt = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor, destroys stored sink
+     */
+    ~any_sink() STATICLIB_NOEXCEPT {
+        reset();
+    }
+
+    /**
+     * Write implementation delegated to the stored sink
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     * @throws io_exception if this instance is empty
+     */
+    std::streamsize write(span<const char> span) {
+        if (nullptr == vt) throw io_exception(TRACEMSG("Invalid write to empty 'any_sink'"));
+        return vt->write(storage, span);
+    }
+
+    /**
+     * Flush implementation delegated to the stored sink
+     * 
+     * @return number of bytes flushed
+     * @throws io_exception if this instance is empty
+     */
+    std::streamsize flush() {
+        if (nullptr == vt) throw io_exception(TRACEMSG("Invalid flush of empty 'any_sink'"));
+        return vt->flush(storage);
+    }
+
+    /**
+     * Stored sink accessor
+     * 
+     * @return pointer to the stored sink if it has specified type, null otherwise
+     */
+    template<typename Sink>
+    Sink* target() {
+        if (std::addressof(vtable_for<Sink, false>::value) == vt) {
+            return detail_any::holder<Sink, false>::get(storage);
+        }
+        if (std::addressof(vtable_for<Sink, true>::value) == vt) {
+            return detail_any::holder<Sink, true>::get(storage);
+        }
+        return nullptr;
+    }
+
+    /**
+     * Checks whether this instance holds a sink
+     * 
+     * @return true if this instance is empty, false otherwise
+     */
+    bool is_empty() const {
+        return nullptr == vt;
+    }
+
+    /**
+     * Checks whether stored sink is allocated inline
+     * 
+     * @return true if stored sink is allocated inline, false otherwise
+     */
+    bool is_inline() const {
+        return nullptr != vt && !vt->heap;
+    }
+
+private:
+    void reset() STATICLIB_NOEXCEPT {
+        if (nullptr != vt) {
+            vt->destroy(storage);
+            vt = nullptr;
+        }
+    }
+
+};
+
+template<typename Sink, bool heap>
+const any_sink::vtable any_sink::vtable_for<Sink, heap>::value = {
+    detail_any::holder<Sink, heap>::destroy,
+    detail_any::holder<Sink, heap>::move,
+    any_sink::vtable_for<Sink, heap>::write,
+    any_sink::vtable_for<Sink, heap>::flush,
+    heap
+};
+
+/**
+ * Factory function for creating type-erased sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @return type-erased sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+any_sink make_any_sink(Sink&& sink) {
+    return any_sink(std::move(sink));
+}
+
+/**
+ * Factory function for creating type-erased sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @return type-erased sink
+ */
+template <typename Sink>
+any_sink make_any_sink(Sink& sink) {
+    return any_sink(make_reference_sink(sink));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ANY_SINK_HPP */
@@ -0,0 +1,263 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   any_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#ifndef STATICLIB_IO_ANY_SOURCE_HPP
+#define STATICLIB_IO_ANY_SOURCE_HPP
+
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/any_storage.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/unique_source.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Type-erased source wrapper, can hold any source type. Small sources
+ * (up to 64 bytes with non-throwing move constructor) are stored inline,
+ * larger ones are allocated on heap. Each "read" call is dispatched
+ * through a single indirect call, so reading large chunks
+ * keeps the dispatch overhead small.
+ */
+class any_source {
+    /**
+     * Operations table for stored source type
+     */
+    struct vtable {
+        void (*destroy)(detail_any::storage_type&);
+        void (*move)(detail_any::storage_type&, detail_any::storage_type&);
+        std::streamsize (*read)(detail_any::storage_type&, span<char>);
+        bool heap;
+    };
+
+    /**
+     * Operations table instance for the specified source type
+     */
+    template<typename Source, bool heap>
+    struct vtable_for {
+        static std::streamsize read(detail_any::storage_type& st, span<char> span) {
+            return detail_any::holder<Source, heap>::get(st)->read(span);
+        }
+
+        static const vtable value;
+    };
+
+    /**
+     * Source storage
+     */
+    detail_any::storage_type storage;
+    /**
+     * Operations table, null if this instance is empty
+     */
+    const vtable* vt;
+
+public:
+    /**
+     * Constructor, creates empty instance
+     */
+    any_source() STATICLIB_NOEXCEPT :
+    vt(nullptr) { }
+
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     */
+    template<typename Source,
+            class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type,
+            class = typename std::enable_if<!std::is_same<Source, any_source>::value>::type>
+    explicit any_source(Source&& src) :
+    vt(std::addressof(vtable_for<Source, !detail_any::fits_inline<Source>::value>::value)) {
+        detail_any::holder<Source>::create(storage, std::move(src));
+    }
+
+    /**
+     * Constructor, takes the ownership of the source held
+     * by specified unique source without moving it
+     * 
+     * @param src unique source
+     */
+    template<typename Source>
+    explicit any_source(unique_source<Source>&& src) :
+    vt(nullptr) {
+        Source* ptr = src.release();
+        if (nullptr != ptr) {
+            detail_any::holder<Source, true>::adopt(storage, ptr);
+            vt = std::addressof(vtable_for<Source, true>::value);
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    any_source(const any_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    any_source& operator=(const any_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    any_source(any_source&& other) STATICLIB_NOEXCEPT :
+    vt(other.vt) {
+        if (nullptr != vt) {
+            vt->move(other.storage, storage);
+            other.vt = nullptr;
+        }
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    any_source& operator=(any_source&& other) STATICLIB_NOEXCEPT {
+        if (this != std::addressof(other)) {
+            reset();
+            if (nullptr != other.vt) {
+                other.vt->move(other.storage, storage);
+                vt = other.vt;
+                other.vt = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor, destroys stored source
+     */
+    ~any_source() STATICLIB_NOEXCEPT {
+        reset();
+    }
+
+    /**
+     * Read implementation delegated to the stored source
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     * @throws io_exception if this instance is empty
+     */
+    std::streamsize read(span<char> span) {
+        if (nullptr == vt) throw io_exception(TRACEMSG("Invalid read from empty 'any_source'"));
+        return vt->read(storage, span);
+    }
+
+    /**
+     * Stored source accessor
+     * 
+     * @return pointer to the stored source if it has specified type, null otherwise
+     */
+    template<typename Source>
+    Source* target() {
+        if (std::addressof(vtable_for<Source, false>::value) == vt) {
+            return detail_any::holder<Source, false>::get(storage);
+        }
+        if (std::addressof(vtable_for<Source, true>::value) == vt) {
+            return detail_any::holder<Source, true>::get(storage);
+        }
+        return nullptr;
+    }
+
+    /**
+     * Checks whether this instance holds a source
+     * 
+     * @return true if this instance is empty, false otherwise
+     */
+    bool is_empty() const {
+        return nullptr == vt;
+    }
+
+    /**
+     * Checks whether stored source is allocated inline
+     * 
+     * @return true if stored source is allocated inline, false otherwise
+     */
+    bool is_inline() const {
+        return nullptr != vt && !vt->heap;
+    }
+
+private:
+    void reset() STATICLIB_NOEXCEPT {
+        if (nullptr != vt) {
+            vt->destroy(storage);
+            vt = nullptr;
+        }
+    }
+
+};
+
+template<typename Source, bool heap>
+const any_source::vtable any_source::vtable_for<Source, heap>::value = {
+    detail_any::holder<Source, heap>::destroy,
+    detail_any::holder<Source, heap>::move,
+    any_source::vtable_for<Source, heap>::read,
+    heap
+};
+
+/**
+ * Factory function for creating type-erased sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @return type-erased source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+any_source make_any_source(Source&& source) {
+    return any_source(std::move(source));
+}
+
+/**
+ * Factory function for creating type-erased sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @return type-erased source
+ */
+template <typename Source>
+any_source make_any_source(Source& source) {
+    return any_source(make_reference_source(source));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ANY_SOURCE_HPP */
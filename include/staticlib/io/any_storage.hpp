@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   any_storage.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#ifndef STATICLIB_IO_ANY_STORAGE_HPP
+#define STATICLIB_IO_ANY_STORAGE_HPP
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_any {
+
+/**
+ * Inline storage for type-erased sources and sinks, wrappers that
+ * do not fit into it are allocated on heap
+ */
+typedef std::aligned_storage<64>::type storage_type;
+
+/**
+ * Checks whether specified type can be stored inline
+ */
+template<typename T>
+struct fits_inline {
+    /**
+     * Check result
+     */
+    static const bool value = sizeof(T) <= sizeof(storage_type) &&
+            0 == std::alignment_of<storage_type>::value % std::alignment_of<T>::value &&
+            std::is_nothrow_move_constructible<T>::value;
+};
+
+/**
+ * Operations on the object stored inline
+ */
+template<typename T, bool heap = !fits_inline<T>::value>
+struct holder {
+    static T* get(storage_type& st) {
+        return reinterpret_cast<T*>(std::addressof(st));
+    }
+
+    static void create(storage_type& st, T&& obj) {
+        ::new (static_cast<void*>(std::addressof(st))) T(std::move(obj));
+    }
+
+    static void destroy(storage_type& st) STATICLIB_NOEXCEPT {
+        get(st)->~T();
+    }
+
+    static void move(storage_type& from, storage_type& to) STATICLIB_NOEXCEPT {
+        ::new (static_cast<void*>(std::addressof(to))) T(std::move(*get(from)));
+        get(from)->~T();
+    }
+};
+
+/**
+ * Operations on the object allocated on heap,
+ * only the pointer is stored inline
+ */
+template<typename T>
+struct holder<T, true> {
+    static T*& ptr(storage_type& st) {
+        return *reinterpret_cast<T**>(std::addressof(st));
+    }
+
+    static T* get(storage_type& st) {
+        return ptr(st);
+    }
+
+    static void create(storage_type& st, T&& obj) {
+        adopt(st, new T(std::move(obj)));
+    }
+
+    static void adopt(storage_type& st, T* obj) {
+        ::new (static_cast<void*>(std::addressof(st))) T*(obj);
+    }
+
+    static void destroy(storage_type& st) STATICLIB_NOEXCEPT {
+        delete ptr(st);
+    }
+
+    static void move(storage_type& from, storage_type& to) STATICLIB_NOEXCEPT {
+        adopt(to, ptr(from));
+        ptr(from) = nullptr;
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ANY_STORAGE_HPP */
@@ -174,20 +174,39 @@ public:
      * @return number of bytes processed
      */
     std::streamsize write(span<const char> span) {
-        while (bufsize + span.size() > capacity) {
-            capacity = static_cast<size_t>(static_cast<float>(capacity) * grow_coef);
-            char* nbuf = alloc_fun(static_cast<int>(capacity + 1));
-            if (nullptr == nbuf) throw io_exception(TRACEMSG(
-                    "Alloc error for capacity: [" + sl::support::to_string(capacity) + "]"));
-            std::memcpy(nbuf, buf, bufsize);
-            free_fun(buf);
-            buf = nbuf;
-        }
+        reserve_tail(span.size());
         std::memcpy(buf + bufsize, span.data(), span.size());
         bufsize += span.size();
         return span.size_signed();
     }
 
+    /**
+     * Lends the free tail of the buffer, so data can be written
+     * into it directly, buffer is grown if necessary.
+     * Written data becomes a part of the buffer after "commit" call.
+     * 
+     * @param min min number of bytes required
+     * @return span over the free tail of the buffer, at least "min" bytes long
+     */
+    span<char> prepare(size_t min) {
+        reserve_tail(min);
+        return span<char>(buf + bufsize, capacity - bufsize);
+    }
+
+    /**
+     * Appends specified number of bytes, written into the span returned
+     * from the last "prepare" call, to the buffer
+     * 
+     * @param count number of bytes written
+     * @throws io_exception if count exceeds prepared space
+     */
+    void commit(size_t count) {
+        if (count > capacity - bufsize) throw io_exception(TRACEMSG(
+                "Commit size: [" + sl::support::to_string(count) + "]" +
+                " exceeds prepared size: [" + sl::support::to_string(capacity - bufsize) + "]"));
+        bufsize += count;
+    }
+
     /**
      * No-op flush
      * 
@@ -244,6 +263,27 @@ public:
     size_t size() const {
         return bufsize;
     }
+
+private:
+    void reserve_tail(size_t len) {
+        if (bufsize + len <= capacity) {
+            return;
+        }
+        size_t ncap = capacity;
+        while (bufsize + len > ncap) {
+            size_t grown = static_cast<size_t>(static_cast<float>(ncap) * grow_coef);
+            ncap = grown > ncap ? grown : bufsize + len;
+        }
+        char* nbuf = alloc_fun(static_cast<int>(ncap + 1));
+        if (nullptr == nbuf) throw io_exception(TRACEMSG(
+                "Alloc error for capacity: [" + sl::support::to_string(ncap) + "]"));
+        if (nullptr != buf) {
+            std::memcpy(nbuf, buf, bufsize);
+            free_fun(buf);
+        }
+        buf = nbuf;
+        capacity = ncap;
+    }
     
 };
 
@@ -27,10 +27,12 @@
 #include <cstdint>
 #include <cstring>
 #include <ios>
+#include <string>
 
 #include "staticlib/config.hpp"
 
 #include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/seekable.hpp"
 #include "staticlib/io/span.hpp"
 
 namespace staticlib {
@@ -83,6 +85,25 @@ public:
     src_buf(src_buf.data()),
     src_buf_len(src_buf.size()) { }
 
+    /**
+     * Constructor, creates a non-owning view over the specified
+     * string, string contents are not copied and must outlive
+     * this source
+     * 
+     * @param str source string
+     */
+    array_source(const std::string& str) :
+    src_buf(str.data()),
+    src_buf_len(str.length()) { }
+
+    /**
+     * Deleted constructor, view over the temporary string
+     * would be left dangling
+     * 
+     * @param str source string
+     */
+    array_source(std::string&& str) = delete;
+
     /**
      * Copy constructor
      * 
@@ -153,6 +174,82 @@ public:
         } else return std::char_traits<char>::eof();
     }
 
+    /**
+     * Lends all the remaining data directly from the source buffer
+     * without copying it, current position is moved to the end
+     * 
+     * @return span over the remaining data, empty span if source is exhausted
+     */
+    span<const char> next_chunk() {
+        size_t avail = src_buf_len - idx;
+        const char* ptr = src_buf + idx;
+        this->idx = src_buf_len;
+        return span<const char>(ptr, avail);
+    }
+
+    /**
+     * Lends up to specified number of bytes directly from the source
+     * buffer without copying them, current position is moved accordingly
+     * 
+     * @param max max number of bytes to lend, must be positive
+     * @return span over the lent data, empty span if source is exhausted
+     */
+    span<const char> borrow_read(size_t max) {
+        size_t avail = src_buf_len - idx;
+        size_t len = max <= avail ? max : avail;
+        const char* ptr = src_buf + idx;
+        this->idx += len;
+        return span<const char>(ptr, len);
+    }
+
+    /**
+     * Positional read implementation, does not change
+     * the current position and can be called concurrently
+     * 
+     * @param offset offset in source buffer to read from
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize read_at(size_t offset, span<char> span) const {
+        if (offset < src_buf_len) {
+            size_t avail = src_buf_len - offset;
+            size_t len = span.size() <= avail ? span.size() : avail;
+            std::memcpy(span.data(), src_buf + offset, len);
+            return static_cast<std::streamsize>(len);
+        } else return std::char_traits<char>::eof();
+    }
+
+    /**
+     * Changes current position
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     * @throws io_exception if new position is out of bounds
+     */
+    size_t seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg) {
+        idx = seek_position(idx, src_buf_len, offset, whence);
+        return idx;
+    }
+
+    /**
+     * Current position accessor
+     * 
+     * @return current position
+     */
+    size_t tell() const {
+        return idx;
+    }
+
+    /**
+     * Source buffer length accessor
+     * 
+     * @return source buffer length
+     */
+    size_t size() const {
+        return src_buf_len;
+    }
+
     /**
      * Source buffer accessor
      * 
@@ -0,0 +1,702 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   blake3.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 4:40 AM
+ */
+#ifndef STATICLIB_IO_BLAKE3_HPP
+#define STATICLIB_IO_BLAKE3_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/block_workers.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define STATICLIB_IO_BLAKE3_AVX2
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#define STATICLIB_IO_BLAKE3_TARGET_AVX2
+#else // !_MSC_VER
+#include <cpuid.h>
+#include <immintrin.h>
+#define STATICLIB_IO_BLAKE3_TARGET_AVX2 __attribute__((target("avx2")))
+#endif // _MSC_VER
+#endif // x86_64
+
+namespace staticlib {
+namespace io {
+
+namespace detail_blake3 {
+
+const size_t chunk_len = 1024;
+const size_t block_len = 64;
+// chunks in a subtree hashed by a single worker job, 1 MiB
+const size_t job_chunks = 1024;
+const size_t max_depth = 54;
+
+const uint32_t flag_chunk_start = 1;
+const uint32_t flag_chunk_end = 2;
+const uint32_t flag_parent = 4;
+const uint32_t flag_root = 8;
+
+inline const uint32_t* iv() {
+    static const uint32_t arr[] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    return arr;
+}
+
+// message words order for each of 7 rounds
+inline const uint8_t* msg_schedule(size_t round) {
+    static const uint8_t arr[7][16] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+        {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+        {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+        {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+        {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+        {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13}
+    };
+    return arr[round];
+}
+
+inline uint32_t rotr(uint32_t x, unsigned n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+inline void g(uint32_t* v, size_t a, size_t b, size_t c, size_t d, uint32_t mx, uint32_t my) {
+    v[a] = v[a] + v[b] + mx;
+    v[d] = rotr(v[d] ^ v[a], 16);
+    v[c] = v[c] + v[d];
+    v[b] = rotr(v[b] ^ v[c], 12);
+    v[a] = v[a] + v[b] + my;
+    v[d] = rotr(v[d] ^ v[a], 8);
+    v[c] = v[c] + v[d];
+    v[b] = rotr(v[b] ^ v[c], 7);
+}
+
+inline void load_words(const unsigned char* block, uint32_t* words) {
+    for (size_t i = 0; i < 16; i++) {
+        const unsigned char* p = block + i * 4;
+        words[i] = static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+                (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+}
+
+// full 16 words output, first 8 words are the chaining value
+inline void compress(const uint32_t* cv, const uint32_t* words, uint64_t counter,
+        uint32_t len, uint32_t flags, uint32_t* out) {
+    uint32_t v[16] = {
+        cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+        iv()[0], iv()[1], iv()[2], iv()[3],
+        static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), len, flags
+    };
+    for (size_t r = 0; r < 7; r++) {
+        const uint8_t* s = msg_schedule(r);
+        g(v, 0, 4, 8, 12, words[s[0]], words[s[1]]);
+        g(v, 1, 5, 9, 13, words[s[2]], words[s[3]]);
+        g(v, 2, 6, 10, 14, words[s[4]], words[s[5]]);
+        g(v, 3, 7, 11, 15, words[s[6]], words[s[7]]);
+        g(v, 0, 5, 10, 15, words[s[8]], words[s[9]]);
+        g(v, 1, 6, 11, 12, words[s[10]], words[s[11]]);
+        g(v, 2, 7, 8, 13, words[s[12]], words[s[13]]);
+        g(v, 3, 4, 9, 14, words[s[14]], words[s[15]]);
+    }
+    for (size_t i = 0; i < 8; i++) {
+        out[i] = v[i] ^ v[i + 8];
+        out[i + 8] = v[i + 8] ^ cv[i];
+    }
+}
+
+inline void parent_cv(const uint32_t* left, const uint32_t* right, uint32_t* out) {
+    uint32_t words[16];
+    std::memcpy(words, left, 32);
+    std::memcpy(words + 8, right, 32);
+    uint32_t full[16];
+    compress(iv(), words, 0, block_len, flag_parent, full);
+    std::memcpy(out, full, 32);
+}
+
+// chaining value of a full chunk that is not the root
+inline void chunk_cv_portable(const unsigned char* data, uint64_t counter, uint32_t* out) {
+    uint32_t cv[8];
+    std::memcpy(cv, iv(), 32);
+    uint32_t words[16];
+    uint32_t full[16];
+    for (size_t b = 0; b < chunk_len / block_len; b++) {
+        uint32_t flags = (0 == b ? flag_chunk_start : 0) | (chunk_len / block_len - 1 == b ? flag_chunk_end : 0);
+        load_words(data + b * block_len, words);
+        compress(cv, words, counter, block_len, flags, full);
+        std::memcpy(cv, full, 32);
+    }
+    std::memcpy(out, cv, 32);
+}
+
+#ifdef STATICLIB_IO_BLAKE3_AVX2
+
+inline bool detect_avx2() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    if (0 == (info[2] & (1 << 27)) || 0 == (info[2] & (1 << 28)) || 6 != (_xgetbv(0) & 6)) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return 0 != (info[1] & (1 << 5));
+#else // !_MSC_VER
+    unsigned a = 0, b = 0, c = 0, d = 0;
+    if (!__get_cpuid(1, &a, &b, &c, &d) || 0 == (c & (1u << 27)) || 0 == (c & (1u << 28))) {
+        return false;
+    }
+    unsigned xcr_lo = 0, xcr_hi = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr_lo), "=d"(xcr_hi) : "c"(0));
+    if (6 != (xcr_lo & 6) || !__get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+        return false;
+    }
+    return 0 != (b & (1u << 5));
+#endif // _MSC_VER
+}
+
+inline bool has_avx2() {
+    static const bool res = detect_avx2();
+    return res;
+}
+
+STATICLIB_IO_BLAKE3_TARGET_AVX2
+inline __m256i rotr8x(__m256i x, int n) {
+    return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+// rotations by whole bytes are done with a single shuffle
+STATICLIB_IO_BLAKE3_TARGET_AVX2
+inline __m256i rotr16_8x(__m256i x) {
+    return _mm256_shuffle_epi8(x, _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+            13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2));
+}
+
+STATICLIB_IO_BLAKE3_TARGET_AVX2
+inline __m256i rotr8_8x(__m256i x) {
+    return _mm256_shuffle_epi8(x, _mm256_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1,
+            12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1));
+}
+
+STATICLIB_IO_BLAKE3_TARGET_AVX2
+inline void g8x(__m256i* v, size_t a, size_t b, size_t c, size_t d, __m256i mx, __m256i my) {
+    v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), mx);
+    v[d] = rotr16_8x(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi32(v[c], v[d]);
+    v[b] = rotr8x(_mm256_xor_si256(v[b], v[c]), 12);
+    v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), my);
+    v[d] = rotr8_8x(_mm256_xor_si256(v[d], v[a]));
+    v[c] = _mm256_add_epi32(v[c], v[d]);
+    v[b] = rotr8x(_mm256_xor_si256(v[b], v[c]), 7);
+}
+
+// rows become columns
+STATICLIB_IO_BLAKE3_TARGET_AVX2
+inline void transpose8x(__m256i* v) {
+    __m256i ab_lo = _mm256_unpacklo_epi32(v[0], v[1]);
+    __m256i ab_hi = _mm256_unpackhi_epi32(v[0], v[1]);
+    __m256i cd_lo = _mm256_unpacklo_epi32(v[2], v[3]);
+    __m256i cd_hi = _mm256_unpackhi_epi32(v[2], v[3]);
+    __m256i ef_lo = _mm256_unpacklo_epi32(v[4], v[5]);
+    __m256i ef_hi = _mm256_unpackhi_epi32(v[4], v[5]);
+    __m256i gh_lo = _mm256_unpacklo_epi32(v[6], v[7]);
+    __m256i gh_hi = _mm256_unpackhi_epi32(v[6], v[7]);
+    __m256i abcd_04 = _mm256_unpacklo_epi64(ab_lo, cd_lo);
+    __m256i abcd_15 = _mm256_unpackhi_epi64(ab_lo, cd_lo);
+    __m256i abcd_26 = _mm256_unpacklo_epi64(ab_hi, cd_hi);
+    __m256i abcd_37 = _mm256_unpackhi_epi64(ab_hi, cd_hi);
+    __m256i efgh_04 = _mm256_unpacklo_epi64(ef_lo, gh_lo);
+    __m256i efgh_15 = _mm256_unpackhi_epi64(ef_lo, gh_lo);
+    __m256i efgh_26 = _mm256_unpacklo_epi64(ef_hi, gh_hi);
+    __m256i efgh_37 = _mm256_unpackhi_epi64(ef_hi, gh_hi);
+    v[0] = _mm256_permute2x128_si256(abcd_04, efgh_04, 0x20);
+    v[1] = _mm256_permute2x128_si256(abcd_15, efgh_15, 0x20);
+    v[2] = _mm256_permute2x128_si256(abcd_26, efgh_26, 0x20);
+    v[3] = _mm256_permute2x128_si256(abcd_37, efgh_37, 0x20);
+    v[4] = _mm256_permute2x128_si256(abcd_04, efgh_04, 0x31);
+    v[5] = _mm256_permute2x128_si256(abcd_15, efgh_15, 0x31);
+    v[6] = _mm256_permute2x128_si256(abcd_26, efgh_26, 0x31);
+    v[7] = _mm256_permute2x128_si256(abcd_37, efgh_37, 0x31);
+}
+
+// chaining values of 8 consecutive full chunks, one chunk in each lane
+STATICLIB_IO_BLAKE3_TARGET_AVX2
+inline void chunk_cv_8x(const unsigned char* data, uint64_t counter, uint32_t* out) {
+    __m256i h[8];
+    for (size_t i = 0; i < 8; i++) {
+        h[i] = _mm256_set1_epi32(static_cast<int>(iv()[i]));
+    }
+    uint32_t ctr_lo[8];
+    uint32_t ctr_hi[8];
+    for (size_t j = 0; j < 8; j++) {
+        ctr_lo[j] = static_cast<uint32_t>(counter + j);
+        ctr_hi[j] = static_cast<uint32_t>((counter + j) >> 32);
+    }
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctr_lo));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctr_hi));
+    for (size_t b = 0; b < chunk_len / block_len; b++) {
+        __m256i m[16];
+        for (size_t j = 0; j < 8; j++) {
+            const unsigned char* block = data + j * chunk_len + b * block_len;
+            m[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+            m[j + 8] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+        }
+        transpose8x(m);
+        transpose8x(m + 8);
+        uint32_t flags = (0 == b ? flag_chunk_start : 0) | (chunk_len / block_len - 1 == b ? flag_chunk_end : 0);
+        __m256i v[16] = {
+            h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7],
+            _mm256_set1_epi32(static_cast<int>(iv()[0])), _mm256_set1_epi32(static_cast<int>(iv()[1])),
+            _mm256_set1_epi32(static_cast<int>(iv()[2])), _mm256_set1_epi32(static_cast<int>(iv()[3])),
+            lo, hi, _mm256_set1_epi32(static_cast<int>(block_len)), _mm256_set1_epi32(static_cast<int>(flags))
+        };
+        for (size_t r = 0; r < 7; r++) {
+            g8x(v, 0, 4, 8, 12, m[0], m[1]);
+            g8x(v, 1, 5, 9, 13, m[2], m[3]);
+            g8x(v, 2, 6, 10, 14, m[4], m[5]);
+            g8x(v, 3, 7, 11, 15, m[6], m[7]);
+            g8x(v, 0, 5, 10, 15, m[8], m[9]);
+            g8x(v, 1, 6, 11, 12, m[10], m[11]);
+            g8x(v, 2, 7, 8, 13, m[12], m[13]);
+            g8x(v, 3, 4, 9, 14, m[14], m[15]);
+            // constant indices let the words stay in registers
+            __m256i p[16] = {
+                m[2], m[6], m[3], m[10], m[7], m[0], m[4], m[13],
+                m[1], m[11], m[12], m[5], m[9], m[14], m[15], m[8]
+            };
+            std::memcpy(m, p, sizeof(m));
+        }
+        for (size_t i = 0; i < 8; i++) {
+            h[i] = _mm256_xor_si256(v[i], v[i + 8]);
+        }
+    }
+    transpose8x(h);
+    for (size_t j = 0; j < 8; j++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j * 8), h[j]);
+    }
+}
+
+#endif // STATICLIB_IO_BLAKE3_AVX2
+
+// chaining values of consecutive full chunks, none of them can be the root
+inline void chunk_cvs(const unsigned char* data, size_t count, uint64_t counter, uint32_t* out) {
+#ifdef STATICLIB_IO_BLAKE3_AVX2
+    if (has_avx2()) {
+        for (; count >= 8; count -= 8, data += 8 * chunk_len, counter += 8, out += 64) {
+            chunk_cv_8x(data, counter, out);
+        }
+    }
+#endif // STATICLIB_IO_BLAKE3_AVX2
+    for (; count > 0; count--, data += chunk_len, counter++, out += 8) {
+        chunk_cv_portable(data, counter, out);
+    }
+}
+
+// chaining value of a complete subtree of "count" chunks, count must be a power of two
+inline void subtree_cv(const unsigned char* data, size_t count, uint64_t counter,
+        std::vector<uint32_t>& cvs, uint32_t* out) {
+    cvs.resize(count * 8);
+    chunk_cvs(data, count, counter, cvs.data());
+    for (; count > 1; count /= 2) {
+        for (size_t i = 0; i < count / 2; i++) {
+            parent_cv(cvs.data() + i * 16, cvs.data() + i * 16 + 8, cvs.data() + i * 8);
+        }
+    }
+    std::memcpy(out, cvs.data(), 32);
+}
+
+/**
+ * Worker context, input block starts with the 8 bytes
+ * chunk counter followed by subtree data
+ */
+class subtree_context {
+    std::vector<uint32_t> cvs;
+
+public:
+    void process(const std::vector<char>& input, bool, std::vector<char>& output) {
+        uint64_t counter = 0;
+        std::memcpy(std::addressof(counter), input.data(), 8);
+        const unsigned char* data = reinterpret_cast<const unsigned char*>(input.data()) + 8;
+        output.resize(32);
+        uint32_t cv[8];
+        subtree_cv(data, (input.size() - 8) / chunk_len, counter, cvs, cv);
+        std::memcpy(output.data(), cv, 32);
+    }
+};
+
+/**
+ * State of the current (last) chunk, that may become the root
+ */
+class chunk_state {
+    uint32_t cv[8];
+    uint64_t counter = 0;
+    unsigned char block[64];
+    size_t block_fill = 0;
+    size_t blocks_compressed = 0;
+
+public:
+    chunk_state() {
+        reset(0);
+    }
+
+    void reset(uint64_t chunk_counter) {
+        std::memcpy(cv, iv(), 32);
+        counter = chunk_counter;
+        block_fill = 0;
+        blocks_compressed = 0;
+    }
+
+    uint64_t get_counter() const {
+        return counter;
+    }
+
+    void update(const unsigned char* data, size_t len) {
+        while (len > 0) {
+            if (block_len == block_fill) {
+                uint32_t words[16];
+                uint32_t full[16];
+                load_words(block, words);
+                compress(cv, words, counter, block_len, start_flag(), full);
+                std::memcpy(cv, full, 32);
+                blocks_compressed += 1;
+                block_fill = 0;
+            }
+            size_t take = len < block_len - block_fill ? len : block_len - block_fill;
+            std::memcpy(block + block_fill, data, take);
+            block_fill += take;
+            data += take;
+            len -= take;
+        }
+    }
+
+    // compression input of the last block, used both for CV and for root output
+    void output(uint32_t* input_cv, uint32_t* words, uint32_t& len, uint32_t& flags) {
+        std::memcpy(input_cv, cv, 32);
+        std::memset(block + block_fill, 0, block_len - block_fill);
+        load_words(block, words);
+        len = static_cast<uint32_t>(block_fill);
+        flags = start_flag() | flag_chunk_end;
+    }
+
+private:
+    uint32_t start_flag() const {
+        return 0 == blocks_compressed ? flag_chunk_start : 0;
+    }
+};
+
+} // namespace
+
+/**
+ * BLAKE3 digest computation (32 bytes output, hash mode), uses AVX2
+ * to hash 8 chunks at once when it is available. Optionally, large
+ * inputs can be hashed as a tree of 1 MiB subtrees by a pool of worker
+ * threads. Can be used with "digest_sink" and "digest_source".
+ */
+class blake3 {
+    typedef detail_block_workers::ordered_workers<detail_blake3::subtree_context> workers_type;
+
+    uint32_t cv_stack[detail_blake3::max_depth * 8];
+    size_t stack_len = 0;
+    uint64_t chunks_done = 0;
+    std::vector<unsigned char> tail;
+    std::vector<uint32_t> cvs;
+    detail_blake3::chunk_state chunk;
+    size_t workers_count = 0;
+    std::unique_ptr<workers_type> workers;
+    size_t job_fill = 0;
+    uint64_t jobs_submitted = 0;
+    uint64_t jobs_done = 0;
+    bool finished = false;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param workers number of threads to hash large inputs with,
+     *        zero (default) to hash all data in the calling thread
+     */
+    explicit blake3(size_t workers = 0) :
+    workers_count(workers) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    blake3(const blake3&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    blake3& operator=(const blake3&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    blake3(blake3&& other) STATICLIB_NOEXCEPT :
+    stack_len(other.stack_len),
+    chunks_done(other.chunks_done),
+    tail(std::move(other.tail)),
+    cvs(std::move(other.cvs)),
+    chunk(other.chunk),
+    workers_count(other.workers_count),
+    workers(std::move(other.workers)),
+    job_fill(other.job_fill),
+    jobs_submitted(other.jobs_submitted),
+    jobs_done(other.jobs_done),
+    finished(other.finished) {
+        std::memcpy(cv_stack, other.cv_stack, stack_len * 32);
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    blake3& operator=(blake3&& other) STATICLIB_NOEXCEPT {
+        stack_len = other.stack_len;
+        std::memcpy(cv_stack, other.cv_stack, stack_len * 32);
+        chunks_done = other.chunks_done;
+        tail = std::move(other.tail);
+        cvs = std::move(other.cvs);
+        chunk = other.chunk;
+        workers_count = other.workers_count;
+        workers = std::move(other.workers);
+        job_fill = other.job_fill;
+        jobs_submitted = other.jobs_submitted;
+        jobs_done = other.jobs_done;
+        finished = other.finished;
+        return *this;
+    }
+
+    /**
+     * Resets the state to start a new digest computation
+     */
+    void reset() {
+        if (jobs_submitted > jobs_done) {
+            workers->drain([](span<const char>) { });
+        }
+        stack_len = 0;
+        chunks_done = 0;
+        tail.clear();
+        chunk.reset(0);
+        job_fill = 0;
+        jobs_submitted = 0;
+        jobs_done = 0;
+        finished = false;
+    }
+
+    /**
+     * Adds data to digest computation
+     * 
+     * @param data input data
+     * @throws io_exception if the digest was already computed
+     */
+    void update(span<const char> data) {
+        if (finished) throw io_exception(TRACEMSG("Invalid update after the digest was computed"));
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(data.data());
+        if (workers_count > 0) {
+            update_jobs(src, data.size());
+        } else {
+            update_batches(src, data.size());
+        }
+    }
+
+    /**
+     * Completes digest computation, "reset" must be called
+     * before computing the next digest
+     * 
+     * @return digest bytes
+     */
+    std::string digest() {
+        if (!finished) {
+            finished = true;
+            if (workers_count > 0) {
+                finish_jobs();
+            }
+            finish_tail();
+        }
+        uint32_t input_cv[8];
+        uint32_t words[16];
+        uint32_t len = 0;
+        uint32_t flags = 0;
+        chunk.output(input_cv, words, len, flags);
+        uint64_t counter = chunk.get_counter();
+        for (size_t i = stack_len; i > 0; i--) {
+            uint32_t full[16];
+            detail_blake3::compress(input_cv, words, counter, len, flags, full);
+            std::memcpy(words, cv_stack + (i - 1) * 8, 32);
+            std::memcpy(words + 8, full, 32);
+            std::memcpy(input_cv, detail_blake3::iv(), 32);
+            counter = 0;
+            len = detail_blake3::block_len;
+            flags = detail_blake3::flag_parent;
+        }
+        uint32_t out[16];
+        detail_blake3::compress(input_cv, words, counter, len, flags | detail_blake3::flag_root, out);
+        std::string res;
+        res.reserve(32);
+        for (size_t i = 0; i < 8; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                res.push_back(static_cast<char>((out[i] >> (j * 8)) & 0xff));
+            }
+        }
+        return res;
+    }
+
+private:
+    // merges completed subtrees, "total" is a number of subtrees of the pushed size
+    void push_cv(const uint32_t* cv, uint64_t total) {
+        uint32_t merged[8];
+        std::memcpy(merged, cv, 32);
+        while (0 == (total & 1)) {
+            stack_len -= 1;
+            detail_blake3::parent_cv(cv_stack + stack_len * 8, merged, merged);
+            total >>= 1;
+        }
+        std::memcpy(cv_stack + stack_len * 8, merged, 32);
+        stack_len += 1;
+    }
+
+    // full chunks followed by more data cannot be the root
+    void hash_chunks(const unsigned char* data, size_t count) {
+        cvs.resize(count * 8);
+        detail_blake3::chunk_cvs(data, count, chunks_done, cvs.data());
+        for (size_t i = 0; i < count; i++) {
+            chunks_done += 1;
+            push_cv(cvs.data() + i * 8, chunks_done);
+        }
+    }
+
+    // data is hashed in batches of 8 chunks, last (possibly full) batch is kept in tail
+    void update_batches(const unsigned char* src, size_t len) {
+        const size_t batch_len = 8 * detail_blake3::chunk_len;
+        while (len > 0) {
+            if (batch_len == tail.size()) {
+                hash_chunks(tail.data(), 8);
+                tail.clear();
+            }
+            if (tail.empty() && len > batch_len) {
+                size_t count = (len - 1) / batch_len * 8;
+                if (count > 64) {
+                    count = 64;
+                }
+                hash_chunks(src, count);
+                src += count * detail_blake3::chunk_len;
+                len -= count * detail_blake3::chunk_len;
+                continue;
+            }
+            size_t take = batch_len - tail.size();
+            if (take > len) {
+                take = len;
+            }
+            tail.insert(tail.end(), src, src + take);
+            src += take;
+            len -= take;
+        }
+    }
+
+    void finish_tail() {
+        size_t count = tail.empty() ? 0 : (tail.size() - 1) / detail_blake3::chunk_len;
+        hash_chunks(tail.data(), count);
+        chunk.reset(chunks_done);
+        size_t offset = count * detail_blake3::chunk_len;
+        chunk.update(tail.data() + offset, tail.size() - offset);
+    }
+
+    void update_jobs(const unsigned char* src, size_t len) {
+        const size_t job_len = detail_blake3::job_chunks * detail_blake3::chunk_len;
+        if (nullptr == workers.get()) {
+            std::vector<detail_blake3::subtree_context> contexts;
+            contexts.resize(workers_count);
+            workers.reset(new workers_type(std::move(contexts), workers_count * 2));
+        }
+        while (len > 0) {
+            // full job followed by more data cannot be the root
+            if (job_len == job_fill) {
+                workers->submit(false, [this](span<const char> cv) {
+                    this->push_job_cv(cv);
+                });
+                jobs_submitted += 1;
+                job_fill = 0;
+            }
+            std::vector<char>& buf = workers->next_input();
+            if (0 == job_fill) {
+                uint64_t counter = jobs_submitted * detail_blake3::job_chunks;
+                buf.resize(8 + job_len);
+                std::memcpy(buf.data(), std::addressof(counter), 8);
+            }
+            size_t take = job_len - job_fill;
+            if (take > len) {
+                take = len;
+            }
+            std::memcpy(buf.data() + 8 + job_fill, src, take);
+            job_fill += take;
+            src += take;
+            len -= take;
+        }
+    }
+
+    void push_job_cv(span<const char> cv) {
+        uint32_t words[8];
+        std::memcpy(words, cv.data(), 32);
+        jobs_done += 1;
+        push_cv(words, jobs_done);
+    }
+
+    void finish_jobs() {
+        if (nullptr == workers.get()) {
+            return;
+        }
+        workers->drain([this](span<const char> cv) {
+            this->push_job_cv(cv);
+        });
+        // remaining data is hashed inline
+        chunks_done = jobs_submitted * detail_blake3::job_chunks;
+        const unsigned char* data = reinterpret_cast<const unsigned char*>(workers->next_input().data()) + 8;
+        update_batches(data, job_fill);
+    }
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_BLAKE3_HPP */
@@ -0,0 +1,252 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   block_workers.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:25 PM
+ */
+
+#ifndef STATICLIB_IO_BLOCK_WORKERS_HPP
+#define STATICLIB_IO_BLOCK_WORKERS_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_block_workers {
+
+/**
+ * Pool of threads that process blocks of data concurrently,
+ * processed blocks are returned in the same order as they were
+ * submitted. Number of blocks in flight is bounded, block buffers
+ * are reused. Each thread owns its processing context, that must
+ * implement "process(const std::vector<char>& input, bool last, std::vector<char>& output)".
+ * Blocks are submitted and collected from the single producer thread.
+ */
+template<typename Context>
+class ordered_workers {
+    enum class slot_state {
+        free, queued, running, done
+    };
+
+    struct slot {
+        std::vector<char> input;
+        std::vector<char> output;
+        bool last = false;
+        slot_state state = slot_state::free;
+        std::exception_ptr error;
+    };
+
+    std::vector<slot> slots;
+    size_t submit_idx = 0;
+    size_t collect_idx = 0;
+    size_t take_idx = 0;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+    std::vector<Context> contexts;
+    std::vector<std::thread> threads;
+
+public:
+    /**
+     * Constructor, starts one thread for each of the specified contexts
+     * 
+     * @param contexts processing contexts
+     * @param max_in_flight max number of blocks submitted and not yet collected
+     */
+    ordered_workers(std::vector<Context> contexts, size_t max_in_flight) :
+    slots(max_in_flight > contexts.size() ? max_in_flight : contexts.size() + 1),
+    contexts(std::move(contexts)) {
+        try {
+            for (size_t i = 0; i < this->contexts.size(); i++) {
+                threads.emplace_back(&ordered_workers::run, this, i);
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    /**
+     * Destructor, stops all threads, blocks that are not collected are discarded
+     */
+    ~ordered_workers() STATICLIB_NOEXCEPT {
+        stop();
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    ordered_workers(const ordered_workers&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    ordered_workers& operator=(const ordered_workers&) = delete;
+
+    /**
+     * Input buffer of the next block to submit,
+     * its contents are kept from the previous use of this buffer
+     * 
+     * @return input buffer
+     */
+    std::vector<char>& next_input() {
+        return slots[submit_idx].input;
+    }
+
+    /**
+     * Submits the block filled through "next_input" for processing,
+     * writes processed blocks that are ready, waits for the oldest
+     * block if no free buffers are left
+     * 
+     * @param last whether it is the last block of the stream
+     * @param write_out function that receives processed blocks in order
+     */
+    template<typename Writer>
+    void submit(bool last, Writer write_out) {
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+            slot& sl = slots[submit_idx];
+            sl.last = last;
+            sl.state = slot_state::queued;
+            submit_idx = (submit_idx + 1) % slots.size();
+        }
+        work_cv.notify_one();
+        collect(false, write_out);
+        if (!is_free(submit_idx)) {
+            collect(true, write_out);
+        }
+    }
+
+    /**
+     * Waits for all submitted blocks and writes them out in order
+     * 
+     * @param write_out function that receives processed blocks in order
+     */
+    template<typename Writer>
+    void drain(Writer write_out) {
+        while (collect_idx != submit_idx || !is_free(collect_idx)) {
+            collect(true, write_out);
+        }
+    }
+
+private:
+    bool is_free(size_t idx) {
+        std::lock_guard<std::mutex> guard{mutex};
+        return slot_state::free == slots[idx].state;
+    }
+
+    // writes out ready blocks, waits for the oldest one if requested
+    template<typename Writer>
+    void collect(bool wait, Writer& write_out) {
+        for (;;) {
+            slot* sl = nullptr;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                slot& oldest = slots[collect_idx];
+                if (slot_state::free == oldest.state) {
+                    return;
+                }
+                if (wait) {
+                    done_cv.wait(lock, [&oldest] {
+                        return slot_state::done == oldest.state;
+                    });
+                } else if (slot_state::done != oldest.state) {
+                    return;
+                }
+                sl = std::addressof(oldest);
+                // freed slot is not touched by workers until it is submitted again
+                sl->state = slot_state::free;
+            }
+            collect_idx = (collect_idx + 1) % slots.size();
+            if (sl->error) {
+                std::exception_ptr error = sl->error;
+                sl->error = std::exception_ptr();
+                std::rethrow_exception(error);
+            }
+            write_out(span<const char>(sl->output.data(), sl->output.size()));
+            wait = false;
+        }
+    }
+
+    void run(size_t idx) {
+        Context& ctx = contexts[idx];
+        for (;;) {
+            slot* sl = nullptr;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                work_cv.wait(lock, [this] {
+                    return stopping || slot_state::queued == slots[take_idx].state;
+                });
+                if (stopping) {
+                    return;
+                }
+                sl = std::addressof(slots[take_idx]);
+                sl->state = slot_state::running;
+                take_idx = (take_idx + 1) % slots.size();
+            }
+            try {
+                sl->output.clear();
+                ctx.process(sl->input, sl->last, sl->output);
+            } catch (...) {
+                sl->error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> guard{mutex};
+                sl->state = slot_state::done;
+            }
+            done_cv.notify_all();
+        }
+    }
+
+    void stop() STATICLIB_NOEXCEPT {
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+            stopping = true;
+        }
+        work_cv.notify_all();
+        for (auto& th : threads) {
+            if (th.joinable()) {
+                th.join();
+            }
+        }
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_BLOCK_WORKERS_HPP */
@@ -160,6 +160,43 @@ public:
         return span.size_signed();
     }
 
+    /**
+     * Lends the free part of the internal buffer, so data can be written
+     * into it directly, buffered data is written to the destination sink
+     * if there is not enough free space.
+     * Written data becomes a part of the buffer after "commit" call.
+     * 
+     * @param min min number of bytes required
+     * @return span over the free part of the buffer, at least "min" bytes long
+     * @throws io_exception if "min" exceeds buffer size
+     */
+    span<char> prepare(size_t min) {
+        if (min > buffer.size()) throw io_exception(TRACEMSG(
+                "Prepare size: [" + sl::support::to_string(min) + "]" +
+                " exceeds buffer size: [" + sl::support::to_string(buffer.size()) + "]"));
+        if (avail < min) {
+            write_to_sink(buffer.data(), pos);
+            pos = 0;
+            avail = buffer.size();
+        }
+        return span<char>(buffer.data() + pos, avail);
+    }
+
+    /**
+     * Appends specified number of bytes, written into the span returned
+     * from the last "prepare" call, to the buffered data
+     * 
+     * @param count number of bytes written
+     * @throws io_exception if count exceeds prepared size
+     */
+    void commit(size_t count) {
+        if (count > avail) throw io_exception(TRACEMSG(
+                "Commit size: [" + sl::support::to_string(count) + "]" +
+                " exceeds prepared size: [" + sl::support::to_string(avail) + "]"));
+        pos += count;
+        avail -= count;
+    }
+
     /**
      * Flushes the buffer to the destination sink
      * 
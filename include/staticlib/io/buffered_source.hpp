@@ -176,6 +176,42 @@ public:
         return head == 0 ? std::char_traits<char>::eof() : head;
     }
 
+    /**
+     * Lends up to specified number of bytes directly from the internal
+     * buffer without copying them, buffer is refilled from the underlying
+     * source if it is empty. Lent data stays valid until the next
+     * operation on this source.
+     * 
+     * @param max max number of bytes to lend, must be positive
+     * @return span over the lent data, empty span if source is exhausted
+     */
+    span<const char> borrow_read(size_t max) {
+        if (0 == avail) {
+            pos = 0;
+            avail = read_into_buffer(buffer.data(), 0, buffer.size());
+        }
+        size_t len = max <= avail ? max : avail;
+        const char* ptr = buffer.data() + pos;
+        pos += len;
+        avail -= len;
+        return span<const char>(ptr, len);
+    }
+
+    /**
+     * Drops up to specified number of bytes from the internal buffer,
+     * when buffer is empty the remaining data can be skipped
+     * directly in the underlying source
+     * 
+     * @param count number of bytes to drop
+     * @return number of bytes dropped
+     */
+    size_t consume(size_t count) {
+        size_t len = count <= avail ? count : avail;
+        pos += len;
+        avail -= len;
+        return len;
+    }
+
     /**
      * Reads underlying source until specified line ending is met
      * or length threshold exceeded. Lines consisting solely of
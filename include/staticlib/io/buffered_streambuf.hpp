@@ -0,0 +1,708 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   buffered_streambuf.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:40 PM
+ */
+
+#ifndef STATICLIB_IO_BUFFERED_STREAMBUF_HPP
+#define STATICLIB_IO_BUFFERED_STREAMBUF_HPP
+
+#include <cstring>
+#include <ios>
+#include <memory>
+#include <streambuf>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/traits.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Buffered implementation of input streambuf, wraps Source and can be used
+ * with "std::istream" (formatted input, "getline" etc).
+ * Data is read from the source into the get area, if source implements
+ * "borrow_read", then get area points to the data lent by source and
+ * no own buffer is allocated. Underlying source is read ahead
+ * up to the buffer size.
+ * Seek operations are forwarded to seekable sources, for forward-only
+ * sources current position is reported as a number of bytes read
+ * and only forward seeks (performed by reading) are supported.
+ */
+template <typename Source>
+class buffered_istreambuf : public std::streambuf {
+    /**
+     * Input source
+     */
+    Source source;
+    /**
+     * Get area storage, not used if source lends its data
+     */
+    std::vector<char> buffer;
+    /**
+     * Max number of bytes to read from source at once
+     */
+    size_t buffer_size;
+    /**
+     * Whether source returned EOF
+     */
+    bool exhausted = false;
+    /**
+     * Position of the source, corresponds to the end of the get area
+     */
+    size_t position;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param source input source
+     * @param buffer_size max number of bytes to read from source at once
+     */
+    explicit buffered_istreambuf(Source&& source, size_t buffer_size = 4096) :
+    source(std::move(source)),
+    buffer_size(buffer_size > 0 ? buffer_size : 1),
+    position(initial_position(std::integral_constant<bool, has_seek<Source>::value>())) {
+        if (!has_borrow_read<Source>::value) {
+            buffer.resize(this->buffer_size);
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     */
+    buffered_istreambuf(const buffered_istreambuf&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    buffered_istreambuf& operator=(const buffered_istreambuf&) = delete;
+
+    /**
+     * Move constructor, get area pointers remain valid
+     * as moved buffer keeps its storage, unread data lent by
+     * the source is copied into own buffer, as it may point
+     * into the storage of moved-from source
+     */
+    buffered_istreambuf(buffered_istreambuf&& other) :
+    std::streambuf(other),
+    source(std::move(other.copy_lent_data().source)),
+    buffer(std::move(other.buffer)),
+    buffer_size(other.buffer_size),
+    exhausted(other.exhausted),
+    position(other.position) {
+        setg(other.eback(), other.gptr(), other.egptr());
+        other.setg(nullptr, nullptr, nullptr);
+        other.exhausted = true;
+    }
+
+    /**
+     * Deleted move assignment operator
+     */
+    buffered_istreambuf& operator=(buffered_istreambuf&&) = delete;
+
+    /**
+     * Underlying source accessor, source may be read ahead
+     * of the position of this streambuf
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return source;
+    }
+
+protected:
+    /**
+     * Refills the get area from source
+     * 
+     * @return first available character or EOF
+     */
+    virtual int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        if (exhausted || !fill(std::integral_constant<bool, has_borrow_read<Source>::value>())) {
+            exhausted = true;
+            return traits_type::eof();
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+
+    /**
+     * Reports EOF if source is exhausted, number of bytes
+     * in the get area is reported by "in_avail" itself
+     * 
+     * @return -1 if source is exhausted, 0 otherwise
+     */
+    virtual std::streamsize showmanyc() override {
+        return exhausted ? -1 : 0;
+    }
+
+    /**
+     * Reads count characters copying them from the get area, large reads
+     * are performed directly from source into destination buffer
+     * 
+     * @param s destination buffer
+     * @param count number of characters to read
+     * @return number of characters read, less than count only on EOF
+     */
+    virtual std::streamsize xsgetn(char* s, std::streamsize count) override {
+        std::streamsize res = 0;
+        while (res < count) {
+            std::streamsize avail = egptr() - gptr();
+            if (avail > 0) {
+                std::streamsize len = count - res < avail ? count - res : avail;
+                std::memcpy(s + res, gptr(), static_cast<size_t>(len));
+                gbump(static_cast<int>(len));
+                res += len;
+            } else if (!has_borrow_read<Source>::value && !exhausted &&
+                    static_cast<size_t>(count - res) >= buffer_size) {
+                // consumed get area no longer ends at the source position
+                setg(nullptr, nullptr, nullptr);
+                std::streamsize read = source.read({s + res, count - res});
+                if (std::char_traits<char>::eof() == read) {
+                    exhausted = true;
+                } else {
+                    res += read;
+                    position += static_cast<size_t>(read);
+                }
+            } else if (traits_type::eq_int_type(underflow(), traits_type::eof())) {
+                break;
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Changes current position, seekable sources are positioned
+     * directly, for forward-only sources only the current position can be
+     * requested and forward seeks are performed by reading the data
+     * 
+     * @param off position offset
+     * @param dir base position for the offset
+     * @param which must include "std::ios_base::in"
+     * @return new position or -1 on error
+     */
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (0 == (which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        size_t current = position - static_cast<size_t>(egptr() - gptr());
+        if (std::ios_base::cur == dir && 0 == off) {
+            return pos_type(static_cast<off_type>(current));
+        }
+        return seek_impl(current, off, dir, std::integral_constant<bool, has_seek<Source>::value>());
+    }
+
+    /**
+     * Changes current position to the specified absolute position
+     * 
+     * @param pos absolute position
+     * @param which must include "std::ios_base::in"
+     * @return new position or -1 on error
+     */
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+private:
+    // must be called before the source is moved
+    buffered_istreambuf& copy_lent_data() {
+        if (has_borrow_read<Source>::value) {
+            buffer.assign(gptr(), egptr());
+            setg(buffer.data(), buffer.data(), buffer.data() + buffer.size());
+        }
+        return *this;
+    }
+
+    size_t initial_position(std::true_type) {
+        return static_cast<size_t>(source.tell());
+    }
+
+    size_t initial_position(std::false_type) {
+        return 0;
+    }
+
+    // position inside the current get area
+    bool seek_in_area(size_t target) {
+        size_t area_start = position - static_cast<size_t>(egptr() - eback());
+        if (target < area_start || target > position) {
+            return false;
+        }
+        setg(eback(), eback() + (target - area_start), egptr());
+        return true;
+    }
+
+    pos_type seek_impl(size_t current, off_type off, std::ios_base::seekdir dir, std::true_type) {
+        size_t size = static_cast<size_t>(source.size());
+        off_type base = std::ios_base::beg == dir ? 0 :
+                static_cast<off_type>(std::ios_base::cur == dir ? current : size);
+        off_type target = base + off;
+        if (target < 0 || static_cast<size_t>(target) > size) {
+            return pos_type(off_type(-1));
+        }
+        size_t utarget = static_cast<size_t>(target);
+        if (!seek_in_area(utarget)) {
+            setg(nullptr, nullptr, nullptr);
+            position = static_cast<size_t>(source.seek(static_cast<std::streamsize>(utarget), std::ios_base::beg));
+            exhausted = false;
+        }
+        return pos_type(target);
+    }
+
+    pos_type seek_impl(size_t current, off_type off, std::ios_base::seekdir dir, std::false_type) {
+        if (std::ios_base::end == dir) {
+            return pos_type(off_type(-1));
+        }
+        off_type target = (std::ios_base::cur == dir ? static_cast<off_type>(current) : 0) + off;
+        if (target < 0) {
+            return pos_type(off_type(-1));
+        }
+        size_t utarget = static_cast<size_t>(target);
+        while (!seek_in_area(utarget)) {
+            if (utarget < position) {
+                return pos_type(off_type(-1));
+            }
+            setg(nullptr, nullptr, nullptr);
+            if (exhausted || !fill(std::integral_constant<bool, has_borrow_read<Source>::value>())) {
+                exhausted = true;
+                return pos_type(off_type(-1));
+            }
+        }
+        return pos_type(target);
+    }
+
+    bool fill(std::true_type) {
+        span<const char> chunk = source.borrow_read(buffer_size);
+        if (0 == chunk.size()) {
+            return false;
+        }
+        // get area is never written to, default "pbackfail" does not store characters
+        char* data = const_cast<char*>(chunk.data());
+        setg(data, data, data + chunk.size());
+        position += chunk.size();
+        return true;
+    }
+
+    bool fill(std::false_type) {
+        std::streamsize read = 0;
+        while (0 == read) {
+            read = source.read(buffer);
+        }
+        if (std::char_traits<char>::eof() == read) {
+            return false;
+        }
+        setg(buffer.data(), buffer.data(), buffer.data() + read);
+        position += static_cast<size_t>(read);
+        return true;
+    }
+
+};
+
+/**
+ * Factory function for creating buffered_istreambuf sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param buffer_size max number of bytes to read from source at once
+ * @return buffered_istreambuf source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+buffered_istreambuf<Source> make_buffered_istreambuf(Source&& source, size_t buffer_size = 4096) {
+    return buffered_istreambuf<Source>(std::move(source), buffer_size);
+}
+
+/**
+ * Factory function for creating buffered_istreambuf sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param buffer_size max number of bytes to read from source at once
+ * @return buffered_istreambuf source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+std::unique_ptr<buffered_istreambuf<Source>> make_buffered_istreambuf_ptr(Source&& source,
+        size_t buffer_size = 4096) {
+    return std::unique_ptr<buffered_istreambuf<Source>>(
+            new buffered_istreambuf<Source>(std::move(source), buffer_size));
+}
+
+/**
+ * Factory function for creating buffered_istreambuf sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param buffer_size max number of bytes to read from source at once
+ * @return buffered_istreambuf source
+ */
+template <typename Source>
+buffered_istreambuf<reference_source<Source>> make_buffered_istreambuf(Source& source,
+        size_t buffer_size = 4096) {
+    return buffered_istreambuf<reference_source<Source>>(make_reference_source(source), buffer_size);
+}
+
+/**
+ * Factory function for creating buffered_istreambuf sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param buffer_size max number of bytes to read from source at once
+ * @return buffered_istreambuf source
+ */
+template <typename Source>
+std::unique_ptr<buffered_istreambuf<reference_source<Source>>> make_buffered_istreambuf_ptr(
+        Source& source, size_t buffer_size = 4096) {
+    return std::unique_ptr<buffered_istreambuf<reference_source<Source>>>(
+            new buffered_istreambuf<reference_source<Source>>(make_reference_source(source), buffer_size));
+}
+
+/**
+ * Buffered implementation of output streambuf, wraps Sink and can be used
+ * with "std::ostream". Data is collected in the put area and is written
+ * to sink on overflow, on "sync" (sink is also flushed) and on destruction.
+ * If sink implements "prepare" and "commit", then put area points to
+ * the buffer lent by sink and no own buffer is allocated.
+ * Seek operations are forwarded to seekable sinks, for other sinks
+ * current position is reported as a number of bytes written.
+ */
+template <typename Sink>
+class buffered_ostreambuf : public std::streambuf {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Put area storage, not used if sink lends its buffer
+     */
+    std::vector<char> buffer;
+    /**
+     * Position of the sink, corresponds to the start of the put area
+     */
+    size_t position;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param buffer_size put area size, not used if sink lends its buffer
+     */
+    explicit buffered_ostreambuf(Sink&& sink, size_t buffer_size = 4096) :
+    sink(std::move(sink)),
+    position(initial_position(std::integral_constant<bool, has_seek<Sink>::value>())) {
+        if (!has_prepare<Sink>::value) {
+            buffer.resize(buffer_size > 0 ? buffer_size : 1);
+            setp(buffer.data(), buffer.data() + buffer.size());
+        }
+    }
+
+    /**
+     * Destructor, writes pending data to sink,
+     * sink is not flushed
+     */
+    ~buffered_ostreambuf() STATICLIB_NOEXCEPT {
+        try {
+            drain(std::integral_constant<bool, has_prepare<Sink>::value>());
+        } catch(...) {
+            // ignore
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     */
+    buffered_ostreambuf(const buffered_ostreambuf&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     */
+    buffered_ostreambuf& operator=(const buffered_ostreambuf&) = delete;
+
+    /**
+     * Move constructor, put area pointers remain valid
+     * as moved buffer keeps its storage, data written into the buffer
+     * lent by the sink is committed before the sink is moved, as
+     * lent buffer may be stored inside the moved-from sink
+     */
+    buffered_ostreambuf(buffered_ostreambuf&& other) :
+    std::streambuf(other),
+    sink(std::move(other.commit_lent_data().sink)),
+    buffer(std::move(other.buffer)),
+    position(other.position) {
+        if (has_prepare<Sink>::value) {
+            // next "overflow" call prepares the buffer of this sink
+            setp(nullptr, nullptr);
+        }
+        other.setp(nullptr, nullptr);
+    }
+
+    /**
+     * Deleted move assignment operator
+     */
+    buffered_ostreambuf& operator=(buffered_ostreambuf&&) = delete;
+
+    /**
+     * Underlying sink accessor, data written to this streambuf
+     * reaches the sink only after "pubsync" call, sink must not
+     * be used directly while put area contains pending data
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+protected:
+    /**
+     * Writes the put area to sink and stores specified character
+     * 
+     * @param ch character to store
+     * @return character stored
+     */
+    virtual int_type overflow(int_type ch) override {
+        std::integral_constant<bool, has_prepare<Sink>::value> lending;
+        drain(lending);
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            reset(lending);
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    /**
+     * Writes count characters copying them into the put area, large writes
+     * are performed directly to sink bypassing the put area
+     * 
+     * @param s source buffer
+     * @param count number of characters to write
+     * @return number of characters written
+     */
+    virtual std::streamsize xsputn(const char* s, std::streamsize count) override {
+        std::integral_constant<bool, has_prepare<Sink>::value> lending;
+        std::streamsize res = 0;
+        while (res < count) {
+            std::streamsize avail = epptr() - pptr();
+            if (avail > 0) {
+                std::streamsize len = count - res < avail ? count - res : avail;
+                std::memcpy(pptr(), s + res, static_cast<size_t>(len));
+                pbump(static_cast<int>(len));
+                res += len;
+            } else if (!has_prepare<Sink>::value && 
+                    static_cast<size_t>(count - res) >= buffer.size()) {
+                drain(lending);
+                write_all(sink, {s + res, count - res});
+                position += static_cast<size_t>(count - res);
+                res = count;
+            } else {
+                drain(lending);
+                reset(lending);
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Writes the put area to sink and flushes the sink
+     * 
+     * @return zero
+     */
+    virtual int sync() override {
+        drain(std::integral_constant<bool, has_prepare<Sink>::value>());
+        sink.flush();
+        return 0;
+    }
+
+    /**
+     * Changes current position of seekable sink, pending data
+     * is written before that, for other sinks only the current
+     * position can be requested
+     * 
+     * @param off position offset
+     * @param dir base position for the offset
+     * @param which must include "std::ios_base::out"
+     * @return new position or -1 on error
+     */
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (0 == (which & std::ios_base::out)) {
+            return pos_type(off_type(-1));
+        }
+        size_t current = position + static_cast<size_t>(pptr() - pbase());
+        if (std::ios_base::cur == dir && 0 == off) {
+            return pos_type(static_cast<off_type>(current));
+        }
+        return seek_impl(current, off, dir, std::integral_constant<bool, has_seek<Sink>::value>());
+    }
+
+    /**
+     * Changes current position to the specified absolute position
+     * 
+     * @param pos absolute position
+     * @param which must include "std::ios_base::out"
+     * @return new position or -1 on error
+     */
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+private:
+    // must be called before the sink is moved
+    buffered_ostreambuf& commit_lent_data() {
+        commit_lent_data(std::integral_constant<bool, has_prepare<Sink>::value>());
+        return *this;
+    }
+
+    void commit_lent_data(std::true_type) {
+        drain(std::true_type());
+    }
+
+    void commit_lent_data(std::false_type) { }
+
+    size_t initial_position(std::true_type) {
+        return static_cast<size_t>(sink.tell());
+    }
+
+    size_t initial_position(std::false_type) {
+        return 0;
+    }
+
+    pos_type seek_impl(size_t current, off_type off, std::ios_base::seekdir dir, std::true_type) {
+        drain(std::integral_constant<bool, has_prepare<Sink>::value>());
+        size_t size = static_cast<size_t>(sink.size());
+        off_type base = std::ios_base::beg == dir ? 0 :
+                static_cast<off_type>(std::ios_base::cur == dir ? current : size);
+        off_type target = base + off;
+        if (target < 0 || static_cast<size_t>(target) > size) {
+            return pos_type(off_type(-1));
+        }
+        position = static_cast<size_t>(sink.seek(static_cast<std::streamsize>(target), std::ios_base::beg));
+        return pos_type(target);
+    }
+
+    pos_type seek_impl(size_t current, off_type off, std::ios_base::seekdir dir, std::false_type) {
+        off_type target = (std::ios_base::cur == dir ? static_cast<off_type>(current) : 0) + off;
+        if (std::ios_base::end != dir && target == static_cast<off_type>(current)) {
+            return pos_type(target);
+        }
+        return pos_type(off_type(-1));
+    }
+
+    void drain(std::true_type) {
+        if (nullptr != pbase()) {
+            size_t count = static_cast<size_t>(pptr() - pbase());
+            setp(nullptr, nullptr);
+            sink.commit(count);
+            position += count;
+        }
+    }
+
+    void drain(std::false_type) {
+        if (pptr() > pbase()) {
+            size_t count = static_cast<size_t>(pptr() - pbase());
+            setp(buffer.data(), buffer.data() + buffer.size());
+            write_all(sink, {buffer.data(), count});
+            position += count;
+        }
+    }
+
+    void reset(std::true_type) {
+        span<char> dest = sink.prepare(1);
+        setp(dest.data(), dest.data() + dest.size());
+    }
+
+    void reset(std::false_type) { }
+
+};
+
+/**
+ * Factory function for creating buffered_ostreambuf sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param buffer_size put area size, not used if sink lends its buffer
+ * @return buffered_ostreambuf sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+buffered_ostreambuf<Sink> make_buffered_ostreambuf(Sink&& sink, size_t buffer_size = 4096) {
+    return buffered_ostreambuf<Sink>(std::move(sink), buffer_size);
+}
+
+/**
+ * Factory function for creating buffered_ostreambuf sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param buffer_size put area size, not used if sink lends its buffer
+ * @return buffered_ostreambuf sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+std::unique_ptr<buffered_ostreambuf<Sink>> make_buffered_ostreambuf_ptr(Sink&& sink,
+        size_t buffer_size = 4096) {
+    return std::unique_ptr<buffered_ostreambuf<Sink>>(
+            new buffered_ostreambuf<Sink>(std::move(sink), buffer_size));
+}
+
+/**
+ * Factory function for creating buffered_ostreambuf sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param buffer_size put area size, not used if sink lends its buffer
+ * @return buffered_ostreambuf sink
+ */
+template <typename Sink>
+buffered_ostreambuf<reference_sink<Sink>> make_buffered_ostreambuf(Sink& sink,
+        size_t buffer_size = 4096) {
+    return buffered_ostreambuf<reference_sink<Sink>>(make_reference_sink(sink), buffer_size);
+}
+
+/**
+ * Factory function for creating buffered_ostreambuf sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param buffer_size put area size, not used if sink lends its buffer
+ * @return buffered_ostreambuf sink
+ */
+template <typename Sink>
+std::unique_ptr<buffered_ostreambuf<reference_sink<Sink>>> make_buffered_ostreambuf_ptr(
+        Sink& sink, size_t buffer_size = 4096) {
+    return std::unique_ptr<buffered_ostreambuf<reference_sink<Sink>>>(
+            new buffered_ostreambuf<reference_sink<Sink>>(make_reference_sink(sink), buffer_size));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_BUFFERED_STREAMBUF_HPP */
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   byte_order.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:00 AM
+ */
+#ifndef STATICLIB_IO_BYTE_ORDER_HPP
+#define STATICLIB_IO_BYTE_ORDER_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "staticlib/config.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define STATICLIB_IO_BYTE_ORDER_SSE2
+#include <emmintrin.h>
+#endif // SSE2
+
+namespace staticlib {
+namespace io {
+
+namespace detail_byte_order {
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+const bool host_little_endian = false;
+#else
+const bool host_little_endian = true;
+#endif
+
+const size_t max_varint_len = 10;
+
+inline uint8_t bswap(uint8_t value) {
+    return value;
+}
+
+inline uint16_t bswap(uint16_t value) {
+#ifdef _MSC_VER
+    return _byteswap_ushort(value);
+#else // !_MSC_VER
+    return __builtin_bswap16(value);
+#endif // _MSC_VER
+}
+
+inline uint32_t bswap(uint32_t value) {
+#ifdef _MSC_VER
+    return _byteswap_ulong(value);
+#else // !_MSC_VER
+    return __builtin_bswap32(value);
+#endif // _MSC_VER
+}
+
+inline uint64_t bswap(uint64_t value) {
+#ifdef _MSC_VER
+    return _byteswap_uint64(value);
+#else // !_MSC_VER
+    return __builtin_bswap64(value);
+#endif // _MSC_VER
+}
+
+template<size_t Size>
+struct uint_of_size { };
+
+template<>
+struct uint_of_size<1> {
+    typedef uint8_t type;
+};
+
+template<>
+struct uint_of_size<2> {
+    typedef uint16_t type;
+};
+
+template<>
+struct uint_of_size<4> {
+    typedef uint32_t type;
+};
+
+template<>
+struct uint_of_size<8> {
+    typedef uint64_t type;
+};
+
+// reads value stored in the specified byte order
+template<typename T>
+T load(const char* ptr, bool little_endian) {
+    typedef typename uint_of_size<sizeof(T)>::type uint_type;
+    uint_type bits;
+    std::memcpy(std::addressof(bits), ptr, sizeof(T));
+    if (little_endian != host_little_endian) {
+        bits = bswap(bits);
+    }
+    T res;
+    std::memcpy(std::addressof(res), std::addressof(bits), sizeof(T));
+    return res;
+}
+
+// writes value in the specified byte order
+template<typename T>
+void store(char* ptr, T value, bool little_endian) {
+    typedef typename uint_of_size<sizeof(T)>::type uint_type;
+    uint_type bits;
+    std::memcpy(std::addressof(bits), std::addressof(value), sizeof(T));
+    if (little_endian != host_little_endian) {
+        bits = bswap(bits);
+    }
+    std::memcpy(ptr, std::addressof(bits), sizeof(T));
+}
+
+#ifdef STATICLIB_IO_BYTE_ORDER_SSE2
+
+inline __m128i bswap16x8(__m128i x) {
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+// 16-bit swap followed by the reversal of 16-bit words
+inline __m128i bswap_block(__m128i x, size_t width) {
+    x = bswap16x8(x);
+    if (4 == width) {
+        x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xb1), 0xb1);
+    } else if (8 == width) {
+        x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0x1b), 0x1b);
+    }
+    return x;
+}
+
+#endif // STATICLIB_IO_BYTE_ORDER_SSE2
+
+template<typename UInt>
+void swap_tail(char* data, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        UInt value;
+        std::memcpy(std::addressof(value), data + i * sizeof(UInt), sizeof(UInt));
+        value = bswap(value);
+        std::memcpy(data + i * sizeof(UInt), std::addressof(value), sizeof(UInt));
+    }
+}
+
+// swaps bytes of each of "count" values of specified width in place
+inline void swap_array(char* data, size_t count, size_t width) {
+    if (width < 2) {
+        return;
+    }
+#ifdef STATICLIB_IO_BYTE_ORDER_SSE2
+    size_t per_block = 16 / width;
+    for (; count >= per_block; count -= per_block, data += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), bswap_block(block, width));
+    }
+#endif // STATICLIB_IO_BYTE_ORDER_SSE2
+    switch (width) {
+    case 2: swap_tail<uint16_t>(data, count); break;
+    case 4: swap_tail<uint32_t>(data, count); break;
+    case 8: swap_tail<uint64_t>(data, count); break;
+    default: break;
+    }
+}
+
+// unsigned LEB128, returns number of bytes written
+inline size_t encode_varint(uint64_t value, char* out) {
+    size_t len = 0;
+    while (value >= 0x80) {
+        out[len++] = static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out[len++] = static_cast<char>(value);
+    return len;
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_BYTE_ORDER_HPP */
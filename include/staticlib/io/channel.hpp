@@ -0,0 +1,244 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   channel.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 1:15 PM
+ */
+
+#ifndef STATICLIB_IO_CHANNEL_HPP
+#define STATICLIB_IO_CHANNEL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Snapshot of the channel statistics
+ */
+struct channel_stats {
+    /**
+     * Number of chunks put into channel
+     */
+    size_t chunks_written = 0;
+    /**
+     * Number of chunks taken from channel
+     */
+    size_t chunks_read = 0;
+    /**
+     * Number of bytes put into channel
+     */
+    size_t bytes_written = 0;
+    /**
+     * Number of bytes taken from channel
+     */
+    size_t bytes_read = 0;
+    /**
+     * Number of times writers were blocked on full channel
+     */
+    size_t writes_blocked = 0;
+    /**
+     * Number of times readers were blocked on empty channel
+     */
+    size_t reads_blocked = 0;
+    /**
+     * Max number of chunks queued at once
+     */
+    size_t max_depth = 0;
+};
+
+/**
+ * Bounded multi-producer/multi-consumer queue of owned chunks.
+ * Usually accessed through "channel_sink" and "channel_source"
+ * endpoints, each endpoint must be used from a single thread,
+ * any number of endpoints can be used concurrently.
+ */
+class channel {
+    /**
+     * Max number of chunks queued
+     */
+    size_t capacity;
+    /**
+     * Queued chunks
+     */
+    std::deque<std::string> queue;
+    /**
+     * Whether channel was closed
+     */
+    bool closed = false;
+    /**
+     * Statistics
+     */
+    channel_stats stats;
+
+    /**
+     * Queue lock
+     */
+    std::mutex mutex;
+    /**
+     * Writers wait on it when channel is full
+     */
+    std::condition_variable not_full;
+    /**
+     * Readers wait on it when channel is empty
+     */
+    std::condition_variable not_empty;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param capacity max number of chunks queued
+     */
+    explicit channel(size_t capacity) :
+    capacity(capacity) {
+        if (0 == capacity) throw io_exception(TRACEMSG("Invalid zero channel capacity specified"));
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    channel(const channel&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    channel& operator=(const channel&) = delete;
+
+    /**
+     * Puts the chunk into channel, blocks while the channel is full
+     * 
+     * @param chunk chunk to put, moved into channel
+     * @return true if chunk was put, false if channel was blocked
+     *         while waiting for free space
+     * @throws io_exception if channel was closed
+     */
+    bool put(std::string&& chunk) {
+        std::unique_lock<std::mutex> guard{mutex};
+        bool blocked = false;
+        if (!closed && queue.size() >= capacity) {
+            blocked = true;
+            stats.writes_blocked += 1;
+            while (!closed && queue.size() >= capacity) {
+                not_full.wait(guard);
+            }
+        }
+        if (closed) throw io_exception(TRACEMSG("Write into closed channel"));
+        stats.chunks_written += 1;
+        stats.bytes_written += chunk.length();
+        queue.emplace_back(std::move(chunk));
+        if (queue.size() > stats.max_depth) {
+            stats.max_depth = queue.size();
+        }
+        guard.unlock();
+        not_empty.notify_one();
+        return !blocked;
+    }
+
+    /**
+     * Takes the chunk from the channel, blocks while the channel is empty
+     * 
+     * @param chunk string to move the chunk into
+     * @param blocked set to true if reader was blocked while
+     *        waiting for the chunk
+     * @return false if channel was closed and drained, true otherwise
+     */
+    bool take(std::string& chunk, bool& blocked) {
+        std::unique_lock<std::mutex> guard{mutex};
+        blocked = false;
+        if (!closed && queue.empty()) {
+            blocked = true;
+            stats.reads_blocked += 1;
+            while (!closed && queue.empty()) {
+                not_empty.wait(guard);
+            }
+        }
+        if (queue.empty()) {
+            return false;
+        }
+        chunk = std::move(queue.front());
+        queue.pop_front();
+        stats.chunks_read += 1;
+        stats.bytes_read += chunk.length();
+        guard.unlock();
+        not_full.notify_one();
+        return true;
+    }
+
+    /**
+     * Closes the channel, subsequent writes will throw,
+     * readers will get EOF after all queued chunks are consumed
+     */
+    void close() {
+        std::lock_guard<std::mutex> guard{mutex};
+        closed = true;
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+
+    /**
+     * Statistics accessor
+     * 
+     * @return snapshot of the channel statistics
+     */
+    channel_stats get_stats() {
+        std::lock_guard<std::mutex> guard{mutex};
+        return stats;
+    }
+
+    /**
+     * Returns number of chunks currently queued
+     * 
+     * @return number of chunks queued
+     */
+    size_t get_depth() {
+        std::lock_guard<std::mutex> guard{mutex};
+        return queue.size();
+    }
+
+};
+
+/**
+ * Factory function for creating channels
+ * 
+ * @param capacity max number of chunks queued
+ * @return channel pointer to share between endpoints
+ */
+inline std::shared_ptr<channel> make_channel(size_t capacity = 64) {
+    return std::make_shared<channel>(capacity);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_CHANNEL_HPP */
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   channel_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 1:40 PM
+ */
+
+#ifndef STATICLIB_IO_CHANNEL_SINK_HPP
+#define STATICLIB_IO_CHANNEL_SINK_HPP
+
+#include <ios>
+#include <memory>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/channel.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink implementation that puts each written span into the channel
+ * as a separate chunk. Write blocks while the channel is full.
+ * Must be used from a single thread, multiple sinks can be used
+ * with the same channel concurrently.
+ */
+class channel_sink {
+    /**
+     * Destination channel
+     */
+    std::shared_ptr<channel> chan;
+    /**
+     * Number of chunks put through this sink
+     */
+    size_t chunks_count = 0;
+    /**
+     * Number of times this sink was blocked on full channel
+     */
+    size_t blocked_count = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param chan destination channel
+     */
+    explicit channel_sink(std::shared_ptr<channel> chan) :
+    chan(std::move(chan)) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    channel_sink(const channel_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    channel_sink& operator=(const channel_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    channel_sink(channel_sink&& other) STATICLIB_NOEXCEPT :
+    chan(std::move(other.chan)),
+    chunks_count(other.chunks_count),
+    blocked_count(other.blocked_count) {
+        other.chunks_count = 0;
+        other.blocked_count = 0;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    channel_sink& operator=(channel_sink&& other) STATICLIB_NOEXCEPT {
+        chan = std::move(other.chan);
+        chunks_count = other.chunks_count;
+        other.chunks_count = 0;
+        blocked_count = other.blocked_count;
+        other.blocked_count = 0;
+        return *this;
+    }
+
+    /**
+     * Write implementation, copies specified span into
+     * a new chunk and puts it into channel
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        if (span.size() > 0) {
+            put(std::string(span.data(), span.size()));
+        }
+        return span.size_signed();
+    }
+
+    /**
+     * Puts the specified chunk into channel without copying it
+     * 
+     * @param chunk chunk to put, moved into channel
+     * @return number of bytes processed
+     */
+    std::streamsize write_chunk(std::string&& chunk) {
+        auto len = static_cast<std::streamsize>(chunk.length());
+        if (len > 0) {
+            put(std::move(chunk));
+        }
+        return len;
+    }
+
+    /**
+     * No-op flush implementation, written chunks
+     * are available to readers immediately
+     * 
+     * @return 0
+     */
+    std::streamsize flush() {
+        // no-op
+        return 0;
+    }
+
+    /**
+     * Returns number of chunks put through this sink
+     * 
+     * @return number of chunks
+     */
+    size_t get_chunks_count() {
+        return chunks_count;
+    }
+
+    /**
+     * Returns number of times this sink was blocked on full channel
+     * 
+     * @return number of blocked writes
+     */
+    size_t get_blocked_count() {
+        return blocked_count;
+    }
+
+    /**
+     * Underlying channel accessor
+     * 
+     * @return underlying channel reference
+     */
+    channel& get_channel() {
+        return *chan;
+    }
+
+private:
+    void put(std::string&& chunk) {
+        if (!chan->put(std::move(chunk))) {
+            blocked_count += 1;
+        }
+        chunks_count += 1;
+    }
+
+};
+
+/**
+ * Factory function for creating channel sinks
+ * 
+ * @param chan destination channel
+ * @return channel sink
+ */
+inline channel_sink make_channel_sink(std::shared_ptr<channel> chan) {
+    return channel_sink(std::move(chan));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_CHANNEL_SINK_HPP */
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   channel_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:05 PM
+ */
+
+#ifndef STATICLIB_IO_CHANNEL_SOURCE_HPP
+#define STATICLIB_IO_CHANNEL_SOURCE_HPP
+
+#include <cstring>
+#include <ios>
+#include <memory>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/channel.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source implementation that takes chunks from the channel.
+ * Read blocks while the channel is empty, EOF is returned after
+ * the channel was closed and drained.
+ * Must be used from a single thread, multiple sources can be used
+ * with the same channel concurrently, each chunk is received
+ * by exactly one of them.
+ */
+class channel_source {
+    /**
+     * Input channel
+     */
+    std::shared_ptr<channel> chan;
+    /**
+     * Current chunk
+     */
+    std::string chunk;
+    /**
+     * Position in current chunk
+     */
+    size_t pos = 0;
+    /**
+     * Number of chunks taken through this source
+     */
+    size_t chunks_count = 0;
+    /**
+     * Number of times this source was blocked on empty channel
+     */
+    size_t blocked_count = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param chan input channel
+     */
+    explicit channel_source(std::shared_ptr<channel> chan) :
+    chan(std::move(chan)) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    channel_source(const channel_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    channel_source& operator=(const channel_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    channel_source(channel_source&& other) STATICLIB_NOEXCEPT :
+    chan(std::move(other.chan)),
+    chunk(std::move(other.chunk)),
+    pos(other.pos),
+    chunks_count(other.chunks_count),
+    blocked_count(other.blocked_count) {
+        other.pos = 0;
+        other.chunks_count = 0;
+        other.blocked_count = 0;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    channel_source& operator=(channel_source&& other) STATICLIB_NOEXCEPT {
+        chan = std::move(other.chan);
+        chunk = std::move(other.chunk);
+        pos = other.pos;
+        other.pos = 0;
+        chunks_count = other.chunks_count;
+        other.chunks_count = 0;
+        blocked_count = other.blocked_count;
+        other.blocked_count = 0;
+        return *this;
+    }
+
+    /**
+     * Read implementation, drains the current chunk
+     * taking the next one from the channel when needed
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize read(span<char> span) {
+        if (0 == span.size()) {
+            return 0;
+        }
+        if (pos == chunk.length()) {
+            if (!take(chunk)) {
+                return std::char_traits<char>::eof();
+            }
+            pos = 0;
+        }
+        size_t avail = chunk.length() - pos;
+        size_t len = span.size() <= avail ? span.size() : avail;
+        std::memcpy(span.data(), chunk.data() + pos, len);
+        pos += len;
+        return static_cast<std::streamsize>(len);
+    }
+
+    /**
+     * Returns the rest of the current chunk or the next chunk
+     * from the channel without copying it
+     * 
+     * @param dest string to move the chunk into
+     * @return false on EOF, true otherwise
+     */
+    bool read_chunk(std::string& dest) {
+        if (pos < chunk.length()) {
+            dest = chunk.substr(pos);
+            chunk.clear();
+            pos = 0;
+            return true;
+        }
+        return take(dest);
+    }
+
+    /**
+     * Returns number of chunks taken through this source
+     * 
+     * @return number of chunks
+     */
+    size_t get_chunks_count() {
+        return chunks_count;
+    }
+
+    /**
+     * Returns number of times this source was blocked on empty channel
+     * 
+     * @return number of blocked reads
+     */
+    size_t get_blocked_count() {
+        return blocked_count;
+    }
+
+    /**
+     * Underlying channel accessor
+     * 
+     * @return underlying channel reference
+     */
+    channel& get_channel() {
+        return *chan;
+    }
+
+private:
+    bool take(std::string& dest) {
+        bool blocked = false;
+        bool res = chan->take(dest, blocked);
+        if (blocked) {
+            blocked_count += 1;
+        }
+        if (res) {
+            chunks_count += 1;
+        }
+        return res;
+    }
+
+};
+
+/**
+ * Factory function for creating channel sources
+ * 
+ * @param chan input channel
+ * @return channel source
+ */
+inline channel_source make_channel_source(std::shared_ptr<channel> chan) {
+    return channel_source(std::move(chan));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_CHANNEL_SOURCE_HPP */
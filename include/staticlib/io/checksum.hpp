@@ -0,0 +1,281 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   checksum.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:10 AM
+ */
+#ifndef STATICLIB_IO_CHECKSUM_HPP
+#define STATICLIB_IO_CHECKSUM_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/xxhash.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define STATICLIB_IO_CHECKSUM_SSE42
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <nmmintrin.h>
+#define STATICLIB_IO_CHECKSUM_TARGET_SSE42
+#else // !_MSC_VER
+#include <nmmintrin.h>
+#define STATICLIB_IO_CHECKSUM_TARGET_SSE42 __attribute__((target("sse4.2")))
+#endif // _MSC_VER
+#endif // x86_64
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Checksum algorithms supported by "checksum_source" and "checksum_sink"
+ */
+enum class checksum_algorithm {
+    /**
+     * CRC-32 (ISO-HDLC), used in GZIP, ZIP and PNG
+     */
+    crc32,
+    /**
+     * CRC-32C (Castagnoli), used in iSCSI, ext4 and many storage systems,
+     * computed with SSE4.2 instruction when it is available
+     */
+    crc32c,
+    /**
+     * Adler-32, used in ZLIB
+     */
+    adler32,
+    /**
+     * 64-bit xxHash with zero seed
+     */
+    xxh64
+};
+
+namespace detail_checksum {
+
+/**
+ * Lookup tables for slicing-by-8 CRC computation,
+ * table "k" gives the CRC of the byte followed by "k" zero bytes
+ */
+struct crc_tables {
+    uint32_t table[8][256];
+
+    explicit crc_tables(uint32_t poly) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; j++) {
+                crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+            }
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; i++) {
+            for (size_t k = 1; k < 8; k++) {
+                uint32_t prev = table[k - 1][i];
+                table[k][i] = (prev >> 8) ^ table[0][prev & 0xff];
+            }
+        }
+    }
+};
+
+inline const crc_tables& crc32_tables() {
+    static const crc_tables tables(0xedb88320u);
+    return tables;
+}
+
+inline const crc_tables& crc32c_tables() {
+    static const crc_tables tables(0x82f63b78u);
+    return tables;
+}
+
+inline uint32_t read_le32(const unsigned char* ptr) {
+    return static_cast<uint32_t>(ptr[0]) | (static_cast<uint32_t>(ptr[1]) << 8) |
+            (static_cast<uint32_t>(ptr[2]) << 16) | (static_cast<uint32_t>(ptr[3]) << 24);
+}
+
+inline uint32_t crc_update(const crc_tables& tables, uint32_t crc, const unsigned char* data, size_t len) {
+    const uint32_t (&t)[8][256] = tables.table;
+    crc = ~crc;
+    for (; len >= 8; data += 8, len -= 8) {
+        uint32_t one = crc ^ read_le32(data);
+        uint32_t two = read_le32(data + 4);
+        crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^ t[5][(one >> 16) & 0xff] ^ t[4][one >> 24] ^
+                t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff] ^ t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+    }
+    for (; len > 0; data++, len--) {
+        crc = t[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+#ifdef STATICLIB_IO_CHECKSUM_SSE42
+
+inline bool detect_sse42() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return 0 != (info[2] & (1 << 20));
+#else // !_MSC_VER
+    return 0 != __builtin_cpu_supports("sse4.2");
+#endif // _MSC_VER
+}
+
+inline bool has_sse42() {
+    static const bool res = detect_sse42();
+    return res;
+}
+
+STATICLIB_IO_CHECKSUM_TARGET_SSE42
+inline uint32_t crc32c_update_sse42(uint32_t crc, const unsigned char* data, size_t len) {
+    uint64_t crc64 = ~crc;
+    for (; len >= 8; data += 8, len -= 8) {
+        uint64_t val;
+        std::memcpy(std::addressof(val), data, 8);
+        crc64 = _mm_crc32_u64(crc64, val);
+    }
+    uint32_t crc32 = static_cast<uint32_t>(crc64);
+    for (; len > 0; data++, len--) {
+        crc32 = _mm_crc32_u8(crc32, *data);
+    }
+    return ~crc32;
+}
+
+#endif // STATICLIB_IO_CHECKSUM_SSE42
+
+/**
+ * Updates CRC-32 (ISO-HDLC) checksum
+ * 
+ * @param crc current checksum value
+ * @param data data
+ * @param len data length
+ * @return updated checksum value
+ */
+inline uint32_t crc32_update(uint32_t crc, const unsigned char* data, size_t len) {
+    return crc_update(crc32_tables(), crc, data, len);
+}
+
+/**
+ * Updates CRC-32C (Castagnoli) checksum
+ * 
+ * @param crc current checksum value
+ * @param data data
+ * @param len data length
+ * @return updated checksum value
+ */
+inline uint32_t crc32c_update(uint32_t crc, const unsigned char* data, size_t len) {
+#ifdef STATICLIB_IO_CHECKSUM_SSE42
+    if (has_sse42()) {
+        return crc32c_update_sse42(crc, data, len);
+    }
+#endif // STATICLIB_IO_CHECKSUM_SSE42
+    return crc_update(crc32c_tables(), crc, data, len);
+}
+
+/**
+ * Updates Adler-32 checksum
+ * 
+ * @param adler current checksum value
+ * @param data data
+ * @param len data length
+ * @return updated checksum value
+ */
+inline uint32_t adler32_update(uint32_t adler, const unsigned char* data, size_t len) {
+    const uint32_t mod = 65521;
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    while (len > 0) {
+        // max number of bytes before the sums may overflow
+        size_t chunk = len < 5552 ? len : 5552;
+        len -= chunk;
+        for (; chunk >= 8; data += 8, chunk -= 8) {
+            a += data[0]; b += a;
+            a += data[1]; b += a;
+            a += data[2]; b += a;
+            a += data[3]; b += a;
+            a += data[4]; b += a;
+            a += data[5]; b += a;
+            a += data[6]; b += a;
+            a += data[7]; b += a;
+        }
+        for (; chunk > 0; data++, chunk--) {
+            a += *data;
+            b += a;
+        }
+        a %= mod;
+        b %= mod;
+    }
+    return (b << 16) | a;
+}
+
+/**
+ * Incremental checksum computation with the algorithm selected at runtime
+ */
+class checksum_state {
+    checksum_algorithm algorithm;
+    uint32_t value32 = 0;
+    detail_xxhash::xxh64 hash64;
+
+public:
+    explicit checksum_state(checksum_algorithm algorithm) :
+    algorithm(algorithm) {
+        reset();
+    }
+
+    void reset() {
+        value32 = checksum_algorithm::adler32 == algorithm ? 1 : 0;
+        hash64.reset();
+    }
+
+    void update(const char* data, size_t len) {
+        const unsigned char* udata = reinterpret_cast<const unsigned char*>(data);
+        switch (algorithm) {
+        case checksum_algorithm::crc32: value32 = crc32_update(value32, udata, len); break;
+        case checksum_algorithm::crc32c: value32 = crc32c_update(value32, udata, len); break;
+        case checksum_algorithm::adler32: value32 = adler32_update(value32, udata, len); break;
+        case checksum_algorithm::xxh64: hash64.update(udata, len); break;
+        }
+    }
+
+    uint64_t value() const {
+        return checksum_algorithm::xxh64 == algorithm ? hash64.digest() : value32;
+    }
+
+    checksum_algorithm get_algorithm() const {
+        return algorithm;
+    }
+};
+
+inline std::string algorithm_name(checksum_algorithm algorithm) {
+    switch (algorithm) {
+    case checksum_algorithm::crc32: return "crc32";
+    case checksum_algorithm::crc32c: return "crc32c";
+    case checksum_algorithm::adler32: return "adler32";
+    case checksum_algorithm::xxh64: return "xxh64";
+    default: return "unknown";
+    }
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_CHECKSUM_HPP */
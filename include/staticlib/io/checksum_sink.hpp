@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   checksum_sink.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:40 AM
+ */
+#ifndef STATICLIB_IO_CHECKSUM_SINK_HPP
+#define STATICLIB_IO_CHECKSUM_SINK_HPP
+
+#include <cstdint>
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/checksum.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink wrapper that computes the checksum of the data written through it
+ */
+template<typename Sink>
+class checksum_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Checksum state
+     */
+    detail_checksum::checksum_state state;
+    /**
+     * Start of the span lent by the last "prepare" call
+     */
+    const char* prepared = nullptr;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param algorithm checksum algorithm
+     */
+    checksum_sink(Sink&& sink, checksum_algorithm algorithm) :
+    sink(std::move(sink)),
+    state(algorithm) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    checksum_sink(const checksum_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    checksum_sink& operator=(const checksum_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    checksum_sink(checksum_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    state(other.state),
+    prepared(other.prepared) {
+        other.prepared = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    checksum_sink& operator=(checksum_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        state = other.state;
+        prepared = other.prepared;
+        other.prepared = nullptr;
+        return *this;
+    }
+
+    /**
+     * Checksumming write implementation,
+     * only the bytes accepted by destination sink are checksummed
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        std::streamsize res = sink.write(span);
+        if (res > 0) {
+            state.update(span.data(), static_cast<size_t>(res));
+        }
+        return res;
+    }
+
+    /**
+     * Prepare implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param min min number of bytes required
+     * @return span lent by the underlying sink
+     */
+    template<typename T = Sink>
+    auto prepare(size_t min) -> decltype(std::declval<T&>().prepare(min)) {
+        auto res = sink.prepare(min);
+        prepared = res.data();
+        return res;
+    }
+
+    /**
+     * Commit implementation delegated to the underlying sink,
+     * available only if underlying sink implements it,
+     * committed bytes are checksummed
+     * 
+     * @param count number of bytes written
+     */
+    template<typename T = Sink>
+    auto commit(size_t count) -> decltype(std::declval<T&>().commit(count), void()) {
+        if (count > 0) {
+            state.update(prepared, count);
+        }
+        sink.commit(count);
+    }
+
+    /**
+     * Flushes destination sink
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        return sink.flush();
+    }
+
+    /**
+     * Returns checksum of the data written through this instance
+     * 
+     * @return checksum value, 32-bit checksums are returned in lower bits
+     */
+    uint64_t get_checksum() const {
+        return state.value();
+    }
+
+    /**
+     * Resets checksum computation to start from the current position
+     */
+    void reset_checksum() {
+        state.reset();
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+};
+
+/**
+ * Factory function for creating checksum sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param algorithm checksum algorithm
+ * @return checksum sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+checksum_sink<Sink> make_checksum_sink(Sink&& sink, checksum_algorithm algorithm) {
+    return checksum_sink<Sink>(std::move(sink), algorithm);
+}
+
+/**
+ * Factory function for creating checksum sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param algorithm checksum algorithm
+ * @return checksum sink
+ */
+template <typename Sink>
+checksum_sink<reference_sink<Sink>> make_checksum_sink(Sink& sink, checksum_algorithm algorithm) {
+    return checksum_sink<reference_sink<Sink>>(make_reference_sink(sink), algorithm);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_CHECKSUM_SINK_HPP */
@@ -0,0 +1,288 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   checksum_source.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:30 AM
+ */
+#ifndef STATICLIB_IO_CHECKSUM_SOURCE_HPP
+#define STATICLIB_IO_CHECKSUM_SOURCE_HPP
+
+#include <cstdint>
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/checksum.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source wrapper that computes the checksum of the data read through it.
+ * In verify mode checksum is compared with the expected value when EOF
+ * is reached and exception is thrown on mismatch.
+ */
+template<typename Source>
+class checksum_source {
+    /**
+     * Input source
+     */
+    Source src;
+    /**
+     * Checksum state
+     */
+    detail_checksum::checksum_state state;
+    /**
+     * Expected checksum value
+     */
+    uint64_t expected = 0;
+    /**
+     * Whether checksum is verified at EOF
+     */
+    bool verify = false;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param algorithm checksum algorithm
+     */
+    checksum_source(Source&& src, checksum_algorithm algorithm) :
+    src(std::move(src)),
+    state(algorithm) { }
+
+    /**
+     * Constructor for verify mode,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param algorithm checksum algorithm
+     * @param expected expected checksum value of all the data in the source
+     */
+    checksum_source(Source&& src, checksum_algorithm algorithm, uint64_t expected) :
+    src(std::move(src)),
+    state(algorithm),
+    expected(expected),
+    verify(true) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    checksum_source(const checksum_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    checksum_source& operator=(const checksum_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    checksum_source(checksum_source&& other) STATICLIB_NOEXCEPT :
+    src(std::move(other.src)),
+    state(other.state),
+    expected(other.expected),
+    verify(other.verify) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    checksum_source& operator=(checksum_source&& other) STATICLIB_NOEXCEPT {
+        src = std::move(other.src);
+        state = other.state;
+        expected = other.expected;
+        verify = other.verify;
+        return *this;
+    }
+
+    /**
+     * Checksumming read implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     * @throws io_exception in verify mode on checksum mismatch at EOF
+     */
+    std::streamsize read(span<char> span) {
+        std::streamsize res = src.read(span);
+        if (res > 0) {
+            state.update(span.data(), static_cast<size_t>(res));
+        } else if (std::char_traits<char>::eof() == res) {
+            check();
+        }
+        return res;
+    }
+
+    /**
+     * Next chunk implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent bytes are checksummed
+     * 
+     * @return span over the data lent by the underlying source
+     * @throws io_exception in verify mode on checksum mismatch at EOF
+     */
+    template<typename T = Source>
+    auto next_chunk() -> decltype(std::declval<T&>().next_chunk()) {
+        auto res = src.next_chunk();
+        if (res.size() > 0) {
+            state.update(res.data(), res.size());
+        } else {
+            check();
+        }
+        return res;
+    }
+
+    /**
+     * Borrow read implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent bytes are checksummed
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     * @throws io_exception in verify mode on checksum mismatch at EOF
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        auto res = src.borrow_read(max);
+        if (res.size() > 0) {
+            state.update(res.data(), res.size());
+        } else if (max > 0) {
+            check();
+        }
+        return res;
+    }
+
+    /**
+     * Returns checksum of the data read through this instance
+     * 
+     * @return checksum value, 32-bit checksums are returned in lower bits
+     */
+    uint64_t get_checksum() const {
+        return state.value();
+    }
+
+    /**
+     * Resets checksum computation to start from the current position
+     */
+    void reset_checksum() {
+        state.reset();
+    }
+
+    /**
+     * Underlying source accessor
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return src;
+    }
+
+private:
+    void check() {
+        if (!verify) {
+            return;
+        }
+        uint64_t actual = state.value();
+        if (expected != actual) throw io_exception(TRACEMSG("Checksum mismatch," +
+                " algorithm: [" + detail_checksum::algorithm_name(state.get_algorithm()) + "]," +
+                " expected: [" + sl::support::to_string(expected) + "]," +
+                " actual: [" + sl::support::to_string(actual) + "]"));
+    }
+
+};
+
+/**
+ * Factory function for creating checksum sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param algorithm checksum algorithm
+ * @return checksum source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+checksum_source<Source> make_checksum_source(Source&& source, checksum_algorithm algorithm) {
+    return checksum_source<Source>(std::move(source), algorithm);
+}
+
+/**
+ * Factory function for creating checksum sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param algorithm checksum algorithm
+ * @return checksum source
+ */
+template <typename Source>
+checksum_source<reference_source<Source>> make_checksum_source(Source& source, checksum_algorithm algorithm) {
+    return checksum_source<reference_source<Source>>(make_reference_source(source), algorithm);
+}
+
+/**
+ * Factory function for creating checksum sources in verify mode,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param algorithm checksum algorithm
+ * @param expected expected checksum value of all the data in the source
+ * @return checksum source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+checksum_source<Source> make_checksum_source(Source&& source, checksum_algorithm algorithm, uint64_t expected) {
+    return checksum_source<Source>(std::move(source), algorithm, expected);
+}
+
+/**
+ * Factory function for creating checksum sources in verify mode,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param algorithm checksum algorithm
+ * @param expected expected checksum value of all the data in the source
+ * @return checksum source
+ */
+template <typename Source>
+checksum_source<reference_source<Source>> make_checksum_source(Source& source, checksum_algorithm algorithm,
+        uint64_t expected) {
+    return checksum_source<reference_source<Source>>(make_reference_source(source), algorithm, expected);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_CHECKSUM_SOURCE_HPP */
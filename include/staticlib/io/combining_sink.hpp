@@ -0,0 +1,355 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   combining_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#ifndef STATICLIB_IO_COMBINING_SINK_HPP
+#define STATICLIB_IO_COMBINING_SINK_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_combining {
+
+/**
+ * Write request published by the writer thread
+ */
+struct request {
+    /**
+     * Data to write, stays valid while writer waits
+     */
+    span<const char> data;
+    /**
+     * Whether request was processed by combiner
+     */
+    bool done = false;
+    /**
+     * Error thrown while writing the batch
+     */
+    std::exception_ptr error;
+
+    /**
+     * Constructor
+     * 
+     * @param data data to write
+     */
+    explicit request(span<const char> data) :
+    data(data) { }
+};
+
+/**
+ * State shared between copies of the "combining_sink"
+ */
+template<typename Sink>
+class combining_state {
+public:
+    /**
+     * Destination sink
+     */
+    std::shared_ptr<Sink> sink;
+    /**
+     * Lock protecting the fields below
+     */
+    std::mutex mutex;
+    /**
+     * Signalled when the batch is written
+     */
+    std::condition_variable batch_done;
+    /**
+     * Requests waiting for the combiner
+     */
+    std::vector<request*> pending;
+    /**
+     * Whether some thread acts as a combiner
+     */
+    bool combining = false;
+    /**
+     * Number of "write" calls made
+     */
+    size_t writes_count = 0;
+    /**
+     * Number of writes made to destination sink
+     */
+    size_t batches_count = 0;
+    /**
+     * Max number of requests combined into single batch
+     */
+    size_t max_batch_size = 0;
+    /**
+     * Number of "write" calls that had to wait for other combiner
+     */
+    size_t contended_count = 0;
+
+    /**
+     * Constructor
+     * 
+     * @param sink destination sink
+     */
+    explicit combining_state(std::shared_ptr<Sink> sink) :
+    sink(std::move(sink)) { }
+};
+
+} // namespace
+
+/**
+ * Sink wrapper that holds a "std::shared_ptr" to the underlying sink
+ * and combines concurrent writes from different threads. Writers publish
+ * their spans, one of them becomes a combiner and writes all pending spans
+ * to the destination sink as a single contiguous write, while others wait
+ * for it to finish. Copies of this sink share the same state and can
+ * be used from different threads.
+ */
+template <typename Sink>
+class combining_sink {
+    /**
+     * Shared state
+     */
+    std::shared_ptr<detail_combining::combining_state<Sink>> state;
+    /**
+     * Gather buffer, used only by this copy when it acts as a combiner
+     */
+    std::string gather_buf;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param sink destination sink
+     */
+    explicit combining_sink(std::shared_ptr<Sink> sink) :
+    state(std::make_shared<detail_combining::combining_state<Sink>>(std::move(sink))) { }
+
+    /**
+     * Copy constructor
+     * 
+     * @param other instance
+     */
+    combining_sink(const combining_sink& other) :
+    state(other.state) { }
+
+    /**
+     * Copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    combining_sink& operator=(const combining_sink& other) {
+        state = other.state;
+        return *this;
+    }
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    combining_sink(combining_sink&& other) STATICLIB_NOEXCEPT :
+    state(std::move(other.state)),
+    gather_buf(std::move(other.gather_buf)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    combining_sink& operator=(combining_sink&& other) STATICLIB_NOEXCEPT {
+        state = std::move(other.state);
+        gather_buf = std::move(other.gather_buf);
+        return *this;
+    }
+
+    /**
+     * Combining write implementation, returns after the specified span
+     * is written to the destination sink by this or other thread
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        if (0 == span.size()) {
+            return 0;
+        }
+        auto& st = *state;
+        auto req = detail_combining::request(span);
+        std::unique_lock<std::mutex> guard{st.mutex};
+        st.writes_count += 1;
+        st.pending.push_back(std::addressof(req));
+        if (st.combining) {
+            st.contended_count += 1;
+        }
+        while (!req.done) {
+            if (!st.combining) {
+                combine(guard);
+            } else {
+                st.batch_done.wait(guard);
+            }
+        }
+        if (req.error) {
+            std::rethrow_exception(req.error);
+        }
+        return span.size_signed();
+    }
+
+    /**
+     * Flushes destination sink, waits for the current
+     * combiner to finish
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        auto& st = *state;
+        std::unique_lock<std::mutex> guard{st.mutex};
+        while (st.combining) {
+            st.batch_done.wait(guard);
+        }
+        st.combining = true;
+        guard.unlock();
+        std::exception_ptr err;
+        std::streamsize res = 0;
+        try {
+            res = st.sink->flush();
+        } catch (...) {
+            err = std::current_exception();
+        }
+        guard.lock();
+        st.combining = false;
+        guard.unlock();
+        st.batch_done.notify_all();
+        if (err) {
+            std::rethrow_exception(err);
+        }
+        return res;
+    }
+
+    /**
+     * Returns number of "write" calls made through all copies of this sink
+     * 
+     * @return number of calls
+     */
+    size_t get_writes_count() {
+        std::lock_guard<std::mutex> guard{state->mutex};
+        return state->writes_count;
+    }
+
+    /**
+     * Returns number of combined writes made to the destination sink
+     * 
+     * @return number of batches
+     */
+    size_t get_batches_count() {
+        std::lock_guard<std::mutex> guard{state->mutex};
+        return state->batches_count;
+    }
+
+    /**
+     * Returns max number of "write" calls combined into single batch
+     * 
+     * @return max batch size
+     */
+    size_t get_max_batch_size() {
+        std::lock_guard<std::mutex> guard{state->mutex};
+        return state->max_batch_size;
+    }
+
+    /**
+     * Returns number of "write" calls that found another thread combining
+     * 
+     * @return number of contended calls
+     */
+    size_t get_contended_count() {
+        std::lock_guard<std::mutex> guard{state->mutex};
+        return state->contended_count;
+    }
+
+    /**
+     * Underlying sink accessor, access to it is not synchronized
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return *state->sink;
+    }
+
+private:
+    void combine(std::unique_lock<std::mutex>& guard) {
+        auto& st = *state;
+        st.combining = true;
+        auto batch = std::vector<detail_combining::request*>();
+        batch.swap(st.pending);
+        guard.unlock();
+        std::exception_ptr err;
+        try {
+            if (1 == batch.size()) {
+                write_all(*st.sink, batch.front()->data);
+            } else {
+                gather_buf.clear();
+                for (auto req : batch) {
+                    gather_buf.append(req->data.data(), req->data.size());
+                }
+                write_all(*st.sink, gather_buf);
+            }
+        } catch (...) {
+            err = std::current_exception();
+        }
+        guard.lock();
+        for (auto req : batch) {
+            req->error = err;
+            req->done = true;
+        }
+        st.batches_count += 1;
+        if (batch.size() > st.max_batch_size) {
+            st.max_batch_size = batch.size();
+        }
+        st.combining = false;
+        st.batch_done.notify_all();
+    }
+
+};
+
+/**
+ * Factory function for creating combining sinks
+ * 
+ * @param sink destination sink
+ * @return combining sink
+ */
+template <typename Sink>
+combining_sink<Sink> make_combining_sink(std::shared_ptr<Sink> sink) {
+    return combining_sink<Sink>(std::move(sink));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_COMBINING_SINK_HPP */
@@ -115,6 +115,39 @@ public:
         return res;
     }
 
+    /**
+     * Next chunk implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent data is written to the copy sink directly
+     * 
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto next_chunk() -> decltype(std::declval<T&>().next_chunk()) {
+        auto res = src.next_chunk();
+        if (res.size() > 0) {
+            write_all(sink, res);
+        }
+        return res;
+    }
+
+    /**
+     * Borrow read implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent data is written to the copy sink directly
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        auto res = src.borrow_read(max);
+        if (res.size() > 0) {
+            write_all(sink, res);
+        }
+        return res;
+    }
+
     /**
      * Flushes copy sink
      * 
@@ -25,6 +25,7 @@
 #define STATICLIB_IO_COUNTING_SINK_HPP
 
 #include <ios>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
@@ -111,6 +112,31 @@ public:
         return res;
     }
 
+    /**
+     * Prepare implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param min min number of bytes required
+     * @return span lent by the underlying sink
+     */
+    template<typename T = Sink>
+    auto prepare(size_t min) -> decltype(std::declval<T&>().prepare(min)) {
+        return sink.prepare(min);
+    }
+
+    /**
+     * Commit implementation delegated to the underlying sink,
+     * available only if underlying sink implements it,
+     * committed bytes are counted
+     * 
+     * @param count number of bytes written
+     */
+    template<typename T = Sink>
+    auto commit(size_t count) -> decltype(std::declval<T&>().commit(count), void()) {
+        sink.commit(count);
+        this->count += count;
+    }
+
     /**
      * Flushes destination sink
      * 
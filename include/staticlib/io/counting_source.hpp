@@ -25,6 +25,7 @@
 #define STATICLIB_IO_COUNTING_SOURCE_HPP
 
 #include <ios>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
@@ -111,6 +112,106 @@ public:
         return res;
     }
 
+    /**
+     * Skip implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * skipped bytes are counted
+     * 
+     * @param to_skip number of bytes to skip
+     */
+    template<typename T = Source>
+    auto skip(size_t to_skip) -> decltype(std::declval<T&>().skip(to_skip), void()) {
+        src.skip(to_skip);
+        count += to_skip;
+    }
+
+    /**
+     * Seek implementation delegated to the underlying source,
+     * available only if underlying source is seekable.
+     * Number of bytes read is adjusted by the difference between
+     * the new and the old position (it cannot become negative).
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     */
+    template<typename S = Source>
+    auto seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg)
+            -> decltype(std::declval<S&>().seek(offset, whence)) {
+        auto old_pos = src.tell();
+        auto res = src.seek(offset, whence);
+        if (res >= old_pos) {
+            count += static_cast<size_t>(res - old_pos);
+        } else {
+            size_t diff = static_cast<size_t>(old_pos - res);
+            count = diff <= count ? count - diff : 0;
+        }
+        return res;
+    }
+
+    /**
+     * Current position accessor delegated to the underlying source
+     * 
+     * @return current position
+     */
+    template<typename S = Source>
+    auto tell() -> decltype(std::declval<S&>().tell()) {
+        return src.tell();
+    }
+
+    /**
+     * Size accessor delegated to the underlying source
+     * 
+     * @return size of the underlying data
+     */
+    template<typename S = Source>
+    auto size() -> decltype(std::declval<S&>().size()) {
+        return src.size();
+    }
+
+    /**
+     * Next chunk implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent bytes are counted
+     * 
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto next_chunk() -> decltype(std::declval<T&>().next_chunk()) {
+        auto res = src.next_chunk();
+        count += res.size();
+        return res;
+    }
+
+    /**
+     * Borrow read implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent bytes are counted
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        auto res = src.borrow_read(max);
+        count += res.size();
+        return res;
+    }
+
+    /**
+     * Positional read implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * bytes read this way are not counted
+     * 
+     * @param offset offset to read from
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Source>
+    auto read_at(size_t offset, span<char> span) -> decltype(std::declval<T&>().read_at(offset, span)) {
+        return src.read_at(offset, span);
+    }
+
     /**
      * Returns number of bytes read through this instance
      * 
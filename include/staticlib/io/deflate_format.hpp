@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   deflate_format.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 6:10 PM
+ */
+
+#ifndef STATICLIB_IO_DEFLATE_FORMAT_HPP
+#define STATICLIB_IO_DEFLATE_FORMAT_HPP
+
+#include <cstdint>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/checksum.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Framing of the DEFLATE (RFC 1951) compressed data
+ */
+enum class deflate_format {
+    /**
+     * Raw DEFLATE data without header and trailer
+     */
+    raw,
+    /**
+     * ZLIB format (RFC 1950), Adler-32 checksum in trailer
+     */
+    zlib,
+    /**
+     * GZIP format (RFC 1952), CRC-32 checksum in trailer,
+     * concatenated members are decompressed as a single stream
+     */
+    gzip
+};
+
+namespace detail_deflate {
+
+const size_t min_match = 3;
+const size_t max_match = 258;
+const size_t max_window_bits = 15;
+const size_t min_window_bits = 9;
+const size_t max_bits = 15;
+const size_t lit_codes = 286;
+const size_t dist_codes = 30;
+const size_t end_block = 256;
+
+inline const uint16_t* length_base() {
+    static const uint16_t arr[] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    return arr;
+}
+
+inline const uint8_t* length_extra() {
+    static const uint8_t arr[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+    return arr;
+}
+
+inline const uint16_t* dist_base() {
+    static const uint16_t arr[] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+    };
+    return arr;
+}
+
+inline const uint8_t* dist_extra() {
+    static const uint8_t arr[] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+    return arr;
+}
+
+// order of code length code lengths in dynamic block header
+inline const uint8_t* code_length_order() {
+    static const uint8_t arr[] = {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+    };
+    return arr;
+}
+
+/**
+ * Updates CRC-32 (ISO-HDLC, used in GZIP) checksum
+ * 
+ * @param crc current checksum value
+ * @param data data
+ * @param len data length
+ * @return updated checksum value
+ */
+inline uint32_t crc32_update(uint32_t crc, const unsigned char* data, size_t len) {
+    return detail_checksum::crc32_update(crc, data, len);
+}
+
+/**
+ * Updates Adler-32 (used in ZLIB) checksum
+ * 
+ * @param adler current checksum value
+ * @param data data
+ * @param len data length
+ * @return updated checksum value
+ */
+inline uint32_t adler32_update(uint32_t adler, const unsigned char* data, size_t len) {
+    return detail_checksum::adler32_update(adler, data, len);
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_DEFLATE_FORMAT_HPP */
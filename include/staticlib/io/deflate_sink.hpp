@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   deflate_sink.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 8:55 PM
+ */
+
+#ifndef STATICLIB_IO_DEFLATE_SINK_HPP
+#define STATICLIB_IO_DEFLATE_SINK_HPP
+
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/deflater.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink wrapper that compresses data using DEFLATE in raw, zlib or gzip
+ * format, compressed stream is completed on "finish" call or on destruction
+ */
+template<typename Sink>
+class deflate_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Compressor
+     */
+    detail_deflate::deflater deflater;
+    /**
+     * Whether compressed stream is completed
+     */
+    bool finished = false;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param format compressed data framing
+     * @param level compression level from 0 (no compression) to 9 (best compression)
+     * @param window_bits base two logarithm of the window size, from 9 to 15
+     * @throws io_exception on invalid parameters
+     */
+    explicit deflate_sink(Sink&& sink, deflate_format format = deflate_format::zlib,
+            int level = 6, int window_bits = 15) :
+    sink(std::move(sink)),
+    deflater(format, level, window_bits) { }
+
+    /**
+     * Destructor, completes compressed stream
+     */
+    ~deflate_sink() STATICLIB_NOEXCEPT {
+        try {
+            finish();
+        } catch(...) {
+            // ignore
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    deflate_sink(const deflate_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    deflate_sink& operator=(const deflate_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    deflate_sink(deflate_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    deflater(std::move(other.deflater)),
+    finished(other.finished) {
+        other.finished = true;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    deflate_sink& operator=(deflate_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        deflater = std::move(other.deflater);
+        finished = other.finished;
+        other.finished = true;
+        return *this;
+    }
+
+    /**
+     * Compressing write implementation, compressed blocks
+     * are written to the destination sink when they are complete
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        deflater.compress(span);
+        write_output();
+        return span.size_signed();
+    }
+
+    /**
+     * Compresses all pending data, so everything written so far
+     * can be decompressed on the receiving side (at the cost of
+     * the compression ratio), and flushes destination sink
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        deflater.sync_flush();
+        write_output();
+        return sink.flush();
+    }
+
+    /**
+     * Completes compressed stream and flushes destination sink,
+     * no-op if stream is already completed
+     */
+    void finish() {
+        if (finished) {
+            return;
+        }
+        finished = true;
+        deflater.finish();
+        write_output();
+        sink.flush();
+    }
+
+    /**
+     * Resets this sink to start the next compressed stream
+     * into the same destination sink, allocated buffers are reused
+     */
+    void reset() {
+        deflater.reset();
+        finished = false;
+    }
+
+    /**
+     * Resets this sink to start the compressed stream
+     * into the specified destination sink, allocated buffers are reused
+     * 
+     * @param dest new destination sink
+     */
+    void reset(Sink&& dest) {
+        sink = std::move(dest);
+        reset();
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+private:
+    void write_output() {
+        auto out = deflater.get_output();
+        if (out.size() > 0) {
+            write_all(sink, out);
+            deflater.clear_output();
+        }
+    }
+
+};
+
+/**
+ * Factory function for creating deflate sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param format compressed data framing
+ * @param level compression level from 0 (no compression) to 9 (best compression)
+ * @param window_bits base two logarithm of the window size, from 9 to 15
+ * @return deflate sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+deflate_sink<Sink> make_deflate_sink(Sink&& sink, deflate_format format = deflate_format::zlib,
+        int level = 6, int window_bits = 15) {
+    return deflate_sink<Sink>(std::move(sink), format, level, window_bits);
+}
+
+/**
+ * Factory function for creating deflate sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param format compressed data framing
+ * @param level compression level from 0 (no compression) to 9 (best compression)
+ * @param window_bits base two logarithm of the window size, from 9 to 15
+ * @return deflate sink
+ */
+template <typename Sink>
+deflate_sink<reference_sink<Sink>> make_deflate_sink(Sink& sink, deflate_format format = deflate_format::zlib,
+        int level = 6, int window_bits = 15) {
+    return deflate_sink<reference_sink<Sink>>(make_reference_sink(sink), format, level, window_bits);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_DEFLATE_SINK_HPP */
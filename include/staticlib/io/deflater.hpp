@@ -0,0 +1,914 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   deflater.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 6:40 PM
+ */
+
+#ifndef STATICLIB_IO_DEFLATER_HPP
+#define STATICLIB_IO_DEFLATER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_deflate {
+
+/**
+ * Builds Huffman code lengths limited to the specified number of bits,
+ * scratch buffers are kept between calls
+ */
+class huffman_builder {
+    std::vector<std::pair<uint32_t, uint16_t>> leaves;
+    std::vector<uint32_t> weights;
+    std::vector<uint16_t> parents;
+    std::vector<uint8_t> depths;
+
+public:
+    /**
+     * Computes code lengths for the specified symbol frequencies
+     * 
+     * @param freqs symbol frequencies
+     * @param count number of symbols
+     * @param lengths output code lengths
+     * @param limit max code length
+     */
+    void build(const uint32_t* freqs, size_t count, uint8_t* lengths, size_t limit) {
+        std::memset(lengths, 0, count);
+        leaves.clear();
+        for (size_t i = 0; i < count; i++) {
+            if (freqs[i] > 0) {
+                leaves.emplace_back(freqs[i], static_cast<uint16_t>(i));
+            }
+        }
+        if (leaves.empty()) {
+            return;
+        }
+        if (1 == leaves.size()) {
+            lengths[leaves.front().second] = 1;
+            return;
+        }
+        for (;;) {
+            std::sort(leaves.begin(), leaves.end());
+            if (build_depths() <= limit) {
+                break;
+            }
+            // flatten the distribution until the tree fits
+            for (auto& el : leaves) {
+                el.first = (el.first + 1) / 2;
+            }
+        }
+        for (size_t i = 0; i < leaves.size(); i++) {
+            lengths[leaves[i].second] = depths[i];
+        }
+    }
+
+private:
+    // two-queue Huffman construction over sorted leaves,
+    // internal nodes are created in non-decreasing weight order
+    size_t build_depths() {
+        size_t n = leaves.size();
+        size_t total = 2 * n - 1;
+        weights.resize(total);
+        parents.resize(total);
+        depths.resize(total);
+        for (size_t i = 0; i < n; i++) {
+            weights[i] = leaves[i].first;
+        }
+        size_t leaf = 0;
+        size_t inner = n;
+        for (size_t next = n; next < total; next++) {
+            size_t picked[2];
+            for (size_t k = 0; k < 2; k++) {
+                if (leaf < n && (inner >= next || weights[leaf] <= weights[inner])) {
+                    picked[k] = leaf++;
+                } else {
+                    picked[k] = inner++;
+                }
+            }
+            weights[next] = weights[picked[0]] + weights[picked[1]];
+            parents[picked[0]] = static_cast<uint16_t>(next);
+            parents[picked[1]] = static_cast<uint16_t>(next);
+        }
+        depths[total - 1] = 0;
+        size_t max_depth = 0;
+        for (size_t i = total - 1; i-- > 0;) {
+            depths[i] = static_cast<uint8_t>(depths[parents[i]] + 1);
+            if (i < n && depths[i] > max_depth) {
+                max_depth = depths[i];
+            }
+        }
+        return max_depth;
+    }
+};
+
+/**
+ * Streaming DEFLATE compressor, LZ77 with hash chains (greedy matching
+ * on levels 1-3 and lazy matching on levels 4-9) and stored, fixed or
+ * dynamic Huffman blocks, whichever is the smallest. Compressed data is
+ * appended to the output buffer that is owned by the compressor.
+ * All buffers are kept on "reset", so instances can be reused.
+ */
+class deflater {
+    // stored blocks max length
+    static const size_t max_stored = 65535;
+    static const size_t min_lookahead = max_match + min_match + 1;
+    static const size_t hash_bits = 15;
+    static const size_t hash_size = 1 << hash_bits;
+    static const size_t lit_bufsize = 1 << 14;
+    // matches of min length that are further than this are not worth it
+    static const size_t too_far = 4096;
+
+    deflate_format format;
+    int level;
+    size_t window_bits;
+    size_t wsize;
+    size_t max_dist;
+
+    // level configuration
+    size_t good_length;
+    size_t max_lazy;
+    size_t nice_length;
+    size_t max_chain;
+    bool lazy;
+
+    std::vector<unsigned char> window;
+    std::vector<uint16_t> head;
+    std::vector<uint16_t> prev;
+    size_t strstart = 0;
+    size_t lookahead = 0;
+    long block_start = 0;
+    size_t match_length = min_match - 1;
+    size_t match_start = 0;
+    size_t prev_length = min_match - 1;
+    bool match_available = false;
+
+    // pending symbols of the current block
+    std::vector<uint16_t> sym_lc;
+    std::vector<uint16_t> sym_dist;
+    std::array<uint32_t, lit_codes> lit_freq;
+    std::array<uint32_t, dist_codes> dist_freq;
+
+    std::array<uint8_t, max_match + 1> length_code;
+    std::array<uint8_t, 512> dist_code;
+
+    // block encoding scratch
+    huffman_builder builder;
+    // fixed codes include two unused symbols
+    std::array<uint8_t, lit_codes + 2> lit_len;
+    std::array<uint16_t, lit_codes + 2> lit_bits;
+    std::array<uint8_t, dist_codes> dist_len;
+    std::array<uint16_t, dist_codes> dist_bits;
+    std::vector<std::pair<uint8_t, uint8_t>> cl_syms;
+
+    std::vector<char> out;
+    size_t out_len = 0;
+    uint64_t bitbuf = 0;
+    size_t bitcnt = 0;
+
+    uint32_t checksum = 0;
+    uint32_t total_in = 0;
+    bool header_written = false;
+    bool finished = false;
+    bool dirty = false;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param format compressed data framing
+     * @param level compression level from 0 (no compression) to 9 (best compression)
+     * @param window_bits base two logarithm of the window size, from 9 to 15
+     * @throws io_exception on invalid parameters
+     */
+    deflater(deflate_format format, int level, int window_bits) :
+    format(format),
+    level(level),
+    window_bits(static_cast<size_t>(window_bits)) {
+        if (level < 0 || level > 9) throw io_exception(TRACEMSG(
+                "Invalid compression level specified, level: [" + sl::support::to_string(level) + "]"));
+        if (window_bits < static_cast<int>(min_window_bits) || window_bits > static_cast<int>(max_window_bits)) {
+            throw io_exception(TRACEMSG("Invalid window bits specified," +
+                    " window_bits: [" + sl::support::to_string(window_bits) + "]"));
+        }
+        static const uint16_t config[10][4] = {
+            // good, lazy, nice, chain
+            {0, 0, 0, 0},
+            {4, 4, 8, 4},
+            {4, 5, 16, 8},
+            {4, 6, 32, 32},
+            {4, 4, 16, 16},
+            {8, 16, 32, 32},
+            {8, 16, 128, 128},
+            {8, 32, 128, 256},
+            {32, 128, 258, 1024},
+            {32, 258, 258, 4096}
+        };
+        good_length = config[level][0];
+        max_lazy = config[level][1];
+        nice_length = config[level][2];
+        max_chain = config[level][3];
+        lazy = level >= 4;
+        wsize = static_cast<size_t>(1) << this->window_bits;
+        max_dist = wsize - min_lookahead;
+        // padding allows match comparisons to read past the data end
+        window.resize(2 * wsize + max_match);
+        if (level > 0) {
+            head.resize(hash_size);
+            prev.resize(wsize);
+            sym_lc.reserve(lit_bufsize);
+            sym_dist.reserve(lit_bufsize);
+        }
+        init_codes();
+        reset();
+    }
+
+    /**
+     * Resets the compressor to start a new stream, allocated buffers are kept
+     */
+    void reset() {
+        std::fill(head.begin(), head.end(), static_cast<uint16_t>(0));
+        strstart = 0;
+        lookahead = 0;
+        block_start = 0;
+        match_length = min_match - 1;
+        match_start = 0;
+        prev_length = min_match - 1;
+        match_available = false;
+        clear_block();
+        out_len = 0;
+        bitbuf = 0;
+        bitcnt = 0;
+        checksum = deflate_format::zlib == format ? 1 : 0;
+        total_in = 0;
+        header_written = false;
+        finished = false;
+        dirty = false;
+    }
+
+    /**
+     * Compresses specified data, compressed blocks are appended
+     * to the output buffer when they are complete
+     * 
+     * @param data input data
+     */
+    void compress(span<const char> data) {
+        if (finished) throw io_exception(TRACEMSG("Invalid write after the end of compressed stream"));
+        write_header();
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(data.data());
+        update_checksum(src, data.size());
+        total_in += static_cast<uint32_t>(data.size());
+        size_t idx = 0;
+        while (idx < data.size()) {
+            if (strstart >= wsize + max_dist) {
+                slide();
+            }
+            size_t free_space = 2 * wsize - strstart - lookahead;
+            size_t len = data.size() - idx < free_space ? data.size() - idx : free_space;
+            std::memcpy(window.data() + strstart + lookahead, src + idx, len);
+            lookahead += len;
+            idx += len;
+            dirty = true;
+            process(false);
+        }
+    }
+
+    /**
+     * Compresses all pending data and aligns the output to a byte
+     * boundary with an empty stored block, so all data written so far
+     * can be decompressed from the output
+     */
+    void sync_flush() {
+        if (finished || !dirty) {
+            return;
+        }
+        write_header();
+        process(true);
+        flush_block(false);
+        put_bits(0, 3);
+        align();
+        put_byte(0);
+        put_byte(0);
+        put_byte(0xff);
+        put_byte(0xff);
+        dirty = false;
+    }
+
+    /**
+     * Compresses all pending data and writes the final block and the trailer,
+     * "reset" must be called before compressing the next stream
+     */
+    void finish() {
+        if (finished) {
+            return;
+        }
+        write_header();
+        process(true);
+        flush_block(true);
+        align();
+        if (deflate_format::zlib == format) {
+            put_byte(checksum >> 24);
+            put_byte(checksum >> 16);
+            put_byte(checksum >> 8);
+            put_byte(checksum);
+        } else if (deflate_format::gzip == format) {
+            put_le32(checksum);
+            put_le32(total_in);
+        }
+        finished = true;
+    }
+
+    /**
+     * Compressed data accessor
+     * 
+     * @return compressed data that was not cleared yet
+     */
+    span<const char> get_output() const {
+        return span<const char>(out.data(), out_len);
+    }
+
+    /**
+     * Clears compressed data, output buffer is kept allocated
+     */
+    void clear_output() {
+        out_len = 0;
+    }
+
+    /**
+     * Checks whether the final block was written
+     * 
+     * @return true if stream is finished
+     */
+    bool is_finished() const {
+        return finished;
+    }
+
+private:
+    void init_codes() {
+        const uint16_t* lbase = length_base();
+        const uint8_t* lextra = length_extra();
+        for (size_t code = 0; code < 29; code++) {
+            size_t top = 28 == code ? lbase[code] : lbase[code] + (static_cast<size_t>(1) << lextra[code]) - 1;
+            for (size_t len = lbase[code]; len <= top && len <= max_match; len++) {
+                length_code[len] = static_cast<uint8_t>(code);
+            }
+        }
+        const uint16_t* dbase = dist_base();
+        const uint8_t* dextra = dist_extra();
+        for (size_t code = 0; code < dist_codes; code++) {
+            size_t first = dbase[code] - 1;
+            size_t last = first + (static_cast<size_t>(1) << dextra[code]) - 1;
+            for (size_t d = first; d <= last; d++) {
+                size_t idx = d < 256 ? d : 256 + (d >> 7);
+                dist_code[idx] = static_cast<uint8_t>(code);
+            }
+        }
+    }
+
+    uint8_t get_dist_code(size_t dist) const {
+        size_t d = dist - 1;
+        return dist_code[d < 256 ? d : 256 + (d >> 7)];
+    }
+
+    void write_header() {
+        if (header_written) {
+            return;
+        }
+        header_written = true;
+        if (deflate_format::zlib == format) {
+            unsigned cmf = static_cast<unsigned>(((window_bits - 8) << 4) | 8);
+            unsigned flevel = level < 2 ? 0 : level < 6 ? 1 : 6 == level ? 2 : 3;
+            unsigned flg = flevel << 6;
+            unsigned rem = (cmf * 256 + flg) % 31;
+            if (rem > 0) {
+                flg += 31 - rem;
+            }
+            put_byte(cmf);
+            put_byte(flg);
+        } else if (deflate_format::gzip == format) {
+            static const unsigned char header[] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0};
+            for (unsigned char b : header) {
+                put_byte(b);
+            }
+            put_byte(9 == level ? 2 : 1 == level ? 4 : 0);
+            // unknown OS
+            put_byte(0xff);
+        }
+    }
+
+    void update_checksum(const unsigned char* data, size_t len) {
+        if (deflate_format::zlib == format) {
+            checksum = adler32_update(checksum, data, len);
+        } else if (deflate_format::gzip == format) {
+            checksum = crc32_update(checksum, data, len);
+        }
+    }
+
+    void slide() {
+        std::memcpy(window.data(), window.data() + wsize, wsize);
+        match_start = match_start >= wsize ? match_start - wsize : 0;
+        strstart -= wsize;
+        block_start -= static_cast<long>(wsize);
+        for (auto& el : head) {
+            el = static_cast<uint16_t>(el >= wsize ? el - wsize : 0);
+        }
+        for (auto& el : prev) {
+            el = static_cast<uint16_t>(el >= wsize ? el - wsize : 0);
+        }
+    }
+
+    size_t insert_string(size_t pos) {
+        size_t h = ((static_cast<size_t>(window[pos]) << 10) ^
+                (static_cast<size_t>(window[pos + 1]) << 5) ^ window[pos + 2]) & (hash_size - 1);
+        size_t res = head[h];
+        prev[pos & (wsize - 1)] = static_cast<uint16_t>(res);
+        head[h] = static_cast<uint16_t>(pos);
+        return res;
+    }
+
+    size_t longest_match(size_t cur_match) {
+        size_t chain = max_chain;
+        size_t best_len = prev_length;
+        size_t nice = nice_length < lookahead ? nice_length : lookahead;
+        size_t limit = strstart > max_dist ? strstart - max_dist : 0;
+        size_t max_len = max_match < lookahead ? max_match : lookahead;
+        if (prev_length >= good_length) {
+            chain >>= 2;
+        }
+        const unsigned char* scan = window.data() + strstart;
+        do {
+            const unsigned char* match = window.data() + cur_match;
+            if (match[best_len] != scan[best_len] || match[0] != scan[0] || match[1] != scan[1]) {
+                continue;
+            }
+            size_t len = 2;
+            while (len < max_len && match[len] == scan[len]) {
+                len += 1;
+            }
+            if (len > best_len) {
+                match_start = cur_match;
+                best_len = len;
+                if (len >= nice) {
+                    break;
+                }
+            }
+        } while ((cur_match = prev[cur_match & (wsize - 1)]) > limit && --chain != 0);
+        return best_len <= lookahead ? best_len : lookahead;
+    }
+
+    bool tally_literal(unsigned char lit) {
+        sym_lc.push_back(lit);
+        sym_dist.push_back(0);
+        lit_freq[lit] += 1;
+        return sym_lc.size() == lit_bufsize - 1;
+    }
+
+    bool tally_match(size_t dist, size_t len) {
+        sym_lc.push_back(static_cast<uint16_t>(len));
+        sym_dist.push_back(static_cast<uint16_t>(dist));
+        lit_freq[257 + length_code[len]] += 1;
+        dist_freq[get_dist_code(dist)] += 1;
+        return sym_lc.size() == lit_bufsize - 1;
+    }
+
+    void process(bool flushing) {
+        if (0 == level) {
+            process_stored(flushing);
+        } else if (lazy) {
+            process_lazy(flushing);
+        } else {
+            process_greedy(flushing);
+        }
+    }
+
+    // without compression window is used as a plain buffer
+    void process_stored(bool flushing) {
+        if (lookahead == 2 * wsize || (flushing && lookahead > 0)) {
+            write_stored(window.data(), lookahead, false);
+            lookahead = 0;
+        }
+    }
+
+    void process_greedy(bool flushing) {
+        for (;;) {
+            if (lookahead < min_lookahead && (!flushing || 0 == lookahead)) {
+                break;
+            }
+            size_t hash_head = 0;
+            if (lookahead >= min_match) {
+                hash_head = insert_string(strstart);
+            }
+            match_length = 0;
+            if (0 != hash_head && strstart - hash_head <= max_dist) {
+                prev_length = min_match - 1;
+                match_length = longest_match(hash_head);
+            }
+            bool full;
+            if (match_length >= min_match) {
+                full = tally_match(strstart - match_start, match_length);
+                lookahead -= match_length;
+                if (match_length <= max_lazy && lookahead >= min_match) {
+                    match_length -= 1;
+                    do {
+                        strstart += 1;
+                        insert_string(strstart);
+                    } while (--match_length != 0);
+                    strstart += 1;
+                } else {
+                    strstart += match_length;
+                    match_length = 0;
+                }
+            } else {
+                full = tally_literal(window[strstart]);
+                lookahead -= 1;
+                strstart += 1;
+            }
+            if (full) {
+                flush_block(false);
+            }
+        }
+    }
+
+    void process_lazy(bool flushing) {
+        for (;;) {
+            if (lookahead < min_lookahead && (!flushing || 0 == lookahead)) {
+                break;
+            }
+            size_t hash_head = 0;
+            if (lookahead >= min_match) {
+                hash_head = insert_string(strstart);
+            }
+            prev_length = match_length;
+            size_t prev_match = match_start;
+            match_length = min_match - 1;
+            if (0 != hash_head && prev_length < max_lazy && strstart - hash_head <= max_dist) {
+                match_length = longest_match(hash_head);
+                if (min_match == match_length && strstart - match_start > too_far) {
+                    match_length = min_match - 1;
+                }
+            }
+            if (prev_length >= min_match && match_length <= prev_length) {
+                size_t max_insert = strstart + lookahead - min_match;
+                bool full = tally_match(strstart - 1 - prev_match, prev_length);
+                lookahead -= prev_length - 1;
+                prev_length -= 2;
+                do {
+                    strstart += 1;
+                    if (strstart <= max_insert) {
+                        insert_string(strstart);
+                    }
+                } while (--prev_length != 0);
+                match_available = false;
+                match_length = min_match - 1;
+                strstart += 1;
+                if (full) {
+                    flush_block(false);
+                }
+            } else if (match_available) {
+                if (tally_literal(window[strstart - 1])) {
+                    flush_block(false);
+                }
+                strstart += 1;
+                lookahead -= 1;
+            } else {
+                match_available = true;
+                strstart += 1;
+                lookahead -= 1;
+            }
+        }
+        if (flushing && match_available) {
+            tally_literal(window[strstart - 1]);
+            match_available = false;
+        }
+    }
+
+    void clear_block() {
+        sym_lc.clear();
+        sym_dist.clear();
+        lit_freq.fill(0);
+        dist_freq.fill(0);
+    }
+
+    void flush_block(bool last) {
+        if (0 == level) {
+            // all data is already written in "process_stored"
+            if (last) {
+                write_stored(nullptr, 0, true);
+            }
+            return;
+        }
+        lit_freq[end_block] = 1;
+        size_t stored_len = strstart - static_cast<size_t>(block_start > 0 ? block_start : 0);
+
+        // fixed codes cost
+        size_t extra_bits = 0;
+        for (size_t i = 0; i < 29; i++) {
+            extra_bits += lit_freq[257 + i] * length_extra()[i];
+        }
+        for (size_t i = 0; i < dist_codes; i++) {
+            extra_bits += dist_freq[i] * dist_extra()[i];
+        }
+        size_t fixed_cost = 3 + extra_bits;
+        for (size_t i = 0; i < lit_codes; i++) {
+            fixed_cost += lit_freq[i] * (i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8);
+        }
+        for (size_t i = 0; i < dist_codes; i++) {
+            fixed_cost += dist_freq[i] * 5;
+        }
+
+        // dynamic codes cost
+        builder.build(lit_freq.data(), lit_codes, lit_len.data(), max_bits);
+        builder.build(dist_freq.data(), dist_codes, dist_len.data(), max_bits);
+        complete_dist_lengths();
+        size_t hlit = lit_codes;
+        while (hlit > 257 && 0 == lit_len[hlit - 1]) hlit--;
+        size_t hdist = dist_codes;
+        while (hdist > 1 && 0 == dist_len[hdist - 1]) hdist--;
+        std::array<uint8_t, 19> cl_len;
+        size_t hclen = prepare_code_lengths(hlit, hdist, cl_len);
+        size_t dynamic_cost = 3 + 14 + 3 * hclen + extra_bits;
+        for (auto& el : cl_syms) {
+            dynamic_cost += cl_len[el.first] + (16 == el.first ? 2 : 17 == el.first ? 3 : 18 == el.first ? 7 : 0);
+        }
+        for (size_t i = 0; i < lit_codes; i++) {
+            dynamic_cost += lit_freq[i] * lit_len[i];
+        }
+        for (size_t i = 0; i < dist_codes; i++) {
+            dynamic_cost += dist_freq[i] * dist_len[i];
+        }
+
+        size_t stored_blocks = (stored_len + max_stored - 1) / max_stored;
+        size_t stored_cost = 0 == stored_blocks ? 3 + 7 + 32 : stored_blocks * (3 + 7 + 32) + stored_len * 8;
+        bool can_store = block_start >= 0;
+
+        if (can_store && stored_cost <= fixed_cost && stored_cost <= dynamic_cost) {
+            write_stored(window.data() + block_start, stored_len, last);
+        } else if (fixed_cost <= dynamic_cost) {
+            put_bits(last ? 3 : 2, 3);
+            set_fixed_codes();
+            write_symbols();
+        } else {
+            put_bits(last ? 5 : 4, 3);
+            write_dynamic_header(hlit, hdist, hclen, cl_len);
+            write_symbols();
+        }
+        block_start = static_cast<long>(strstart);
+        clear_block();
+    }
+
+    // distance tree must not be empty or have a single code
+    void complete_dist_lengths() {
+        size_t used = 0;
+        size_t first = 0;
+        for (size_t i = 0; i < dist_codes; i++) {
+            if (dist_len[i] > 0) {
+                if (0 == used) first = i;
+                used += 1;
+            }
+        }
+        if (used < 2) {
+            dist_len.fill(0);
+            dist_len[0] = 1;
+            dist_len[1 == used && 0 == first ? 1 : 1 == used ? first : 1] = 1;
+        }
+    }
+
+    size_t prepare_code_lengths(size_t hlit, size_t hdist, std::array<uint8_t, 19>& cl_len) {
+        std::array<uint8_t, lit_codes + dist_codes> lens;
+        std::memcpy(lens.data(), lit_len.data(), hlit);
+        std::memcpy(lens.data() + hlit, dist_len.data(), hdist);
+        size_t count = hlit + hdist;
+        cl_syms.clear();
+        size_t i = 0;
+        while (i < count) {
+            uint8_t cur = lens[i];
+            size_t run = 1;
+            while (i + run < count && lens[i + run] == cur) run++;
+            i += run;
+            if (0 == cur) {
+                while (run >= 11) {
+                    size_t r = run < 138 ? run : 138;
+                    cl_syms.emplace_back(18, static_cast<uint8_t>(r - 11));
+                    run -= r;
+                }
+                if (run >= 3) {
+                    cl_syms.emplace_back(17, static_cast<uint8_t>(run - 3));
+                    run = 0;
+                }
+            } else {
+                cl_syms.emplace_back(cur, 0);
+                run -= 1;
+                while (run >= 3) {
+                    size_t r = run < 6 ? run : 6;
+                    cl_syms.emplace_back(16, static_cast<uint8_t>(r - 3));
+                    run -= r;
+                }
+            }
+            while (run > 0) {
+                cl_syms.emplace_back(cur, 0);
+                run -= 1;
+            }
+        }
+        std::array<uint32_t, 19> cl_freq;
+        cl_freq.fill(0);
+        for (auto& el : cl_syms) {
+            cl_freq[el.first] += 1;
+        }
+        builder.build(cl_freq.data(), cl_freq.size(), cl_len.data(), 7);
+        size_t used = 0;
+        for (size_t j = 0; j < cl_len.size(); j++) {
+            if (cl_len[j] > 0) used += 1;
+        }
+        if (1 == used) {
+            // single code is incomplete, add a dummy one
+            cl_len[0 == cl_len[0] ? 0 : 1] = 1;
+        }
+        size_t hclen = 19;
+        while (hclen > 4 && 0 == cl_len[code_length_order()[hclen - 1]]) hclen--;
+        return hclen;
+    }
+
+    static void assign_codes(const uint8_t* lengths, uint16_t* codes, size_t count) {
+        std::array<uint16_t, max_bits + 1> bl_count;
+        bl_count.fill(0);
+        for (size_t i = 0; i < count; i++) {
+            bl_count[lengths[i]] += 1;
+        }
+        bl_count[0] = 0;
+        std::array<uint16_t, max_bits + 1> next_code;
+        uint16_t code = 0;
+        for (size_t bits = 1; bits <= max_bits; bits++) {
+            code = static_cast<uint16_t>((code + bl_count[bits - 1]) << 1);
+            next_code[bits] = code;
+        }
+        for (size_t i = 0; i < count; i++) {
+            size_t len = lengths[i];
+            if (0 == len) continue;
+            // codes are written starting from the most significant bit
+            uint16_t c = next_code[len]++;
+            uint16_t rev = 0;
+            for (size_t b = 0; b < len; b++) {
+                rev = static_cast<uint16_t>((rev << 1) | ((c >> b) & 1));
+            }
+            codes[i] = rev;
+        }
+    }
+
+    void set_fixed_codes() {
+        for (size_t i = 0; i < lit_len.size(); i++) {
+            lit_len[i] = static_cast<uint8_t>(i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8);
+        }
+        dist_len.fill(5);
+        assign_codes(lit_len.data(), lit_bits.data(), lit_len.size());
+        assign_codes(dist_len.data(), dist_bits.data(), dist_codes);
+    }
+
+    void write_dynamic_header(size_t hlit, size_t hdist, size_t hclen, const std::array<uint8_t, 19>& cl_len) {
+        std::array<uint16_t, 19> cl_bits;
+        assign_codes(cl_len.data(), cl_bits.data(), cl_len.size());
+        put_bits(hlit - 257, 5);
+        put_bits(hdist - 1, 5);
+        put_bits(hclen - 4, 4);
+        for (size_t i = 0; i < hclen; i++) {
+            put_bits(cl_len[code_length_order()[i]], 3);
+        }
+        for (auto& el : cl_syms) {
+            put_bits(cl_bits[el.first], cl_len[el.first]);
+            if (16 == el.first) {
+                put_bits(el.second, 2);
+            } else if (17 == el.first) {
+                put_bits(el.second, 3);
+            } else if (18 == el.first) {
+                put_bits(el.second, 7);
+            }
+        }
+        assign_codes(lit_len.data(), lit_bits.data(), lit_codes);
+        assign_codes(dist_len.data(), dist_bits.data(), dist_codes);
+    }
+
+    void write_symbols() {
+        const uint16_t* lbase = length_base();
+        const uint8_t* lextra = length_extra();
+        const uint16_t* dbase = dist_base();
+        const uint8_t* dextra = dist_extra();
+        for (size_t i = 0; i < sym_lc.size(); i++) {
+            size_t dist = sym_dist[i];
+            if (0 == dist) {
+                size_t lit = sym_lc[i];
+                put_bits(lit_bits[lit], lit_len[lit]);
+            } else {
+                size_t len = sym_lc[i];
+                size_t lcode = length_code[len];
+                put_bits(lit_bits[257 + lcode], lit_len[257 + lcode]);
+                put_bits(len - lbase[lcode], lextra[lcode]);
+                size_t dcode = get_dist_code(dist);
+                put_bits(dist_bits[dcode], dist_len[dcode]);
+                put_bits(dist - dbase[dcode], dextra[dcode]);
+            }
+        }
+        put_bits(lit_bits[end_block], lit_len[end_block]);
+    }
+
+    void write_stored(const unsigned char* data, size_t len, bool last) {
+        size_t offset = 0;
+        do {
+            size_t chunk = len - offset < max_stored ? len - offset : max_stored;
+            bool final_chunk = offset + chunk == len;
+            put_bits(last && final_chunk ? 1 : 0, 3);
+            align();
+            put_byte(chunk & 0xff);
+            put_byte(chunk >> 8);
+            put_byte(~chunk & 0xff);
+            put_byte((~chunk >> 8) & 0xff);
+            if (chunk > 0) {
+                reserve_output(chunk);
+                std::memcpy(out.data() + out_len, data + offset, chunk);
+                out_len += chunk;
+            }
+            offset += chunk;
+        } while (offset < len);
+    }
+
+    void put_bits(size_t value, size_t count) {
+        bitbuf |= static_cast<uint64_t>(value) << bitcnt;
+        bitcnt += count;
+        if (bitcnt >= 32) {
+            reserve_output(4);
+            char* dest = out.data() + out_len;
+            dest[0] = static_cast<char>(bitbuf & 0xff);
+            dest[1] = static_cast<char>((bitbuf >> 8) & 0xff);
+            dest[2] = static_cast<char>((bitbuf >> 16) & 0xff);
+            dest[3] = static_cast<char>((bitbuf >> 24) & 0xff);
+            out_len += 4;
+            bitbuf >>= 32;
+            bitcnt -= 32;
+        }
+    }
+
+    void align() {
+        while (bitcnt > 0) {
+            put_byte(static_cast<size_t>(bitbuf & 0xff));
+            bitbuf >>= 8;
+            bitcnt = bitcnt > 8 ? bitcnt - 8 : 0;
+        }
+        bitbuf = 0;
+    }
+
+    void put_byte(size_t value) {
+        // only used on byte boundary
+        reserve_output(1);
+        out[out_len] = static_cast<char>(value & 0xff);
+        out_len += 1;
+    }
+
+    void reserve_output(size_t len) {
+        if (out_len + len > out.size()) {
+            size_t doubled = out.size() * 2;
+            size_t required = out_len + len + 4096;
+            out.resize(doubled > required ? doubled : required);
+        }
+    }
+
+    void put_le32(uint32_t value) {
+        put_byte(value);
+        put_byte(value >> 8);
+        put_byte(value >> 16);
+        put_byte(value >> 24);
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_DEFLATER_HPP */
@@ -0,0 +1,244 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   digest_sink.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:20 AM
+ */
+#ifndef STATICLIB_IO_DIGEST_SINK_HPP
+#define STATICLIB_IO_DIGEST_SINK_HPP
+
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink wrapper that computes cryptographic digest (for example,
+ * "sha256" or "blake3") of the data written through it
+ */
+template<typename Digest, typename Sink>
+class digest_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Digest state
+     */
+    Digest digest;
+    /**
+     * Computed digest, empty until "get_digest" is called
+     */
+    std::string result;
+    /**
+     * Start of the span lent by the last "prepare" call
+     */
+    const char* prepared = nullptr;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param digest digest state
+     */
+    digest_sink(Sink&& sink, Digest&& digest) :
+    sink(std::move(sink)),
+    digest(std::move(digest)) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    digest_sink(const digest_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    digest_sink& operator=(const digest_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    digest_sink(digest_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    digest(std::move(other.digest)),
+    result(std::move(other.result)),
+    prepared(other.prepared) {
+        other.prepared = nullptr;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    digest_sink& operator=(digest_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        digest = std::move(other.digest);
+        result = std::move(other.result);
+        prepared = other.prepared;
+        other.prepared = nullptr;
+        return *this;
+    }
+
+    /**
+     * Digesting write implementation,
+     * only the bytes accepted by destination sink are digested
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     * @throws io_exception if digest was already computed
+     */
+    std::streamsize write(span<const char> span) {
+        check_open();
+        std::streamsize res = sink.write(span);
+        if (res > 0) {
+            digest.update(io::span<const char>(span.data(), static_cast<size_t>(res)));
+        }
+        return res;
+    }
+
+    /**
+     * Prepare implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param min min number of bytes required
+     * @return span lent by the underlying sink
+     * @throws io_exception if digest was already computed
+     */
+    template<typename T = Sink>
+    auto prepare(size_t min) -> decltype(std::declval<T&>().prepare(min)) {
+        check_open();
+        auto res = sink.prepare(min);
+        prepared = res.data();
+        return res;
+    }
+
+    /**
+     * Commit implementation delegated to the underlying sink,
+     * available only if underlying sink implements it,
+     * committed bytes are digested
+     * 
+     * @param count number of bytes written
+     */
+    template<typename T = Sink>
+    auto commit(size_t count) -> decltype(std::declval<T&>().commit(count), void()) {
+        if (count > 0) {
+            digest.update(span<const char>(prepared, count));
+        }
+        sink.commit(count);
+    }
+
+    /**
+     * Flushes destination sink
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        return sink.flush();
+    }
+
+    /**
+     * Completes digest computation on the first call, writes
+     * are not allowed after that until "reset_digest" is called
+     * 
+     * @return digest bytes, use "string_to_hex" to get hex form
+     */
+    const std::string& get_digest() {
+        if (result.empty()) {
+            result = digest.digest();
+        }
+        return result;
+    }
+
+    /**
+     * Resets digest computation to start from the current position
+     */
+    void reset_digest() {
+        digest.reset();
+        result.clear();
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+private:
+    void check_open() {
+        if (!result.empty()) throw io_exception(TRACEMSG("Invalid write after the digest was computed"));
+    }
+
+};
+
+/**
+ * Factory function for creating digest sinks,
+ * created sink wrapper will own specified sink,
+ * usage: "make_digest_sink<sl::io::sha256>(std::move(sink))"
+ * 
+ * @param sink destination sink
+ * @param digest digest state
+ * @return digest sink
+ */
+template <typename Digest, typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+digest_sink<Digest, Sink> make_digest_sink(Sink&& sink, Digest digest = Digest()) {
+    return digest_sink<Digest, Sink>(std::move(sink), std::move(digest));
+}
+
+/**
+ * Factory function for creating digest sinks,
+ * created sink wrapper will NOT own specified sink,
+ * usage: "make_digest_sink<sl::io::sha256>(sink)"
+ * 
+ * @param sink destination sink
+ * @param digest digest state
+ * @return digest sink
+ */
+template <typename Digest, typename Sink>
+digest_sink<Digest, reference_sink<Sink>> make_digest_sink(Sink& sink, Digest digest = Digest()) {
+    return digest_sink<Digest, reference_sink<Sink>>(make_reference_sink(sink), std::move(digest));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_DIGEST_SINK_HPP */
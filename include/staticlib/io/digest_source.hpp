@@ -0,0 +1,301 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   digest_source.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:45 AM
+ */
+#ifndef STATICLIB_IO_DIGEST_SOURCE_HPP
+#define STATICLIB_IO_DIGEST_SOURCE_HPP
+
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source wrapper that computes cryptographic digest (for example,
+ * "sha256" or "blake3") of the data read through it. In verify mode
+ * digest is compared with the expected value when EOF is reached
+ * and exception is thrown on mismatch.
+ */
+template<typename Digest, typename Source>
+class digest_source {
+    /**
+     * Input source
+     */
+    Source src;
+    /**
+     * Digest state
+     */
+    Digest digest;
+    /**
+     * Computed digest, empty until EOF in verify mode or "get_digest" call
+     */
+    std::string result;
+    /**
+     * Expected digest bytes, empty if digest is not verified
+     */
+    std::string expected;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param digest digest state
+     */
+    digest_source(Source&& src, Digest&& digest) :
+    src(std::move(src)),
+    digest(std::move(digest)) { }
+
+    /**
+     * Constructor for verify mode,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param digest digest state
+     * @param expected expected digest bytes of all the data in the source
+     */
+    digest_source(Source&& src, Digest&& digest, std::string expected) :
+    src(std::move(src)),
+    digest(std::move(digest)),
+    expected(std::move(expected)) {
+        if (this->expected.empty()) throw io_exception(TRACEMSG("Invalid empty expected digest specified"));
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    digest_source(const digest_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    digest_source& operator=(const digest_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    digest_source(digest_source&& other) STATICLIB_NOEXCEPT :
+    src(std::move(other.src)),
+    digest(std::move(other.digest)),
+    result(std::move(other.result)),
+    expected(std::move(other.expected)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    digest_source& operator=(digest_source&& other) STATICLIB_NOEXCEPT {
+        src = std::move(other.src);
+        digest = std::move(other.digest);
+        result = std::move(other.result);
+        expected = std::move(other.expected);
+        return *this;
+    }
+
+    /**
+     * Digesting read implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     * @throws io_exception in verify mode on digest mismatch at EOF
+     */
+    std::streamsize read(span<char> span) {
+        std::streamsize res = src.read(span);
+        if (res > 0) {
+            update(span.data(), static_cast<size_t>(res));
+        } else if (std::char_traits<char>::eof() == res) {
+            check();
+        }
+        return res;
+    }
+
+    /**
+     * Next chunk implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent bytes are digested
+     * 
+     * @return span over the data lent by the underlying source
+     * @throws io_exception in verify mode on digest mismatch at EOF
+     */
+    template<typename T = Source>
+    auto next_chunk() -> decltype(std::declval<T&>().next_chunk()) {
+        auto res = src.next_chunk();
+        if (res.size() > 0) {
+            update(res.data(), res.size());
+        } else {
+            check();
+        }
+        return res;
+    }
+
+    /**
+     * Borrow read implementation delegated to the underlying source,
+     * available only if underlying source implements it,
+     * lent bytes are digested
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     * @throws io_exception in verify mode on digest mismatch at EOF
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        auto res = src.borrow_read(max);
+        if (res.size() > 0) {
+            update(res.data(), res.size());
+        } else if (max > 0) {
+            check();
+        }
+        return res;
+    }
+
+    /**
+     * Completes digest computation on the first call, reads
+     * are not allowed after that until "reset_digest" is called
+     * 
+     * @return digest bytes, use "string_to_hex" to get hex form
+     */
+    const std::string& get_digest() {
+        if (result.empty()) {
+            result = digest.digest();
+        }
+        return result;
+    }
+
+    /**
+     * Resets digest computation to start from the current position
+     */
+    void reset_digest() {
+        digest.reset();
+        result.clear();
+    }
+
+    /**
+     * Underlying source accessor
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return src;
+    }
+
+private:
+    void update(const char* data, size_t len) {
+        if (!result.empty()) throw io_exception(TRACEMSG("Invalid read after the digest was computed"));
+        digest.update(span<const char>(data, len));
+    }
+
+    void check() {
+        if (expected.empty()) {
+            return;
+        }
+        const std::string& actual = get_digest();
+        if (expected != actual) throw io_exception(TRACEMSG("Digest mismatch," +
+                " expected: [" + string_to_hex(expected) + "]," +
+                " actual: [" + string_to_hex(actual) + "]"));
+    }
+
+};
+
+/**
+ * Factory function for creating digest sources,
+ * created source wrapper will own specified source,
+ * usage: "make_digest_source<sl::io::sha256>(std::move(src))"
+ * 
+ * @param source input source
+ * @param digest digest state
+ * @return digest source
+ */
+template <typename Digest, typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+digest_source<Digest, Source> make_digest_source(Source&& source, Digest digest = Digest()) {
+    return digest_source<Digest, Source>(std::move(source), std::move(digest));
+}
+
+/**
+ * Factory function for creating digest sources,
+ * created source wrapper will NOT own specified source,
+ * usage: "make_digest_source<sl::io::sha256>(src)"
+ * 
+ * @param source input source
+ * @param digest digest state
+ * @return digest source
+ */
+template <typename Digest, typename Source>
+digest_source<Digest, reference_source<Source>> make_digest_source(Source& source, Digest digest = Digest()) {
+    return digest_source<Digest, reference_source<Source>>(make_reference_source(source), std::move(digest));
+}
+
+/**
+ * Factory function for creating digest sources in verify mode,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param expected expected digest bytes of all the data in the source
+ * @param digest digest state
+ * @return digest source
+ */
+template <typename Digest, typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+digest_source<Digest, Source> make_digest_verify_source(Source&& source, std::string expected,
+        Digest digest = Digest()) {
+    return digest_source<Digest, Source>(std::move(source), std::move(digest), std::move(expected));
+}
+
+/**
+ * Factory function for creating digest sources in verify mode,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param expected expected digest bytes of all the data in the source
+ * @param digest digest state
+ * @return digest source
+ */
+template <typename Digest, typename Source>
+digest_source<Digest, reference_source<Source>> make_digest_verify_source(Source& source, std::string expected,
+        Digest digest = Digest()) {
+    return digest_source<Digest, reference_source<Source>>(make_reference_source(source), std::move(digest),
+            std::move(expected));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_DIGEST_SOURCE_HPP */
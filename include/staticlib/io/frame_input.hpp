@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   frame_input.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:40 PM
+ */
+
+#ifndef STATICLIB_IO_FRAME_INPUT_HPP
+#define STATICLIB_IO_FRAME_INPUT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_frame {
+
+/**
+ * Input buffer for the decompressors of framed formats,
+ * compressed data is read from the source in chunks
+ */
+class input_buffer {
+    std::vector<char> buffer;
+    size_t pos = 0;
+    size_t end = 0;
+    bool exhausted = false;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param size buffer size
+     */
+    explicit input_buffer(size_t size) :
+    buffer(size) { }
+
+    /**
+     * Discards buffered data
+     */
+    void clear() {
+        pos = 0;
+        end = 0;
+        exhausted = false;
+    }
+
+    /**
+     * Checks whether more data is available, reads the source if buffer is empty
+     * 
+     * @param src input source
+     * @return true if more data is available, false on source EOF
+     */
+    template<typename Source>
+    bool has_more(Source& src) {
+        return pos < end || fill(src);
+    }
+
+    /**
+     * Reads exactly specified number of bytes
+     * 
+     * @param src input source
+     * @param dest destination buffer
+     * @param len number of bytes to read
+     * @throws io_exception if source ends prematurely
+     */
+    template<typename Source>
+    void read_exact(Source& src, char* dest, size_t len) {
+        while (len > 0) {
+            if (pos == end && !fill(src)) {
+                throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+            }
+            size_t chunk = end - pos <= len ? end - pos : len;
+            std::memcpy(dest, buffer.data() + pos, chunk);
+            pos += chunk;
+            dest += chunk;
+            len -= chunk;
+        }
+    }
+
+    /**
+     * Skips exactly specified number of bytes
+     * 
+     * @param src input source
+     * @param len number of bytes to skip
+     * @throws io_exception if source ends prematurely
+     */
+    template<typename Source>
+    void skip(Source& src, size_t len) {
+        while (len > 0) {
+            if (pos == end && !fill(src)) {
+                throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+            }
+            size_t chunk = end - pos <= len ? end - pos : len;
+            pos += chunk;
+            len -= chunk;
+        }
+    }
+
+    /**
+     * Reads little-endian unsigned integer
+     * 
+     * @param src input source
+     * @param len integer length in bytes, up to 8
+     * @return integer value
+     */
+    template<typename Source>
+    uint64_t read_le(Source& src, size_t len) {
+        unsigned char bytes[8];
+        read_exact(src, reinterpret_cast<char*>(bytes), len);
+        uint64_t res = 0;
+        for (size_t i = len; i > 0; i--) {
+            res = (res << 8) | bytes[i - 1];
+        }
+        return res;
+    }
+
+private:
+    template<typename Source>
+    bool fill(Source& src) {
+        while (!exhausted) {
+            std::streamsize amt = src.read({buffer.data(), buffer.size()});
+            if (std::char_traits<char>::eof() == amt) {
+                exhausted = true;
+            } else if (amt > 0) {
+                if (!sl::support::is_sizet(amt) || static_cast<size_t>(amt) > buffer.size()) throw io_exception(TRACEMSG(
+                        "Invalid result returned by underlying 'read' operation: [" + sl::support::to_string(amt) + "]"));
+                pos = 0;
+                end = static_cast<size_t>(amt);
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_FRAME_INPUT_HPP */
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   framed_format.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 7:20 AM
+ */
+#ifndef STATICLIB_IO_FRAMED_FORMAT_HPP
+#define STATICLIB_IO_FRAMED_FORMAT_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/byte_order.hpp"
+#include "staticlib/io/io_exception.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * How frames are separated in the stream
+ */
+enum class frame_format {
+    /**
+     * 4 bytes big-endian length before each frame
+     */
+    length_be32,
+    /**
+     * 4 bytes little-endian length before each frame
+     */
+    length_le32,
+    /**
+     * Unsigned LEB128 varint length (as in protobuf) before each frame
+     */
+    length_varint,
+    /**
+     * Delimiter byte after each frame, frames must not contain it
+     */
+    delimited
+};
+
+/**
+ * Options of the stream framing
+ */
+struct frame_options {
+    /**
+     * Frame format
+     */
+    frame_format format = frame_format::length_be32;
+    /**
+     * Delimiter byte, used only with "delimited" format
+     */
+    char delimiter = '\n';
+    /**
+     * Max size of the frame payload, larger frames are rejected,
+     * payload of the buffered frame is held in memory
+     */
+    size_t max_frame_size = 1 << 24;
+};
+
+namespace detail_framed {
+
+const size_t max_prefix_len = detail_byte_order::max_varint_len;
+
+inline std::string format_name(frame_format format) {
+    switch (format) {
+    case frame_format::length_be32: return "length_be32";
+    case frame_format::length_le32: return "length_le32";
+    case frame_format::length_varint: return "length_varint";
+    case frame_format::delimited: return "delimited";
+    default: return "unknown";
+    }
+}
+
+inline void check_length(const frame_options& options, uint64_t length) {
+    if (length > options.max_frame_size) throw io_exception(TRACEMSG(
+            "Frame size: [" + sl::support::to_string(length) + "]" +
+            " exceeds max frame size: [" + sl::support::to_string(options.max_frame_size) + "]"));
+}
+
+// writes length prefix into "out", returns prefix length, zero for delimited frames
+inline size_t encode_prefix(frame_format format, uint64_t length, char* out) {
+    switch (format) {
+    case frame_format::length_be32:
+    case frame_format::length_le32:
+        if (length > 0xffffffff) throw io_exception(TRACEMSG(
+                "Frame size: [" + sl::support::to_string(length) + "]" +
+                " does not fit into 32-bit length prefix"));
+        detail_byte_order::store(out, static_cast<uint32_t>(length), frame_format::length_le32 == format);
+        return 4;
+    case frame_format::length_varint:
+        return detail_byte_order::encode_varint(length, out);
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_FRAMED_FORMAT_HPP */
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   framed_sink.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 7:40 AM
+ */
+#ifndef STATICLIB_IO_FRAMED_SINK_HPP
+#define STATICLIB_IO_FRAMED_SINK_HPP
+
+#include <cstring>
+#include <ios>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/framed_format.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_framed {
+
+// frames up to this size are copied next to the prefix and written at once
+const size_t gather_max = 1 << 14;
+
+} // namespace
+
+/**
+ * Sink wrapper that writes data as a sequence of frames (messages),
+ * each frame is preceded by its length or followed by a delimiter.
+ * Each "write" call writes a single frame.
+ */
+template<typename Sink>
+class framed_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Framing options
+     */
+    frame_options options;
+    /**
+     * Buffer for writing prefix and payload of small frames at once
+     */
+    std::vector<char> gather;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param options framing options
+     */
+    framed_sink(Sink&& sink, frame_options options) :
+    sink(std::move(sink)),
+    options(options) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    framed_sink(const framed_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    framed_sink& operator=(const framed_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    framed_sink(framed_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    options(other.options),
+    gather(std::move(other.gather)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    framed_sink& operator=(framed_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        options = other.options;
+        gather = std::move(other.gather);
+        return *this;
+    }
+
+    /**
+     * Writes specified data as a single frame
+     * 
+     * @param span frame payload
+     * @return number of bytes processed, always the size of the payload
+     * @throws io_exception if frame is too large or contains the delimiter
+     */
+    std::streamsize write(span<const char> span) {
+        write_frame(span);
+        return static_cast<std::streamsize>(span.size());
+    }
+
+    /**
+     * Writes a single frame, prefix and payload of small frames
+     * are written with a single write call to the destination sink
+     * 
+     * @param payload frame payload
+     * @throws io_exception if frame is too large or contains the delimiter
+     */
+    void write_frame(span<const char> payload) {
+        detail_framed::check_length(options, payload.size());
+        bool delimited = frame_format::delimited == options.format;
+        if (delimited && payload.size() > 0 &&
+                nullptr != std::memchr(payload.data(), options.delimiter, payload.size())) {
+            throw io_exception(TRACEMSG("Frame payload contains delimiter," +
+                    " payload size: [" + sl::support::to_string(payload.size()) + "]"));
+        }
+        char prefix[detail_framed::max_prefix_len];
+        size_t prefix_len = detail_framed::encode_prefix(options.format, payload.size(), prefix);
+        size_t suffix_len = delimited ? 1 : 0;
+        if (payload.size() <= detail_framed::gather_max) {
+            gather.resize(prefix_len + payload.size() + suffix_len);
+            std::memcpy(gather.data(), prefix, prefix_len);
+            if (payload.size() > 0) {
+                std::memcpy(gather.data() + prefix_len, payload.data(), payload.size());
+            }
+            if (delimited) {
+                gather.back() = options.delimiter;
+            }
+            write_all(sink, {gather.data(), gather.size()});
+        } else {
+            write_all(sink, {prefix, prefix_len});
+            write_all(sink, payload);
+            if (delimited) {
+                write_all(sink, {std::addressof(options.delimiter), 1});
+            }
+        }
+    }
+
+    /**
+     * Writes the length prefix of the frame, payload must be written
+     * to the underlying sink after this call, can be used to stream large
+     * frames, not available for delimited frames. Frame is not limited
+     * by "max_frame_size", such frames can be read with
+     * "framed_source::frame_payload_source".
+     * 
+     * @param length length of the frame payload
+     * @throws io_exception if length does not fit into the prefix or format is "delimited"
+     */
+    void write_frame_header(size_t length) {
+        if (frame_format::delimited == options.format) throw io_exception(TRACEMSG(
+                "Frame header is not available for format: [" + detail_framed::format_name(options.format) + "]"));
+        char prefix[detail_framed::max_prefix_len];
+        size_t prefix_len = detail_framed::encode_prefix(options.format, length, prefix);
+        write_all(sink, {prefix, prefix_len});
+    }
+
+    /**
+     * Flushes destination sink
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        return sink.flush();
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+};
+
+/**
+ * Factory function for creating framed sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param options framing options
+ * @return framed sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+framed_sink<Sink> make_framed_sink(Sink&& sink, frame_options options = frame_options()) {
+    return framed_sink<Sink>(std::move(sink), options);
+}
+
+/**
+ * Factory function for creating framed sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param options framing options
+ * @return framed sink
+ */
+template <typename Sink>
+framed_sink<reference_sink<Sink>> make_framed_sink(Sink& sink, frame_options options = frame_options()) {
+    return framed_sink<reference_sink<Sink>>(make_reference_sink(sink), options);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_FRAMED_SINK_HPP */
@@ -0,0 +1,452 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   framed_source.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 8:10 AM
+ */
+#ifndef STATICLIB_IO_FRAMED_SOURCE_HPP
+#define STATICLIB_IO_FRAMED_SOURCE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/byte_order.hpp"
+#include "staticlib/io/framed_format.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/limited_source.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_framed {
+
+const size_t initial_buffer_size = 1 << 13;
+
+/**
+ * Input of the framed source, reads ahead from the underlying
+ * source into the reusable buffer, buffered data is served first
+ */
+template<typename Source>
+class frame_reader {
+    Source src;
+    std::vector<char> buf;
+    size_t begin = 0;
+    size_t end = 0;
+    uint64_t consumed = 0;
+    bool exhausted = false;
+
+public:
+    explicit frame_reader(Source&& src) :
+    src(std::move(src)) { }
+
+    frame_reader(const frame_reader&) = delete;
+
+    frame_reader& operator=(const frame_reader&) = delete;
+
+    frame_reader(frame_reader&& other) STATICLIB_NOEXCEPT :
+    src(std::move(other.src)),
+    buf(std::move(other.buf)),
+    begin(other.begin),
+    end(other.end),
+    consumed(other.consumed),
+    exhausted(other.exhausted) { }
+
+    frame_reader& operator=(frame_reader&& other) STATICLIB_NOEXCEPT {
+        src = std::move(other.src);
+        buf = std::move(other.buf);
+        begin = other.begin;
+        end = other.end;
+        consumed = other.consumed;
+        exhausted = other.exhausted;
+        return *this;
+    }
+
+    std::streamsize read(span<char> span) {
+        if (end > begin) {
+            size_t len = span.size() < end - begin ? span.size() : end - begin;
+            std::memcpy(span.data(), buf.data() + begin, len);
+            consume(len);
+            return static_cast<std::streamsize>(len);
+        }
+        if (exhausted) {
+            return std::char_traits<char>::eof();
+        }
+        std::streamsize res = src.read(span);
+        if (res > 0) {
+            consumed += static_cast<uint64_t>(res);
+        } else if (std::char_traits<char>::eof() == res) {
+            exhausted = true;
+        }
+        return res;
+    }
+
+    void skip(size_t to_skip) {
+        size_t from_buf = to_skip < end - begin ? to_skip : end - begin;
+        consume(from_buf);
+        if (to_skip > from_buf) {
+            io::skip(src, to_skip - from_buf);
+            consumed += to_skip - from_buf;
+        }
+    }
+
+    // makes "count" bytes available in buffer, returns false on EOF
+    bool fill(size_t count) {
+        while (end - begin < count) {
+            if (exhausted) {
+                return false;
+            }
+            if (buf.size() - begin < count) {
+                if (end > begin) {
+                    std::memmove(buf.data(), buf.data() + begin, end - begin);
+                }
+                end -= begin;
+                begin = 0;
+                if (buf.size() < count) {
+                    size_t grown = buf.size() > 0 ? buf.size() * 2 : initial_buffer_size;
+                    buf.resize(grown > count ? grown : count);
+                }
+            }
+            std::streamsize res = src.read({buf.data() + end, buf.size() - end});
+            if (std::char_traits<char>::eof() == res) {
+                exhausted = true;
+            } else if (res > 0) {
+                end += static_cast<size_t>(res);
+            }
+        }
+        return true;
+    }
+
+    const char* data() const {
+        return buf.data() + begin;
+    }
+
+    size_t available() const {
+        return end - begin;
+    }
+
+    void consume(size_t count) {
+        begin += count;
+        consumed += count;
+    }
+
+    uint64_t get_consumed() const {
+        return consumed;
+    }
+
+    Source& get_source() {
+        return src;
+    }
+};
+
+} // namespace
+
+/**
+ * Source wrapper that reads data written by "framed_sink" as a sequence
+ * of frames (messages), each frame is returned as a span over the internal
+ * buffer, that is reused between frames. Large frames can be read as
+ * a sub-stream without buffering them.
+ */
+template<typename Source>
+class framed_source {
+    /**
+     * Buffered input
+     */
+    detail_framed::frame_reader<Source> reader;
+    /**
+     * Framing options
+     */
+    frame_options options;
+    /**
+     * Input position of the end of the current frame
+     */
+    uint64_t frame_end = 0;
+    /**
+     * Payload of the current frame
+     */
+    span<const char> frame;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param options framing options
+     */
+    framed_source(Source&& src, frame_options options) :
+    reader(std::move(src)),
+    options(options),
+    frame(nullptr, 0) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    framed_source(const framed_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    framed_source& operator=(const framed_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    framed_source(framed_source&& other) STATICLIB_NOEXCEPT :
+    reader(std::move(other.reader)),
+    options(other.options),
+    frame_end(other.frame_end),
+    frame(other.frame) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    framed_source& operator=(framed_source&& other) STATICLIB_NOEXCEPT {
+        reader = std::move(other.reader);
+        options = other.options;
+        frame_end = other.frame_end;
+        frame = other.frame;
+        return *this;
+    }
+
+    /**
+     * Reads the next frame, unread part of the previous frame is skipped,
+     * frame payload can be accessed using "get_frame"
+     * 
+     * @return false on the end of stream, true otherwise
+     * @throws io_exception if frame is too large or stream ends inside a frame
+     */
+    bool next_frame() {
+        if (frame_format::delimited == options.format) {
+            return next_delimited();
+        }
+        size_t length = 0;
+        if (!next_frame_header(length)) {
+            return false;
+        }
+        frame_payload();
+        return true;
+    }
+
+    /**
+     * Returns the payload of the frame read by "next_frame"
+     * or "frame_payload"
+     * 
+     * @return span over the frame payload, valid until the next call
+     *         to any other method of this instance
+     */
+    span<const char> get_frame() const {
+        return frame;
+    }
+
+    /**
+     * Reads the length prefix of the next frame, unread part of the previous
+     * frame is skipped, payload can be read then using "frame_payload" or
+     * "frame_payload_source", not available for delimited frames
+     * 
+     * @param length length of the frame payload
+     * @return false on the end of stream, true otherwise
+     * @throws io_exception on invalid prefix or if format is "delimited"
+     */
+    bool next_frame_header(size_t& length) {
+        if (frame_format::delimited == options.format) throw io_exception(TRACEMSG(
+                "Frame header is not available for format: [" + detail_framed::format_name(options.format) + "]"));
+        skip_rest();
+        frame = span<const char>(nullptr, 0);
+        uint64_t value = 0;
+        if (frame_format::length_varint == options.format) {
+            if (!read_varint(value)) {
+                return false;
+            }
+        } else {
+            if (!reader.fill(4)) {
+                check_boundary();
+                return false;
+            }
+            value = detail_byte_order::load<uint32_t>(reader.data(), frame_format::length_le32 == options.format);
+            reader.consume(4);
+        }
+        if (value > std::numeric_limits<size_t>::max()) throw io_exception(TRACEMSG(
+                "Invalid frame size: [" + sl::support::to_string(value) + "]"));
+        length = static_cast<size_t>(value);
+        frame_end = reader.get_consumed() + value;
+        return true;
+    }
+
+    /**
+     * Reads the (rest of) payload of the frame opened with "next_frame_header"
+     * 
+     * @return span over the frame payload, valid until the next call
+     *         to any method of this instance
+     * @throws io_exception if frame is too large or stream ends inside a frame
+     */
+    span<const char> frame_payload() {
+        size_t remaining = static_cast<size_t>(frame_end - reader.get_consumed());
+        detail_framed::check_length(options, remaining);
+        if (!reader.fill(remaining)) throw io_exception(TRACEMSG(
+                "Unexpected end of stream inside the frame," +
+                " frame size: [" + sl::support::to_string(remaining) + "]," +
+                " bytes available: [" + sl::support::to_string(reader.available()) + "]"));
+        frame = span<const char>(reader.data(), remaining);
+        reader.consume(remaining);
+        return frame;
+    }
+
+    /**
+     * Returns the (rest of) payload of the frame opened with "next_frame_header"
+     * as a source, frame is not buffered and is not limited by "max_frame_size",
+     * returned source must not be used after the next call to any method of this instance
+     * 
+     * @return source over the frame payload
+     */
+    limited_source<reference_source<detail_framed::frame_reader<Source>>> frame_payload_source() {
+        size_t remaining = static_cast<size_t>(frame_end - reader.get_consumed());
+        return make_limited_source(reader, remaining);
+    }
+
+    /**
+     * Underlying source accessor
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return reader.get_source();
+    }
+
+private:
+    void skip_rest() {
+        uint64_t pos = reader.get_consumed();
+        if (frame_end > pos) {
+            reader.skip(static_cast<size_t>(frame_end - pos));
+        }
+    }
+
+    // data left at EOF that is not a complete prefix
+    void check_boundary() {
+        if (reader.available() > 0) throw io_exception(TRACEMSG(
+                "Unexpected end of stream inside the frame prefix," +
+                " bytes available: [" + sl::support::to_string(reader.available()) + "]"));
+    }
+
+    bool read_varint(uint64_t& value) {
+        for (size_t i = 0; i < detail_framed::max_prefix_len; i++) {
+            if (!reader.fill(i + 1)) {
+                check_boundary();
+                return false;
+            }
+            unsigned char byte = static_cast<unsigned char>(reader.data()[i]);
+            if (detail_framed::max_prefix_len - 1 == i && byte > 1) {
+                break;
+            }
+            value |= static_cast<uint64_t>(byte & 0x7f) << (i * 7);
+            if (0 == (byte & 0x80)) {
+                reader.consume(i + 1);
+                return true;
+            }
+        }
+        throw io_exception(TRACEMSG("Invalid varint frame prefix, value exceeds 64 bits"));
+    }
+
+    bool next_delimited() {
+        skip_rest();
+        frame = span<const char>(nullptr, 0);
+        size_t scanned = 0;
+        for (;;) {
+            const char* found = nullptr;
+            if (reader.available() > scanned) {
+                found = static_cast<const char*>(std::memchr(reader.data() + scanned,
+                        options.delimiter, reader.available() - scanned));
+            }
+            if (nullptr != found) {
+                size_t len = static_cast<size_t>(found - reader.data());
+                detail_framed::check_length(options, len);
+                frame = span<const char>(reader.data(), len);
+                reader.consume(len + 1);
+                frame_end = reader.get_consumed();
+                return true;
+            }
+            scanned = reader.available();
+            detail_framed::check_length(options, scanned);
+            if (!reader.fill(scanned + 1)) {
+                // last frame without delimiter
+                if (0 == scanned) {
+                    return false;
+                }
+                frame = span<const char>(reader.data(), scanned);
+                reader.consume(scanned);
+                frame_end = reader.get_consumed();
+                return true;
+            }
+        }
+    }
+
+};
+
+/**
+ * Factory function for creating framed sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param options framing options
+ * @return framed source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+framed_source<Source> make_framed_source(Source&& source, frame_options options = frame_options()) {
+    return framed_source<Source>(std::move(source), options);
+}
+
+/**
+ * Factory function for creating framed sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param options framing options
+ * @return framed source
+ */
+template <typename Source>
+framed_source<reference_source<Source>> make_framed_source(Source& source, frame_options options = frame_options()) {
+    return framed_source<reference_source<Source>>(make_reference_source(source), options);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_FRAMED_SOURCE_HPP */
@@ -24,6 +24,7 @@
 #ifndef STATICLIB_IO_HEX_SINK_HPP
 #define STATICLIB_IO_HEX_SINK_HPP
 
+#include <array>
 #include <ios>
 
 #include "staticlib/config.hpp"
@@ -32,6 +33,7 @@
 #include "staticlib/io/reference_sink.hpp"
 #include "staticlib/io/operations.hpp"
 #include "staticlib/io/span.hpp"
+#include "staticlib/io/traits.hpp"
 
 namespace staticlib {
 namespace io {
@@ -40,6 +42,25 @@ namespace hex_sink_detail {
 
 const std::array<char, 16> symbols = {{'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'}};
 
+// destination sinks that lend their buffers are written directly
+template<typename Sink, bool lending = has_prepare<Sink>::value>
+struct destination {
+    typedef buffered_sink<Sink> type;
+
+    static Sink& unwrap(type& sink) {
+        return sink.get_sink();
+    }
+};
+
+template<typename Sink>
+struct destination<Sink, true> {
+    typedef Sink type;
+
+    static Sink& unwrap(type& sink) {
+        return sink;
+    }
+};
+
 } // namespace
 
 /**
@@ -48,13 +69,10 @@ const std::array<char, 16> symbols = {{'0', '1', '2', '3', '4', '5', '6', '7', '
 template<typename Sink>
 class hex_sink {
     /**
-     * Destination sink
+     * Destination sink, wrapped into buffered sink
+     * if it doesn't lend its own buffer
      */
-    buffered_sink<Sink> sink;
-    /**
-     * Encode buffer
-     */
-    std::array<char, 2> hbuf;
+    typename hex_sink_detail::destination<Sink>::type sink;
 
 public:
     /**
@@ -64,10 +82,7 @@ public:
      * @param sink destination sink
      */
     explicit hex_sink(Sink&& sink) :
-    sink(make_buffered_sink(std::move(sink))) {
-        hbuf[0] = '\0';
-        hbuf[1] = '\0';
-    }
+    sink(std::move(sink)) { }
 
     /**
      * Deleted copy constructor
@@ -90,8 +105,7 @@ public:
      * @param other other instance
      */
     hex_sink(hex_sink&& other) STATICLIB_NOEXCEPT :
-    sink(std::move(other.sink)),
-    hbuf(std::move(other.hbuf)) { }
+    sink(std::move(other.sink)) { }
 
     /**
      * Move assignment operator
@@ -101,7 +115,6 @@ public:
      */
     hex_sink& operator=(hex_sink&& other) STATICLIB_NOEXCEPT {
         sink = std::move(other.sink);
-        hbuf = std::move(other.hbuf);
         return *this;
     }
 
@@ -112,13 +125,23 @@ public:
      * @return number of bytes processed
      */
     std::streamsize write(span<const char> span) {
-        for (size_t i = 0; i < span.size(); i++) {
-            char ch = span.data()[i];
-            // http://stackoverflow.com/a/18025541/314015
-            unsigned char uch = static_cast<unsigned char>(ch);
-            hbuf[0] = hex_sink_detail::symbols[static_cast<size_t>(uch >> 4)];
-            hbuf[1] = hex_sink_detail::symbols[static_cast<size_t>(uch & 0x0f)];
-            sl::io::write_all(sink, {hbuf.data(), hbuf.size()});
+        size_t i = 0;
+        while (i < span.size()) {
+            // encode directly into destination buffer
+            auto dest = sink.prepare(2);
+            if (dest.size() < 2) throw io_exception(TRACEMSG(
+                    "Invalid span returned by underlying 'prepare' operation, size: [" +
+                    sl::support::to_string(dest.size()) + "]"));
+            size_t pairs = dest.size() / 2;
+            size_t len = span.size() - i <= pairs ? span.size() - i : pairs;
+            for (size_t j = 0; j < len; j++) {
+                // http://stackoverflow.com/a/18025541/314015
+                unsigned char uch = static_cast<unsigned char>(span.data()[i + j]);
+                dest.data()[j * 2] = hex_sink_detail::symbols[static_cast<size_t>(uch >> 4)];
+                dest.data()[j * 2 + 1] = hex_sink_detail::symbols[static_cast<size_t>(uch & 0x0f)];
+            }
+            sink.commit(len * 2);
+            i += len;
         }
         return span.size_signed();
     }
@@ -138,7 +161,7 @@ public:
      * @return underlying sink reference
      */
     Sink& get_sink() {
-        return sink.get_sink();
+        return hex_sink_detail::destination<Sink>::unwrap(sink);
     }
 
 };
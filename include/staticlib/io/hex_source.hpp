@@ -35,23 +35,52 @@
 #include "staticlib/io/io_exception.hpp"
 #include "staticlib/io/reference_source.hpp"
 #include "staticlib/io/span.hpp"
+#include "staticlib/io/traits.hpp"
 
 namespace staticlib {
 namespace io {
 
+namespace hex_source_detail {
+
+// sources that lend their data are read directly
+template<typename Source, bool lending = has_borrow_read<Source>::value>
+struct origin {
+    typedef buffered_source<Source> type;
+
+    static Source& unwrap(type& src) {
+        return src.get_source();
+    }
+};
+
+template<typename Source>
+struct origin<Source, true> {
+    typedef Source type;
+
+    static Source& unwrap(type& src) {
+        return src;
+    }
+};
+
+} // namespace
+
 /**
  * Source wrapper that decodes data from Hexadecimal
  */
 template<typename Source>
 class hex_source {
     /**
-     * Input source
+     * Input source, wrapped into buffered source
+     * if it doesn't lend its own data
      */
-    buffered_source<Source> src;
+    typename hex_source_detail::origin<Source>::type src;
     /**
      * Decode buffer
      */
     std::array<char, 3> hbuf;
+    /**
+     * Whether first half of the pair is stored in decode buffer
+     */
+    bool pending = false;
 
 public:
     /**
@@ -61,7 +90,7 @@ public:
      * @param src input source
      */
     explicit hex_source(Source&& src) :
-    src(make_buffered_source(std::move(src))) {
+    src(std::move(src)) {
         hbuf[0] = '\0';
         hbuf[1] = '\0';
         hbuf[2] = '\0';
@@ -89,7 +118,10 @@ public:
      */
     hex_source(hex_source&& other) STATICLIB_NOEXCEPT :
     src(std::move(other.src)),
-    hbuf(std::move(other.hbuf)) { }
+    hbuf(std::move(other.hbuf)),
+    pending(other.pending) {
+        other.pending = false;
+    }
 
     /**
      * Move assignment operator
@@ -100,11 +132,14 @@ public:
     hex_source& operator=(hex_source&& other) STATICLIB_NOEXCEPT {
         src = std::move(other.src);
         hbuf = std::move(other.hbuf);
+        pending = other.pending;
+        other.pending = false;
         return *this;
     }
 
     /**
-     * Hex-decoding read implementation
+     * Hex-decoding read implementation, decodes data
+     * directly from the spans lent by the input source
      * 
      * @param span buffer span
      * @return number of bytes processed
@@ -112,22 +147,32 @@ public:
     std::streamsize read(span<char> span) {
         size_t idx = 0;
         while (idx < span.size()) {
-            auto read = read_all(src, {hbuf.data(), 2});
-            if (2 == read) {
-                char* end = nullptr;
-                errno = 0;
-                char byte = static_cast<char> (strtol(hbuf.data(), std::addressof(end), 16));
-                if (errno == ERANGE || end != hbuf.data() + 2) {
-                    throw io_exception(TRACEMSG("Error parsing byte from HEX-pair: [" + std::string(hbuf.data(), 2) + "]"));
+            // never borrow more than can be decoded into the span
+            size_t max = (span.size() - idx) * 2 - (pending ? 1 : 0);
+            auto chunk = src.borrow_read(max);
+            if (0 == chunk.size()) {
+                if (pending) {
+                    throw io_exception(TRACEMSG("Invalid non-even number of bytes available in HEX source"));
                 }
-                span.data()[idx] = byte;
-                idx += 1;
-            } else if (1 == read) {
-                throw io_exception(TRACEMSG("Invalid non-even number of bytes available in HEX source"));
-            } else if (0 == read) {
                 break;
-            } else {
-                throw io_exception(TRACEMSG("Invalid hex decoder state"));
+            }
+            size_t i = 0;
+            if (pending) {
+                hbuf[1] = chunk.data()[0];
+                span.data()[idx] = decode_pair();
+                idx += 1;
+                i = 1;
+                pending = false;
+            }
+            for (; i + 1 < chunk.size(); i += 2) {
+                hbuf[0] = chunk.data()[i];
+                hbuf[1] = chunk.data()[i + 1];
+                span.data()[idx] = decode_pair();
+                idx += 1;
+            }
+            if (i < chunk.size()) {
+                hbuf[0] = chunk.data()[i];
+                pending = true;
             }
         }
         if (idx > 0) {
@@ -142,7 +187,18 @@ public:
      * @return underlying source reference
      */
     Source& get_source() {
-        return src.get_source();
+        return hex_source_detail::origin<Source>::unwrap(src);
+    }
+
+private:
+    char decode_pair() {
+        char* end = nullptr;
+        errno = 0;
+        char byte = static_cast<char> (strtol(hbuf.data(), std::addressof(end), 16));
+        if (errno == ERANGE || end != hbuf.data() + 2) {
+            throw io_exception(TRACEMSG("Error parsing byte from HEX-pair: [" + std::string(hbuf.data(), 2) + "]"));
+        }
+        return byte;
     }
     
 };
@@ -0,0 +1,178 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   inflate_source.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 8:40 PM
+ */
+
+#ifndef STATICLIB_IO_INFLATE_SOURCE_HPP
+#define STATICLIB_IO_INFLATE_SOURCE_HPP
+
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/inflater.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source wrapper that decompresses DEFLATE data in raw, zlib or gzip
+ * format, compressed data is read from the input source in chunks,
+ * so more data than the compressed stream contains may be read from it
+ */
+template<typename Source>
+class inflate_source {
+    /**
+     * Input source
+     */
+    Source src;
+    /**
+     * Decompressor
+     */
+    detail_deflate::inflater inflater;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param format compressed data framing
+     */
+    explicit inflate_source(Source&& src, deflate_format format = deflate_format::zlib) :
+    src(std::move(src)),
+    inflater(format) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    inflate_source(const inflate_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    inflate_source& operator=(const inflate_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    inflate_source(inflate_source&& other) STATICLIB_NOEXCEPT :
+    src(std::move(other.src)),
+    inflater(std::move(other.inflater)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    inflate_source& operator=(inflate_source&& other) STATICLIB_NOEXCEPT {
+        src = std::move(other.src);
+        inflater = std::move(other.inflater);
+        return *this;
+    }
+
+    /**
+     * Decompressing read implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes read or "eof" at the end of compressed stream
+     * @throws io_exception on invalid or truncated compressed data
+     */
+    std::streamsize read(span<char> span) {
+        return inflater.read(src, span);
+    }
+
+    /**
+     * Resets this source to decompress the next stream
+     * from the same input source, data that was read from
+     * the input source but not decompressed yet is kept
+     */
+    void reset() {
+        inflater.reset(true);
+    }
+
+    /**
+     * Resets this source to decompress the stream from the
+     * specified input source, allocated buffers are reused
+     * 
+     * @param source new input source
+     */
+    void reset(Source&& source) {
+        src = std::move(source);
+        inflater.reset(false);
+    }
+
+    /**
+     * Underlying source accessor
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return src;
+    }
+
+};
+
+/**
+ * Factory function for creating inflate sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param format compressed data framing
+ * @return inflate source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+inflate_source<Source> make_inflate_source(Source&& source, deflate_format format = deflate_format::zlib) {
+    return inflate_source<Source>(std::move(source), format);
+}
+
+/**
+ * Factory function for creating inflate sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param format compressed data framing
+ * @return inflate source
+ */
+template <typename Source>
+inflate_source<reference_source<Source>> make_inflate_source(Source& source,
+        deflate_format format = deflate_format::zlib) {
+    return inflate_source<reference_source<Source>>(make_reference_source(source), format);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_INFLATE_SOURCE_HPP */
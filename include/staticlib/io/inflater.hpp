@@ -0,0 +1,664 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   inflater.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 8:05 PM
+ */
+
+#ifndef STATICLIB_IO_INFLATER_HPP
+#define STATICLIB_IO_INFLATER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <ios>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_deflate {
+
+/**
+ * Canonical Huffman decoding table, codes up to "fast_bits" long
+ * are decoded with a single lookup, longer ones are decoded
+ * comparing the code with the max code of each length
+ */
+class huffman_decoder {
+    static const size_t fast_bits = 10;
+    static const size_t fast_mask = (1 << fast_bits) - 1;
+    static const size_t max_symbols = lit_codes + 2;
+
+    // code length in upper bits, symbol in lower 9 bits, zero if not fast
+    std::array<uint16_t, 1 << fast_bits> fast;
+    std::array<uint16_t, max_bits + 1> first_code;
+    // max codes are shifted to 16 bits
+    std::array<uint32_t, max_bits + 2> max_code;
+    std::array<uint16_t, max_bits + 1> first_symbol;
+    std::array<uint8_t, max_symbols> sizes;
+    std::array<uint16_t, max_symbols> values;
+
+public:
+    /**
+     * Builds table for the specified code lengths,
+     * incomplete codes are allowed
+     * 
+     * @param lengths code lengths
+     * @param count number of symbols
+     * @throws io_exception on oversubscribed code
+     */
+    void build(const uint8_t* lengths, size_t count) {
+        std::array<size_t, max_bits + 1> counts;
+        std::array<size_t, max_bits + 1> next_code;
+        counts.fill(0);
+        fast.fill(0);
+        for (size_t i = 0; i < count; i++) {
+            counts[lengths[i]] += 1;
+        }
+        counts[0] = 0;
+        size_t code = 0;
+        size_t symbol = 0;
+        for (size_t i = 1; i <= max_bits; i++) {
+            next_code[i] = code;
+            first_code[i] = static_cast<uint16_t>(code);
+            first_symbol[i] = static_cast<uint16_t>(symbol);
+            code += counts[i];
+            if (counts[i] > 0 && code > (static_cast<size_t>(1) << i)) {
+                throw io_exception(TRACEMSG("Invalid Huffman code lengths in compressed data"));
+            }
+            max_code[i] = static_cast<uint32_t>(code << (16 - i));
+            code <<= 1;
+            symbol += counts[i];
+        }
+        // sentinel
+        max_code[max_bits + 1] = 0x10000;
+        for (size_t i = 0; i < count; i++) {
+            size_t len = lengths[i];
+            if (0 == len) {
+                continue;
+            }
+            size_t idx = next_code[len] - first_code[len] + first_symbol[len];
+            sizes[idx] = static_cast<uint8_t>(len);
+            values[idx] = static_cast<uint16_t>(i);
+            if (len <= fast_bits) {
+                size_t rev = reverse(next_code[len], len);
+                for (size_t j = rev; j <= fast_mask; j += (static_cast<size_t>(1) << len)) {
+                    fast[j] = static_cast<uint16_t>((len << 9) | i);
+                }
+            }
+            next_code[len] += 1;
+        }
+    }
+
+    /**
+     * Decodes symbol from the lower bits of the bit buffer,
+     * missing bits are expected to be zero
+     * 
+     * @param bits bit buffer
+     * @param len output code length, zero for invalid code
+     * @return decoded symbol
+     */
+    size_t decode(uint64_t bits, size_t& len) const {
+        size_t entry = fast[static_cast<size_t>(bits & fast_mask)];
+        if (0 != entry) {
+            len = entry >> 9;
+            return entry & 0x1ff;
+        }
+        size_t code = reverse(static_cast<size_t>(bits & 0xffff), 16);
+        size_t bitlen = fast_bits + 1;
+        while (code >= max_code[bitlen]) {
+            bitlen += 1;
+        }
+        len = 0;
+        if (bitlen > max_bits) {
+            return 0;
+        }
+        size_t idx = (code >> (16 - bitlen)) - first_code[bitlen] + first_symbol[bitlen];
+        if (idx >= max_symbols || sizes[idx] != bitlen) {
+            return 0;
+        }
+        len = bitlen;
+        return values[idx];
+    }
+
+private:
+    static size_t reverse(size_t code, size_t len) {
+        size_t res = 0;
+        for (size_t i = 0; i < len; i++) {
+            res = (res << 1) | (code & 1);
+            code >>= 1;
+        }
+        return res;
+    }
+};
+
+/**
+ * Streaming DEFLATE decompressor, compressed data is pulled from the
+ * source passed to "read" into the input buffer, decompressed data
+ * is kept in the history buffer until it is read by the caller.
+ * Source is read only when no more data can be decompressed from
+ * the buffered input. Consecutive gzip members are decompressed as
+ * a single stream. All buffers are kept on "reset", so instances
+ * can be reused.
+ */
+class inflater {
+    static const size_t in_size = 1 << 14;
+    // input buffer headroom, allows to return unused bits into the buffer
+    static const size_t in_headroom = 8;
+    static const size_t hist_window = 1 << max_window_bits;
+    static const size_t hist_size = 3 * hist_window;
+
+    enum class state {
+        header, block_header, stored, huffman, trailer, done
+    };
+
+    deflate_format format;
+    state st = state::header;
+    bool final_block = false;
+    bool fixed_codes = false;
+    size_t stored_left = 0;
+
+    std::vector<char> in;
+    size_t in_pos = in_headroom;
+    size_t in_end = in_headroom;
+    bool source_exhausted = false;
+    uint64_t bitbuf = 0;
+    size_t bitcnt = 0;
+
+    std::vector<unsigned char> hist;
+    size_t out_pos = 0;
+    size_t out_end = 0;
+    size_t checked = 0;
+
+    huffman_decoder lit_dynamic;
+    huffman_decoder dist_dynamic;
+    huffman_decoder lit_fixed;
+    huffman_decoder dist_fixed;
+    huffman_decoder lengths_decoder;
+    std::array<uint8_t, lit_codes + 2 + dist_codes + 2> lengths;
+
+    uint32_t checksum = 0;
+    uint32_t total_out = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param format compressed data framing
+     */
+    explicit inflater(deflate_format format) :
+    format(format),
+    in(in_headroom + in_size),
+    hist(hist_size) {
+        // fixed codes include two unused symbols
+        for (size_t i = 0; i < 144; i++) lengths[i] = 8;
+        for (size_t i = 144; i < 256; i++) lengths[i] = 9;
+        for (size_t i = 256; i < 280; i++) lengths[i] = 7;
+        for (size_t i = 280; i < lit_codes + 2; i++) lengths[i] = 8;
+        lit_fixed.build(lengths.data(), lit_codes + 2);
+        for (size_t i = 0; i < dist_codes; i++) lengths[i] = 5;
+        dist_fixed.build(lengths.data(), dist_codes);
+        reset(false);
+    }
+
+    /**
+     * Resets the decompressor to start a new stream, allocated buffers are kept
+     * 
+     * @param keep_input whether to keep buffered input that follows
+     *        the end of the previous stream (when the next stream is read
+     *        from the same source), or to discard it
+     */
+    void reset(bool keep_input) {
+        if (keep_input) {
+            unread_bits();
+        } else {
+            in_pos = in_headroom;
+            in_end = in_headroom;
+            source_exhausted = false;
+        }
+        bitbuf = 0;
+        bitcnt = 0;
+        st = state::header;
+        final_block = false;
+        fixed_codes = false;
+        stored_left = 0;
+        out_pos = 0;
+        out_end = 0;
+        checked = 0;
+        checksum = deflate_format::zlib == format ? 1 : 0;
+        total_out = 0;
+    }
+
+    /**
+     * Reads decompressed data, returns data that is already decompressed
+     * without reading the source
+     * 
+     * @param src source of compressed data
+     * @param span buffer span
+     * @return number of bytes read or "eof" at the end of compressed stream
+     * @throws io_exception on invalid or truncated compressed data
+     */
+    template<typename Source>
+    std::streamsize read(Source& src, span<char> span) {
+        if (out_pos == out_end && state::done != st && span.size() > 0) {
+            decompress(src);
+        }
+        size_t avail = out_end - out_pos;
+        size_t len = span.size() <= avail ? span.size() : avail;
+        if (len > 0) {
+            std::memcpy(span.data(), hist.data() + out_pos, len);
+            out_pos += len;
+            return static_cast<std::streamsize>(len);
+        }
+        if (state::done == st) {
+            return std::char_traits<char>::eof();
+        }
+        return 0;
+    }
+
+    /**
+     * Checks whether the end of compressed stream is reached
+     * 
+     * @return true if the end of stream is reached, false otherwise
+     */
+    bool is_finished() const {
+        return state::done == st;
+    }
+
+private:
+    // runs until some output is produced or the stream ends
+    template<typename Source>
+    void decompress(Source& src) {
+        while (out_pos == out_end && state::done != st) {
+            if (out_end + max_match > hist.size()) {
+                // all output is consumed, only the window is kept
+                std::memmove(hist.data(), hist.data() + out_end - hist_window, hist_window);
+                out_end = hist_window;
+                out_pos = hist_window;
+                checked = hist_window;
+            }
+            switch (st) {
+            case state::header: read_header(src); break;
+            case state::block_header: read_block_header(src); break;
+            case state::stored: inflate_stored(src); break;
+            case state::huffman: inflate_huffman(src); break;
+            case state::trailer: read_trailer(src); break;
+            case state::done: break;
+            }
+            update_checksum();
+        }
+    }
+
+    template<typename Source>
+    void read_header(Source& src) {
+        switch (format) {
+        case deflate_format::raw:
+            break;
+        case deflate_format::zlib: {
+            size_t cmf = take_bits(src, 8);
+            size_t flg = take_bits(src, 8);
+            if (8 != (cmf & 0x0f) || (cmf >> 4) > 7 || 0 != ((cmf << 8) | flg) % 31) {
+                throw io_exception(TRACEMSG("Invalid zlib header, CMF: [" + sl::support::to_string(cmf) + "]," +
+                        " FLG: [" + sl::support::to_string(flg) + "]"));
+            }
+            if (0 != (flg & 0x20)) throw io_exception(TRACEMSG("Preset dictionary in zlib stream is not supported"));
+            break;
+        }
+        case deflate_format::gzip: {
+            size_t id1 = take_bits(src, 8);
+            size_t id2 = take_bits(src, 8);
+            size_t cm = take_bits(src, 8);
+            size_t flg = take_bits(src, 8);
+            if (0x1f != id1 || 0x8b != id2 || 8 != cm || 0 != (flg & 0xe0)) {
+                throw io_exception(TRACEMSG("Invalid gzip header, ID1: [" + sl::support::to_string(id1) + "]," +
+                        " ID2: [" + sl::support::to_string(id2) + "]," +
+                        " CM: [" + sl::support::to_string(cm) + "]," +
+                        " FLG: [" + sl::support::to_string(flg) + "]"));
+            }
+            // MTIME, XFL, OS
+            skip_bytes(src, 6);
+            if (0 != (flg & 0x04)) {
+                size_t xlen = take_bits(src, 16);
+                skip_bytes(src, xlen);
+            }
+            // FNAME, FCOMMENT
+            for (size_t flag = 0x08; flag <= 0x10; flag <<= 1) {
+                if (0 != (flg & flag)) {
+                    while (0 != take_bits(src, 8));
+                }
+            }
+            // FHCRC
+            if (0 != (flg & 0x02)) {
+                skip_bytes(src, 2);
+            }
+            break;
+        }
+        }
+        st = state::block_header;
+    }
+
+    template<typename Source>
+    void read_block_header(Source& src) {
+        if (final_block) {
+            st = state::trailer;
+            return;
+        }
+        final_block = 1 == take_bits(src, 1);
+        size_t type = take_bits(src, 2);
+        switch (type) {
+        case 0: {
+            // byte boundary
+            bitbuf >>= bitcnt % 8;
+            bitcnt -= bitcnt % 8;
+            size_t len = take_bits(src, 16);
+            size_t nlen = take_bits(src, 16);
+            if (len != (~nlen & 0xffff)) throw io_exception(TRACEMSG(
+                    "Invalid stored block length in compressed data, LEN: [" + sl::support::to_string(len) + "]," +
+                    " NLEN: [" + sl::support::to_string(nlen) + "]"));
+            stored_left = len;
+            st = state::stored;
+            break;
+        }
+        case 1:
+            fixed_codes = true;
+            st = state::huffman;
+            break;
+        case 2:
+            read_dynamic_tables(src);
+            fixed_codes = false;
+            st = state::huffman;
+            break;
+        default:
+            throw io_exception(TRACEMSG("Invalid block type in compressed data"));
+        }
+    }
+
+    template<typename Source>
+    void read_dynamic_tables(Source& src) {
+        size_t hlit = take_bits(src, 5) + 257;
+        size_t hdist = take_bits(src, 5) + 1;
+        size_t hclen = take_bits(src, 4) + 4;
+        if (hlit > lit_codes || hdist > dist_codes) throw io_exception(TRACEMSG(
+                "Invalid number of codes in compressed data, HLIT: [" + sl::support::to_string(hlit) + "]," +
+                " HDIST: [" + sl::support::to_string(hdist) + "]"));
+        const uint8_t* order = code_length_order();
+        std::array<uint8_t, 19> cl_lengths;
+        cl_lengths.fill(0);
+        for (size_t i = 0; i < hclen; i++) {
+            cl_lengths[order[i]] = static_cast<uint8_t>(take_bits(src, 3));
+        }
+        lengths_decoder.build(cl_lengths.data(), cl_lengths.size());
+        size_t total = hlit + hdist;
+        size_t idx = 0;
+        while (idx < total) {
+            size_t sym = take_symbol(src, lengths_decoder);
+            if (sym < 16) {
+                lengths[idx++] = static_cast<uint8_t>(sym);
+                continue;
+            }
+            uint8_t value = 0;
+            size_t repeat = 0;
+            if (16 == sym) {
+                if (0 == idx) throw io_exception(TRACEMSG("Invalid code lengths repeat in compressed data"));
+                value = lengths[idx - 1];
+                repeat = 3 + take_bits(src, 2);
+            } else if (17 == sym) {
+                repeat = 3 + take_bits(src, 3);
+            } else {
+                repeat = 11 + take_bits(src, 7);
+            }
+            if (idx + repeat > total) throw io_exception(TRACEMSG("Invalid code lengths repeat in compressed data"));
+            std::memset(lengths.data() + idx, value, repeat);
+            idx += repeat;
+        }
+        if (0 == lengths[end_block]) throw io_exception(TRACEMSG("Missing end of block code in compressed data"));
+        lit_dynamic.build(lengths.data(), hlit);
+        dist_dynamic.build(lengths.data() + hlit, hdist);
+    }
+
+    template<typename Source>
+    void inflate_stored(Source& src) {
+        // bytes left in bit buffer after alignment
+        while (stored_left > 0 && bitcnt >= 8 && out_end < hist.size()) {
+            hist[out_end++] = static_cast<unsigned char>(bitbuf & 0xff);
+            bitbuf >>= 8;
+            bitcnt -= 8;
+            stored_left -= 1;
+        }
+        while (stored_left > 0 && out_end < hist.size()) {
+            if (in_pos == in_end) {
+                // return decompressed data instead of waiting for input
+                if (out_end > out_pos) {
+                    return;
+                }
+                refill_or_throw(src);
+            }
+            size_t len = in_end - in_pos;
+            len = len <= stored_left ? len : stored_left;
+            len = len <= hist.size() - out_end ? len : hist.size() - out_end;
+            std::memcpy(hist.data() + out_end, in.data() + in_pos, len);
+            in_pos += len;
+            out_end += len;
+            stored_left -= len;
+        }
+        if (0 == stored_left) {
+            st = state::block_header;
+        }
+    }
+
+    template<typename Source>
+    void inflate_huffman(Source& src) {
+        const huffman_decoder& lit = fixed_codes ? lit_fixed : lit_dynamic;
+        const huffman_decoder& dist = fixed_codes ? dist_fixed : dist_dynamic;
+        const uint16_t* lbase = length_base();
+        const uint8_t* lextra = length_extra();
+        const uint16_t* dbase = dist_base();
+        const uint8_t* dextra = dist_extra();
+        unsigned char* out = hist.data();
+        while (out_end + max_match <= hist.size()) {
+            top_up();
+            // longest symbol with extra bits and distance takes 48 bits,
+            // return decompressed data instead of waiting for input
+            if (bitcnt < 48 && out_end > out_pos && !source_exhausted) {
+                return;
+            }
+            size_t sym = take_symbol(src, lit);
+            if (sym < 256) {
+                out[out_end++] = static_cast<unsigned char>(sym);
+                continue;
+            }
+            if (end_block == sym) {
+                st = state::block_header;
+                return;
+            }
+            sym -= 257;
+            if (sym >= 29) throw io_exception(TRACEMSG("Invalid length code in compressed data"));
+            size_t len = lbase[sym] + take_bits(src, lextra[sym]);
+            size_t dsym = take_symbol(src, dist);
+            if (dsym >= dist_codes) throw io_exception(TRACEMSG("Invalid distance code in compressed data"));
+            size_t distance = dbase[dsym] + take_bits(src, dextra[dsym]);
+            if (distance > out_end) throw io_exception(TRACEMSG(
+                    "Invalid distance in compressed data, distance: [" + sl::support::to_string(distance) + "]"));
+            unsigned char* dest = out + out_end;
+            const unsigned char* from = dest - distance;
+            if (distance >= len) {
+                std::memcpy(dest, from, len);
+            } else {
+                for (size_t i = 0; i < len; i++) {
+                    dest[i] = from[i];
+                }
+            }
+            out_end += len;
+        }
+    }
+
+    template<typename Source>
+    void read_trailer(Source& src) {
+        bitbuf >>= bitcnt % 8;
+        bitcnt -= bitcnt % 8;
+        switch (format) {
+        case deflate_format::raw:
+            break;
+        case deflate_format::zlib: {
+            uint32_t expected = 0;
+            for (size_t i = 0; i < 4; i++) {
+                expected = (expected << 8) | static_cast<uint32_t>(take_bits(src, 8));
+            }
+            if (expected != checksum) throw io_exception(TRACEMSG("Invalid Adler-32 checksum of zlib stream"));
+            break;
+        }
+        case deflate_format::gzip: {
+            uint32_t expected = static_cast<uint32_t>(take_bits(src, 16));
+            expected |= static_cast<uint32_t>(take_bits(src, 16)) << 16;
+            uint32_t isize = static_cast<uint32_t>(take_bits(src, 16));
+            isize |= static_cast<uint32_t>(take_bits(src, 16)) << 16;
+            if (expected != checksum) throw io_exception(TRACEMSG("Invalid CRC-32 checksum of gzip stream"));
+            if (isize != total_out) throw io_exception(TRACEMSG("Invalid uncompressed size of gzip stream"));
+            // next member
+            if (bitcnt > 0 || in_pos < in_end || refill(src)) {
+                // all output is consumed, history of the previous member is dropped
+                out_pos = 0;
+                out_end = 0;
+                checked = 0;
+                checksum = 0;
+                total_out = 0;
+                final_block = false;
+                st = state::header;
+                return;
+            }
+            break;
+        }
+        }
+        st = state::done;
+    }
+
+    void update_checksum() {
+        size_t len = out_end - checked;
+        if (0 == len) {
+            return;
+        }
+        const unsigned char* data = hist.data() + checked;
+        switch (format) {
+        case deflate_format::raw: break;
+        case deflate_format::zlib: checksum = adler32_update(checksum, data, len); break;
+        case deflate_format::gzip: checksum = crc32_update(checksum, data, len); break;
+        }
+        total_out += static_cast<uint32_t>(len);
+        checked = out_end;
+    }
+
+    // moves whole bytes from input buffer into bit buffer
+    void top_up() {
+        while (bitcnt <= 56 && in_pos < in_end) {
+            bitbuf |= static_cast<uint64_t>(static_cast<unsigned char>(in[in_pos])) << bitcnt;
+            in_pos += 1;
+            bitcnt += 8;
+        }
+    }
+
+    template<typename Source>
+    bool refill(Source& src) {
+        while (!source_exhausted) {
+            std::streamsize amt = src.read({in.data() + in_headroom, in_size});
+            if (std::char_traits<char>::eof() == amt) {
+                source_exhausted = true;
+            } else if (amt > 0) {
+                if (!sl::support::is_sizet(amt) || static_cast<size_t>(amt) > in_size) throw io_exception(TRACEMSG(
+                        "Invalid result returned by underlying 'read' operation: [" + sl::support::to_string(amt) + "]"));
+                in_pos = in_headroom;
+                in_end = in_headroom + static_cast<size_t>(amt);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename Source>
+    void refill_or_throw(Source& src) {
+        if (!refill(src)) {
+            throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+        }
+    }
+
+    template<typename Source>
+    size_t take_bits(Source& src, size_t count) {
+        if (bitcnt < count) {
+            top_up();
+            while (bitcnt < count) {
+                refill_or_throw(src);
+                top_up();
+            }
+        }
+        size_t res = static_cast<size_t>(bitbuf & ((static_cast<uint64_t>(1) << count) - 1));
+        bitbuf >>= count;
+        bitcnt -= count;
+        return res;
+    }
+
+    template<typename Source>
+    size_t take_symbol(Source& src, const huffman_decoder& decoder) {
+        for (;;) {
+            size_t len = 0;
+            size_t sym = decoder.decode(bitbuf, len);
+            if (len > 0 && len <= bitcnt) {
+                bitbuf >>= len;
+                bitcnt -= len;
+                return sym;
+            }
+            if (bitcnt >= max_bits) throw io_exception(TRACEMSG("Invalid Huffman code in compressed data"));
+            top_up();
+            if (bitcnt < max_bits && in_pos == in_end) {
+                // code may be longer than the bits available
+                refill_or_throw(src);
+                top_up();
+            }
+        }
+    }
+
+    template<typename Source>
+    void skip_bytes(Source& src, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            take_bits(src, 8);
+        }
+    }
+
+    // returns whole unused bytes from bit buffer into input buffer
+    void unread_bits() {
+        // input is never read into headroom, so there is always space for them
+        size_t bytes = bitcnt / 8;
+        in_pos -= bytes;
+        for (size_t i = 0; i < bytes; i++) {
+            in[in_pos + i] = static_cast<char>((bitbuf >> (8 * i)) & 0xff);
+        }
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_INFLATER_HPP */
@@ -0,0 +1,379 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   instrumented_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:35 PM
+ */
+
+#ifndef STATICLIB_IO_INSTRUMENTED_SINK_HPP
+#define STATICLIB_IO_INSTRUMENTED_SINK_HPP
+
+#include <ios>
+#include <memory>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/operation_metrics.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Metrics recorded by "instrumented_sink"
+ */
+struct sink_metrics {
+    /**
+     * Metrics of "write", "write_at" and "commit" calls
+     */
+    operation_metrics write;
+    /**
+     * Metrics of "flush" calls, number of bytes is taken
+     * from the value returned by underlying sink
+     */
+    operation_metrics flush;
+    /**
+     * Metrics of "prepare" calls, number of bytes is taken
+     * from the size of the lent buffer
+     */
+    operation_metrics prepare;
+    /**
+     * Metrics of "seek", "tell" and "size" calls,
+     * number of bytes is not recorded
+     */
+    operation_metrics seek;
+};
+
+/**
+ * Sink wrapper that records metrics of "write" and "flush" calls: number
+ * of calls and bytes, short writes, exceptions and latency histograms.
+ * Optional methods of the underlying sink are forwarded and recorded too.
+ * Metrics object can be shared between multiple wrappers (e.g. all
+ * instances of the same pipeline stage) and scraped concurrently
+ * from another thread.
+ */
+template<typename Sink>
+class instrumented_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Sink metrics
+     */
+    std::shared_ptr<sink_metrics> metrics;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param metrics metrics object to record calls into, new one is created if not specified
+     */
+    explicit instrumented_sink(Sink&& sink,
+            std::shared_ptr<sink_metrics> metrics = std::make_shared<sink_metrics>()) :
+    sink(std::move(sink)),
+    metrics(std::move(metrics)) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    instrumented_sink(const instrumented_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    instrumented_sink& operator=(const instrumented_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    instrumented_sink(instrumented_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    metrics(std::move(other.metrics)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    instrumented_sink& operator=(instrumented_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        metrics = std::move(other.metrics);
+        return *this;
+    }
+
+    /**
+     * Instrumented write implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        auto start = detail_metrics::clock::now();
+        std::streamsize res;
+        try {
+            res = sink.write(span);
+        } catch (...) {
+            metrics->write.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+        metrics->write.record(span.size(), res, detail_metrics::elapsed_ns(start));
+        return res;
+    }
+
+    /**
+     * Instrumented flush implementation
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        auto start = detail_metrics::clock::now();
+        std::streamsize res;
+        try {
+            res = sink.flush();
+        } catch (...) {
+            metrics->flush.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+        metrics->flush.record(0, res, detail_metrics::elapsed_ns(start));
+        return res;
+    }
+
+    /**
+     * Instrumented positional write implementation,
+     * available only if underlying sink implements it
+     * 
+     * @param offset offset to write to
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Sink>
+    auto write_at(size_t offset, span<const char> span) -> decltype(std::declval<T&>().write_at(offset, span)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = sink.write_at(offset, span);
+            metrics->write.record(span.size(), res, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->write.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented prepare implementation, available only
+     * if underlying sink implements it
+     * 
+     * @param min min number of bytes required
+     * @return span over the buffer lent by the underlying sink
+     */
+    template<typename T = Sink>
+    auto prepare(size_t min) -> decltype(std::declval<T&>().prepare(min)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = sink.prepare(min);
+            metrics->prepare.record(min, static_cast<std::streamsize>(res.size()), detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->prepare.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented commit implementation, available only
+     * if underlying sink implements it, committed bytes
+     * are recorded as written
+     * 
+     * @param count number of bytes written into the prepared span
+     */
+    template<typename T = Sink>
+    auto commit(size_t count) -> decltype(std::declval<T&>().commit(count), void()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            sink.commit(count);
+        } catch (...) {
+            metrics->write.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+        metrics->write.record(count, static_cast<std::streamsize>(count), detail_metrics::elapsed_ns(start));
+    }
+
+    /**
+     * Instrumented seek implementation, available only
+     * if underlying sink is seekable
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     */
+    template<typename T = Sink>
+    auto seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg)
+            -> decltype(std::declval<T&>().seek(offset, whence)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = sink.seek(offset, whence);
+            metrics->seek.record(0, 0, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->seek.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented current position accessor, available only
+     * if underlying sink is seekable
+     * 
+     * @return current position
+     */
+    template<typename T = Sink>
+    auto tell() -> decltype(std::declval<T&>().tell()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = sink.tell();
+            metrics->seek.record(0, 0, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->seek.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented size accessor, available only
+     * if underlying sink is seekable
+     * 
+     * @return size of the underlying data
+     */
+    template<typename T = Sink>
+    auto size() -> decltype(std::declval<T&>().size()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = sink.size();
+            metrics->seek.record(0, 0, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->seek.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Returns current values of write metrics
+     * 
+     * @return write metrics snapshot
+     */
+    operation_snapshot get_write_snapshot() const {
+        return metrics->write.snapshot();
+    }
+
+    /**
+     * Returns current values of flush metrics
+     * 
+     * @return flush metrics snapshot
+     */
+    operation_snapshot get_flush_snapshot() const {
+        return metrics->flush.snapshot();
+    }
+
+    /**
+     * Returns current values of prepare metrics
+     * 
+     * @return prepare metrics snapshot
+     */
+    operation_snapshot get_prepare_snapshot() const {
+        return metrics->prepare.snapshot();
+    }
+
+    /**
+     * Returns current values of seek metrics
+     * 
+     * @return seek metrics snapshot
+     */
+    operation_snapshot get_seek_snapshot() const {
+        return metrics->seek.snapshot();
+    }
+
+    /**
+     * Metrics accessor, returned object can be
+     * passed to metrics exporter or to other wrappers
+     * 
+     * @return sink metrics
+     */
+    std::shared_ptr<sink_metrics> get_metrics() const {
+        return metrics;
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+};
+
+/**
+ * Factory function for creating instrumented sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param metrics metrics object to record calls into, new one is created if not specified
+ * @return instrumented sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+instrumented_sink<Sink> make_instrumented_sink(Sink&& sink,
+        std::shared_ptr<sink_metrics> metrics = std::make_shared<sink_metrics>()) {
+    return instrumented_sink<Sink>(std::move(sink), std::move(metrics));
+}
+
+/**
+ * Factory function for creating instrumented sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param metrics metrics object to record calls into, new one is created if not specified
+ * @return instrumented sink
+ */
+template <typename Sink>
+instrumented_sink<reference_sink<Sink>> make_instrumented_sink(Sink& sink,
+        std::shared_ptr<sink_metrics> metrics = std::make_shared<sink_metrics>()) {
+    return instrumented_sink<reference_sink<Sink>>(make_reference_sink(sink), std::move(metrics));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_INSTRUMENTED_SINK_HPP */
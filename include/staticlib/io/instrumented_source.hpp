@@ -0,0 +1,379 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   instrumented_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:20 PM
+ */
+
+#ifndef STATICLIB_IO_INSTRUMENTED_SOURCE_HPP
+#define STATICLIB_IO_INSTRUMENTED_SOURCE_HPP
+
+#include <ios>
+#include <memory>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/operation_metrics.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Metrics recorded by "instrumented_source"
+ */
+struct source_metrics {
+    /**
+     * Metrics of "read" calls and of other calls that return data
+     * ("next_chunk", "borrow_read", "read_at") or drop it
+     * ("skip", "consume")
+     */
+    operation_metrics read;
+    /**
+     * Metrics of "seek", "tell" and "size" calls,
+     * number of bytes is not recorded
+     */
+    operation_metrics seek;
+};
+
+/**
+ * Source wrapper that records metrics of "read" calls: number of calls
+ * and bytes, short reads, EOFs, exceptions and latency histogram.
+ * Optional methods of the underlying source are forwarded and
+ * recorded too. Metrics object can be shared between multiple
+ * wrappers (e.g. all instances of the same pipeline stage) and
+ * scraped concurrently from another thread.
+ */
+template<typename Source>
+class instrumented_source {
+    /**
+     * Input source
+     */
+    Source src;
+    /**
+     * Read and seek metrics
+     */
+    std::shared_ptr<source_metrics> metrics;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param metrics metrics object to record calls into, new one is created if not specified
+     */
+    explicit instrumented_source(Source&& src,
+            std::shared_ptr<source_metrics> metrics = std::make_shared<source_metrics>()) :
+    src(std::move(src)),
+    metrics(std::move(metrics)) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    instrumented_source(const instrumented_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    instrumented_source& operator=(const instrumented_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    instrumented_source(instrumented_source&& other) STATICLIB_NOEXCEPT :
+    src(std::move(other.src)),
+    metrics(std::move(other.metrics)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    instrumented_source& operator=(instrumented_source&& other) STATICLIB_NOEXCEPT {
+        src = std::move(other.src);
+        metrics = std::move(other.metrics);
+        return *this;
+    }
+
+    /**
+     * Instrumented read implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize read(span<char> span) {
+        auto start = detail_metrics::clock::now();
+        std::streamsize res;
+        try {
+            res = src.read(span);
+        } catch (...) {
+            metrics->read.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+        metrics->read.record(span.size(), res, detail_metrics::elapsed_ns(start));
+        return res;
+    }
+
+    /**
+     * Instrumented next chunk implementation, available only
+     * if underlying source implements it, empty chunk is recorded as EOF
+     * 
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto next_chunk() -> decltype(std::declval<T&>().next_chunk()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.next_chunk();
+            record_chunk(res.size(), res.size(), start);
+            return res;
+        } catch (...) {
+            metrics->read.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented borrow read implementation, available only
+     * if underlying source implements it, empty chunk is recorded as EOF
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.borrow_read(max);
+            record_chunk(max, res.size(), start);
+            return res;
+        } catch (...) {
+            metrics->read.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented positional read implementation,
+     * available only if underlying source implements it
+     * 
+     * @param offset offset to read from
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Source>
+    auto read_at(size_t offset, span<char> span) -> decltype(std::declval<T&>().read_at(offset, span)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.read_at(offset, span);
+            metrics->read.record(span.size(), res, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->read.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented skip implementation, available only
+     * if underlying source implements it
+     * 
+     * @param to_skip number of bytes to skip
+     */
+    template<typename T = Source>
+    auto skip(size_t to_skip) -> decltype(std::declval<T&>().skip(to_skip), void()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            src.skip(to_skip);
+        } catch (...) {
+            metrics->read.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+        metrics->read.record(to_skip, static_cast<std::streamsize>(to_skip), detail_metrics::elapsed_ns(start));
+    }
+
+    /**
+     * Instrumented consume implementation, available only
+     * if underlying source implements it
+     * 
+     * @param count number of bytes to drop from the buffer
+     * @return number of bytes dropped
+     */
+    template<typename T = Source>
+    auto consume(size_t count) -> decltype(std::declval<T&>().consume(count)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.consume(count);
+            metrics->read.record(count, static_cast<std::streamsize>(res), detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->read.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented seek implementation, available only
+     * if underlying source is seekable
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     */
+    template<typename T = Source>
+    auto seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg)
+            -> decltype(std::declval<T&>().seek(offset, whence)) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.seek(offset, whence);
+            metrics->seek.record(0, 0, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->seek.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented current position accessor, available only
+     * if underlying source is seekable
+     * 
+     * @return current position
+     */
+    template<typename T = Source>
+    auto tell() -> decltype(std::declval<T&>().tell()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.tell();
+            metrics->seek.record(0, 0, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->seek.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Instrumented size accessor, available only
+     * if underlying source is seekable
+     * 
+     * @return size of the underlying data
+     */
+    template<typename T = Source>
+    auto size() -> decltype(std::declval<T&>().size()) {
+        auto start = detail_metrics::clock::now();
+        try {
+            auto res = src.size();
+            metrics->seek.record(0, 0, detail_metrics::elapsed_ns(start));
+            return res;
+        } catch (...) {
+            metrics->seek.record_exception(detail_metrics::elapsed_ns(start));
+            throw;
+        }
+    }
+
+    /**
+     * Returns current values of read metrics
+     * 
+     * @return read metrics snapshot
+     */
+    operation_snapshot get_read_snapshot() const {
+        return metrics->read.snapshot();
+    }
+
+    /**
+     * Returns current values of seek metrics
+     * 
+     * @return seek metrics snapshot
+     */
+    operation_snapshot get_seek_snapshot() const {
+        return metrics->seek.snapshot();
+    }
+
+    /**
+     * Metrics accessor, returned object can be
+     * passed to metrics exporter or to other wrappers
+     * 
+     * @return read and seek metrics
+     */
+    std::shared_ptr<source_metrics> get_metrics() const {
+        return metrics;
+    }
+
+    /**
+     * Underlying source accessor
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return src;
+    }
+
+private:
+    void record_chunk(size_t requested, size_t len, detail_metrics::clock::time_point start) {
+        std::streamsize res = len > 0 ? static_cast<std::streamsize>(len) : std::char_traits<char>::eof();
+        metrics->read.record(requested, res, detail_metrics::elapsed_ns(start));
+    }
+
+};
+
+/**
+ * Factory function for creating instrumented sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param metrics metrics object to record calls into, new one is created if not specified
+ * @return instrumented source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+instrumented_source<Source> make_instrumented_source(Source&& source,
+        std::shared_ptr<source_metrics> metrics = std::make_shared<source_metrics>()) {
+    return instrumented_source<Source>(std::move(source), std::move(metrics));
+}
+
+/**
+ * Factory function for creating instrumented sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param metrics metrics object to record calls into, new one is created if not specified
+ * @return instrumented source
+ */
+template <typename Source>
+instrumented_source<reference_source<Source>> make_instrumented_source(Source& source,
+        std::shared_ptr<source_metrics> metrics = std::make_shared<source_metrics>()) {
+    return instrumented_source<reference_source<Source>>(make_reference_source(source), std::move(metrics));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_INSTRUMENTED_SOURCE_HPP */
@@ -25,12 +25,14 @@
 #define STATICLIB_IO_LIMITED_SOURCE_HPP
 
 #include <ios>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
 #include "staticlib/io/io_exception.hpp"
 #include "staticlib/io/counting_source.hpp"
 #include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/seekable.hpp"
 #include "staticlib/io/span.hpp"
 
 namespace staticlib {
@@ -121,6 +123,87 @@ public:
         }
     }
 
+    /**
+     * Borrow read implementation, available only if underlying
+     * source implements it, lent data is limited the same way as read data
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the lent data, empty span if limit is reached
+     */
+    template<typename S = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<S&>().borrow_read(max)) {
+        if (src.get_count() < limit_bytes) {
+            size_t remaining_bytes = limit_bytes - src.get_count();
+            return src.borrow_read(max <= remaining_bytes ? max : remaining_bytes);
+        } else {
+            return span<const char>(nullptr, 0);
+        }
+    }
+
+    /**
+     * Skip implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param to_skip number of bytes to skip
+     * @throws io_exception if skipping beyond the limit
+     */
+    template<typename S = Source>
+    auto skip(size_t to_skip) -> decltype(std::declval<S&>().skip(to_skip), void()) {
+        size_t remaining = limit_bytes > src.get_count() ? limit_bytes - src.get_count() : 0;
+        if (to_skip > remaining) throw io_exception(TRACEMSG(
+                "Skip amount: [" + sl::support::to_string(to_skip) + "]" +
+                " exceeds remaining limit: [" + sl::support::to_string(remaining) + "]"));
+        src.skip(to_skip);
+    }
+
+    /**
+     * Seek implementation, available only if underlying source
+     * is seekable. Positions are relative to the position of underlying
+     * source at the moment this instance was created, seeking beyond
+     * the limit is not allowed.
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     * @throws io_exception if new position is out of bounds
+     */
+    template<typename S = Source>
+    auto seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg)
+            -> decltype(std::declval<S&>().seek(offset, whence), size_t()) {
+        size_t target = seek_position(src.get_count(), size(), offset, whence);
+        if (target >= src.get_count()) {
+            src.seek(static_cast<std::streamsize>(target - src.get_count()), std::ios_base::cur);
+        } else {
+            src.seek(-static_cast<std::streamsize>(src.get_count() - target), std::ios_base::cur);
+        }
+        return src.get_count();
+    }
+
+    /**
+     * Current position accessor
+     * 
+     * @return number of bytes read through this instance
+     */
+    template<typename S = Source>
+    auto tell() -> decltype(std::declval<S&>().tell(), size_t()) {
+        return src.get_count();
+    }
+
+    /**
+     * Size accessor, returns the limit or the number of bytes
+     * available in underlying source if it is less than the limit
+     * 
+     * @return size of the limited data
+     */
+    template<typename S = Source>
+    auto size() -> decltype(std::declval<S&>().size(), size_t()) {
+        size_t pos = static_cast<size_t>(src.tell());
+        size_t total = static_cast<size_t>(src.size());
+        size_t remaining = total >= pos ? total - pos : 0;
+        size_t avail = src.get_count() + remaining;
+        return avail < limit_bytes ? avail : limit_bytes;
+    }
+
     /**
      * Returns number of bytes read through this instance
      * 
@@ -0,0 +1,467 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_compressor.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:05 PM
+ */
+
+#ifndef STATICLIB_IO_LZ4_COMPRESSOR_HPP
+#define STATICLIB_IO_LZ4_COMPRESSOR_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/block_workers.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/lz4_format.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/xxhash.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_lz4 {
+
+/**
+ * Compressor of independent LZ4 blocks, single-probe hash table
+ * matching, dictionary is used as a prefix of each block
+ */
+class block_compressor {
+    static const size_t hash_log = 14;
+    static const size_t skip_trigger = 6;
+
+    size_t dict_len;
+    size_t acceleration;
+    std::vector<unsigned char> buffer;
+    std::vector<uint32_t> table;
+    std::vector<uint32_t> dict_table;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param dictionary dictionary, only last 64 KiB are used
+     * @param acceleration search step multiplier
+     */
+    block_compressor(const std::string& dictionary, int acceleration) :
+    dict_len(dictionary.size() < max_dictionary ? dictionary.size() : max_dictionary),
+    acceleration(acceleration > 1 ? static_cast<size_t>(acceleration) : 1),
+    buffer(dictionary.end() - dict_len, dictionary.end()),
+    table(static_cast<size_t>(1) << hash_log) {
+        if (dict_len >= min_match) {
+            dict_table.resize(table.size());
+            for (size_t i = 0; i + min_match <= dict_len; i++) {
+                dict_table[hash(buffer.data() + i)] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+
+    /**
+     * Compresses the block and appends it to the output
+     * 
+     * @param data block data
+     * @param len block length
+     * @param out output buffer
+     * @return false if block cannot be compressed, output is not changed in this case
+     */
+    bool compress(const char* data, size_t len, std::vector<char>& out) {
+        buffer.resize(dict_len + len);
+        std::memcpy(buffer.data() + dict_len, data, len);
+        if (dict_table.empty()) {
+            std::fill(table.begin(), table.end(), 0);
+        } else {
+            std::copy(dict_table.begin(), dict_table.end(), table.begin());
+        }
+        const unsigned char* base = buffer.data();
+        size_t end = dict_len + len;
+        size_t anchor = dict_len;
+        size_t out_start = out.size();
+        out.resize(out_start + len + len / 255 + 16);
+        char* dest = out.data() + out_start;
+        size_t op = 0;
+        if (len > mf_limit) {
+            size_t match_limit = end - last_literals;
+            size_t search_limit = end - mf_limit;
+            size_t ip = dict_len;
+            table[hash(base + ip)] = static_cast<uint32_t>(ip);
+            ip += 1;
+            for (;;) {
+                size_t ref = 0;
+                size_t search = acceleration << skip_trigger;
+                bool found = false;
+                while (ip <= search_limit) {
+                    uint32_t& entry = table[hash(base + ip)];
+                    ref = entry;
+                    entry = static_cast<uint32_t>(ip);
+                    if (ref < ip && ip - ref <= max_distance && read32(base + ref) == read32(base + ip)) {
+                        found = true;
+                        break;
+                    }
+                    ip += search >> skip_trigger;
+                    search += 1;
+                }
+                if (!found) {
+                    break;
+                }
+                while (ip > anchor && ref > 0 && base[ip - 1] == base[ref - 1]) {
+                    ip -= 1;
+                    ref -= 1;
+                }
+                size_t mlen = min_match + count_equal(base + ip + min_match, base + ref + min_match,
+                        match_limit - ip - min_match);
+                op = write_sequence(dest, op, base + anchor, ip - anchor, ip - ref, mlen);
+                ip += mlen;
+                anchor = ip;
+                if (ip > search_limit) {
+                    break;
+                }
+                table[hash(base + ip - 2)] = static_cast<uint32_t>(ip - 2);
+            }
+        }
+        op = write_literals(dest, op, base + anchor, end - anchor);
+        if (op >= len) {
+            out.resize(out_start);
+            return false;
+        }
+        out.resize(out_start + op);
+        return true;
+    }
+
+private:
+    static uint32_t hash(const unsigned char* ptr) {
+        return (read32(ptr) * 2654435761U) >> (32 - hash_log);
+    }
+
+    static size_t count_equal(const unsigned char* a, const unsigned char* b, size_t max) {
+        size_t len = 0;
+        while (len + 8 <= max) {
+            uint64_t va;
+            uint64_t vb;
+            std::memcpy(std::addressof(va), a + len, 8);
+            std::memcpy(std::addressof(vb), b + len, 8);
+            if (va != vb) {
+                break;
+            }
+            len += 8;
+        }
+        while (len < max && a[len] == b[len]) {
+            len += 1;
+        }
+        return len;
+    }
+
+    static size_t write_length(char* dest, size_t op, size_t rest) {
+        while (rest >= 255) {
+            dest[op++] = static_cast<char>(255);
+            rest -= 255;
+        }
+        dest[op++] = static_cast<char>(rest);
+        return op;
+    }
+
+    static size_t write_literals(char* dest, size_t op, const unsigned char* literals, size_t len) {
+        if (len >= 15) {
+            dest[op++] = static_cast<char>(15 << 4);
+            op = write_length(dest, op, len - 15);
+        } else {
+            dest[op++] = static_cast<char>(len << 4);
+        }
+        std::memcpy(dest + op, literals, len);
+        return op + len;
+    }
+
+    static size_t write_sequence(char* dest, size_t op, const unsigned char* literals, size_t len,
+            size_t offset, size_t mlen) {
+        size_t token_pos = op;
+        op = write_literals(dest, op, literals, len);
+        dest[op++] = static_cast<char>(offset & 0xff);
+        dest[op++] = static_cast<char>(offset >> 8);
+        size_t ml = mlen - min_match;
+        unsigned char token = static_cast<unsigned char>(dest[token_pos]);
+        if (ml >= 15) {
+            token |= 15;
+            op = write_length(dest, op, ml - 15);
+        } else {
+            token |= static_cast<unsigned char>(ml);
+        }
+        dest[token_pos] = static_cast<char>(token);
+        return op;
+    }
+};
+
+/**
+ * Compresses a chunk of input into the sequence of blocks,
+ * used both in the calling thread and in worker threads
+ */
+class blocks_context {
+    block_compressor compressor;
+    size_t block_size;
+    bool block_checksum;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param options compression options
+     */
+    explicit blocks_context(const lz4_options& options) :
+    compressor(options.dictionary, options.acceleration),
+    block_size(options.block_size),
+    block_checksum(options.block_checksum) { }
+
+    /**
+     * Compresses input into blocks
+     * 
+     * @param input uncompressed data
+     * @param output compressed blocks
+     */
+    void process(const std::vector<char>& input, bool, std::vector<char>& output) {
+        for (size_t pos = 0; pos < input.size(); pos += block_size) {
+            size_t len = input.size() - pos < block_size ? input.size() - pos : block_size;
+            size_t header = output.size();
+            output.resize(header + 4);
+            uint32_t stored = 0;
+            if (compressor.compress(input.data() + pos, len, output)) {
+                stored = static_cast<uint32_t>(output.size() - header - 4);
+                write32(output.data() + header, stored);
+            } else {
+                stored = static_cast<uint32_t>(len);
+                write32(output.data() + header, stored | uncompressed_flag);
+                output.insert(output.end(), input.begin() + pos, input.begin() + pos + len);
+            }
+            if (block_checksum) {
+                uint32_t sum = detail_xxhash::xxh32::hash(
+                        reinterpret_cast<const unsigned char*>(output.data() + header + 4), stored);
+                size_t idx = output.size();
+                output.resize(idx + 4);
+                write32(output.data() + idx, sum);
+            }
+        }
+    }
+};
+
+/**
+ * Streaming LZ4 frame compressor, input is compressed into independent blocks
+ * either in the calling thread or concurrently in worker threads
+ */
+class compressor {
+    lz4_options options;
+    size_t job_size;
+    blocks_context context;
+    std::unique_ptr<detail_block_workers::ordered_workers<blocks_context>> workers;
+    std::vector<char> pending;
+    std::vector<char> out;
+    detail_xxhash::xxh32 content_hash;
+    uint64_t total_in = 0;
+    bool header_written = false;
+    bool finished = false;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param opts compression options
+     * @throws io_exception on invalid options
+     */
+    explicit compressor(lz4_options opts) :
+    options(std::move(opts)),
+    job_size(options.block_size),
+    context(check_options(options)) {
+        if (options.workers > 0) {
+            // jobs of a number of blocks
+            size_t blocks = (1 << 20) / options.block_size;
+            job_size = options.block_size * (blocks > 1 ? blocks : 1);
+            std::vector<blocks_context> contexts;
+            for (size_t i = 0; i < options.workers; i++) {
+                contexts.emplace_back(options);
+            }
+            workers.reset(new detail_block_workers::ordered_workers<blocks_context>(
+                    std::move(contexts), options.workers * 2));
+            workers->next_input().clear();
+        }
+        pending.reserve(job_size);
+    }
+
+    /**
+     * Resets the compressor to start a new frame, allocated buffers are kept
+     */
+    void reset() {
+        if (workers.get()) {
+            workers->drain([](span<const char>) {});
+            workers->next_input().clear();
+        }
+        pending.clear();
+        out.clear();
+        content_hash.reset();
+        total_in = 0;
+        header_written = false;
+        finished = false;
+    }
+
+    /**
+     * Compresses specified data, complete blocks are written to the sink
+     * 
+     * @param sink destination sink
+     * @param data input data
+     */
+    template<typename Sink>
+    void write(Sink& sink, span<const char> data) {
+        if (finished) throw io_exception(TRACEMSG("Invalid write after the end of compressed frame"));
+        write_header(sink);
+        if (options.content_checksum) {
+            content_hash.update(reinterpret_cast<const unsigned char*>(data.data()), data.size());
+        }
+        total_in += data.size();
+        size_t idx = 0;
+        while (idx < data.size()) {
+            std::vector<char>& job = workers.get() ? workers->next_input() : pending;
+            size_t len = std::min(data.size() - idx, job_size - job.size());
+            job.insert(job.end(), data.data() + idx, data.data() + idx + len);
+            idx += len;
+            if (job.size() == job_size) {
+                compress_job(sink, false);
+            }
+        }
+    }
+
+    /**
+     * Compresses pending data into a block that may be shorter than max block size
+     * and writes all compressed blocks to the sink
+     * 
+     * @param sink destination sink
+     */
+    template<typename Sink>
+    void flush(Sink& sink) {
+        if (finished) {
+            return;
+        }
+        write_header(sink);
+        compress_job(sink, false);
+        if (workers.get()) {
+            workers->drain([&sink](span<const char> block) {
+                write_all(sink, block);
+            });
+        }
+    }
+
+    /**
+     * Compresses pending data and writes end mark and checksum of the frame
+     * 
+     * @param sink destination sink
+     * @throws io_exception if the amount of data written does not match the content size
+     */
+    template<typename Sink>
+    void finish(Sink& sink) {
+        if (finished) {
+            return;
+        }
+        flush(sink);
+        finished = true;
+        if (options.content_size >= 0 && static_cast<uint64_t>(options.content_size) != total_in) {
+            throw io_exception(TRACEMSG("Invalid amount of data compressed," +
+                    " expected: [" + sl::support::to_string(options.content_size) + "]," +
+                    " actual: [" + sl::support::to_string(total_in) + "]"));
+        }
+        out.resize(4);
+        write32(out.data(), 0);
+        if (options.content_checksum) {
+            out.resize(8);
+            write32(out.data() + 4, content_hash.digest());
+        }
+        write_out(sink);
+    }
+
+private:
+    static const lz4_options& check_options(const lz4_options& options) {
+        if (0 == block_size_id(options.block_size)) throw io_exception(TRACEMSG(
+                "Invalid LZ4 block size specified, block_size: [" + sl::support::to_string(options.block_size) + "]"));
+        return options;
+    }
+
+    template<typename Sink>
+    void write_header(Sink& sink) {
+        if (header_written) {
+            return;
+        }
+        header_written = true;
+        out.resize(4);
+        write32(out.data(), frame_magic);
+        size_t desc_start = out.size();
+        unsigned char flg = 0x40 | 0x20;
+        if (options.block_checksum) flg |= 0x10;
+        if (options.content_size >= 0) flg |= 0x08;
+        if (options.content_checksum) flg |= 0x04;
+        if (0 != options.dictionary_id) flg |= 0x01;
+        out.push_back(static_cast<char>(flg));
+        out.push_back(static_cast<char>(block_size_id(options.block_size) << 4));
+        if (options.content_size >= 0) {
+            uint64_t size = static_cast<uint64_t>(options.content_size);
+            for (size_t i = 0; i < 8; i++) {
+                out.push_back(static_cast<char>((size >> (8 * i)) & 0xff));
+            }
+        }
+        if (0 != options.dictionary_id) {
+            size_t idx = out.size();
+            out.resize(idx + 4);
+            write32(out.data() + idx, options.dictionary_id);
+        }
+        uint32_t hc = detail_xxhash::xxh32::hash(
+                reinterpret_cast<const unsigned char*>(out.data() + desc_start), out.size() - desc_start);
+        out.push_back(static_cast<char>((hc >> 8) & 0xff));
+        write_out(sink);
+    }
+
+    template<typename Sink>
+    void compress_job(Sink& sink, bool last) {
+        if (workers.get()) {
+            if (workers->next_input().empty()) {
+                return;
+            }
+            workers->submit(last, [&sink](span<const char> blocks) {
+                write_all(sink, blocks);
+            });
+            workers->next_input().clear();
+        } else if (!pending.empty()) {
+            context.process(pending, last, out);
+            pending.clear();
+            write_out(sink);
+        }
+    }
+
+    template<typename Sink>
+    void write_out(Sink& sink) {
+        write_all(sink, span<const char>(out.data(), out.size()));
+        out.clear();
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_LZ4_COMPRESSOR_HPP */
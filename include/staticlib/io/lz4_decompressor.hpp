@@ -0,0 +1,342 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_decompressor.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:40 PM
+ */
+
+#ifndef STATICLIB_IO_LZ4_DECOMPRESSOR_HPP
+#define STATICLIB_IO_LZ4_DECOMPRESSOR_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/frame_input.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/lz4_format.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/xxhash.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_lz4 {
+
+/**
+ * Streaming LZ4 frame decompressor, supports linked and independent blocks,
+ * dictionaries, skippable frames and concatenated frames
+ */
+class decompressor {
+    // allows copying literals and matches in 16 byte chunks
+    static const size_t slack = 32;
+
+    std::string dictionary;
+    detail_frame::input_buffer input;
+    std::vector<char> hist;
+    std::vector<unsigned char> block;
+    size_t hist_cap = 0;
+    size_t out_pos = 0;
+    size_t out_end = 0;
+    size_t block_max = 0;
+    bool in_frame = false;
+    bool independent = false;
+    bool block_checksum = false;
+    bool content_checksum = false;
+    bool finished = false;
+    size_t frames_count = 0;
+    std::streamsize content_size = -1;
+    uint64_t frame_out = 0;
+    detail_xxhash::xxh32 content_hash;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param dictionary dictionary that was used for compression, only last 64 KiB are used
+     */
+    explicit decompressor(const std::string& dictionary) :
+    dictionary(dictionary.size() <= max_dictionary ? dictionary :
+            dictionary.substr(dictionary.size() - max_dictionary)),
+    input(1 << 16) { }
+
+    /**
+     * Resets the decompressor, allocated buffers are kept
+     * 
+     * @param keep_input whether to keep data that was read from the source
+     *        but was not decompressed yet
+     */
+    void reset(bool keep_input) {
+        if (!keep_input) {
+            input.clear();
+        }
+        out_pos = 0;
+        out_end = 0;
+        in_frame = false;
+        finished = false;
+        frames_count = 0;
+        content_size = -1;
+    }
+
+    /**
+     * Reads decompressed data, single block is decompressed at a time
+     * 
+     * @param src source of compressed data
+     * @param span buffer span
+     * @return number of bytes read or "eof" at the end of compressed data
+     * @throws io_exception on invalid or truncated compressed data
+     */
+    template<typename Source>
+    std::streamsize read(Source& src, span<char> span) {
+        while (out_pos == out_end && !finished && span.size() > 0) {
+            decompress_next(src);
+        }
+        size_t avail = out_end - out_pos;
+        size_t len = span.size() <= avail ? span.size() : avail;
+        if (len > 0) {
+            std::memcpy(span.data(), hist.data() + out_pos, len);
+            out_pos += len;
+            return static_cast<std::streamsize>(len);
+        }
+        if (finished) {
+            return std::char_traits<char>::eof();
+        }
+        return 0;
+    }
+
+    /**
+     * Returns uncompressed size stored in the header of the current frame
+     * 
+     * @return uncompressed size, -1 if it is unknown
+     */
+    std::streamsize get_content_size() const {
+        return content_size;
+    }
+
+private:
+    template<typename Source>
+    void decompress_next(Source& src) {
+        if (!in_frame) {
+            if (!input.has_more(src)) {
+                if (0 == frames_count) throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+                finished = true;
+                return;
+            }
+            read_header(src);
+            return;
+        }
+        uint32_t header = static_cast<uint32_t>(input.read_le(src, 4));
+        if (0 == header) {
+            finish_frame(src);
+            return;
+        }
+        size_t len = header & ~uncompressed_flag;
+        if (len > block_max) throw io_exception(TRACEMSG("Invalid LZ4 block size, size: [" +
+                sl::support::to_string(len) + "], max: [" + sl::support::to_string(block_max) + "]"));
+        prepare_history();
+        if (0 != (header & uncompressed_flag)) {
+            input.read_exact(src, hist.data() + out_end, len);
+            check_block(src, reinterpret_cast<const unsigned char*>(hist.data() + out_end), len);
+            out_end += len;
+        } else {
+            block.resize(len);
+            input.read_exact(src, reinterpret_cast<char*>(block.data()), len);
+            check_block(src, block.data(), len);
+            out_end = decode_block(block.data(), len, hist.data(), out_end, out_end + block_max);
+        }
+        if (content_checksum) {
+            content_hash.update(reinterpret_cast<const unsigned char*>(hist.data() + out_pos), out_end - out_pos);
+        }
+        frame_out += out_end - out_pos;
+    }
+
+    template<typename Source>
+    void read_header(Source& src) {
+        for (;;) {
+            uint32_t magic = static_cast<uint32_t>(input.read_le(src, 4));
+            if (skippable_magic == (magic & skippable_mask)) {
+                input.skip(src, static_cast<size_t>(input.read_le(src, 4)));
+                if (!input.has_more(src)) {
+                    finished = 0 != frames_count;
+                    if (!finished) throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+                    return;
+                }
+                continue;
+            }
+            if (frame_magic != magic) throw io_exception(TRACEMSG(
+                    "Invalid LZ4 frame magic number: [" + sl::support::to_string(magic) + "]"));
+            break;
+        }
+        unsigned char desc[15];
+        input.read_exact(src, reinterpret_cast<char*>(desc), 2);
+        unsigned char flg = desc[0];
+        unsigned char bd = desc[1];
+        size_t bsid = (bd >> 4) & 7;
+        if (0x40 != (flg & 0xc2) || 0 != (bd & 0x8f) || bsid < 4) throw io_exception(TRACEMSG(
+                "Invalid LZ4 frame descriptor, FLG: [" + sl::support::to_string(static_cast<int>(flg)) + "]," +
+                " BD: [" + sl::support::to_string(static_cast<int>(bd)) + "]"));
+        size_t desc_len = 2;
+        if (0 != (flg & 0x08)) {
+            input.read_exact(src, reinterpret_cast<char*>(desc + desc_len), 8);
+            desc_len += 8;
+        }
+        if (0 != (flg & 0x01)) {
+            input.read_exact(src, reinterpret_cast<char*>(desc + desc_len), 4);
+            desc_len += 4;
+        }
+        unsigned char hc = static_cast<unsigned char>(input.read_le(src, 1));
+        uint32_t expected = (detail_xxhash::xxh32::hash(desc, desc_len) >> 8) & 0xff;
+        if (expected != hc) throw io_exception(TRACEMSG("Invalid LZ4 frame header checksum"));
+        content_size = -1;
+        if (0 != (flg & 0x08)) {
+            uint64_t size = static_cast<uint64_t>(read32(desc + 2)) |
+                    (static_cast<uint64_t>(read32(desc + 6)) << 32);
+            if (size > static_cast<uint64_t>(std::numeric_limits<std::streamsize>::max())) throw io_exception(TRACEMSG(
+                    "Invalid LZ4 frame content size: [" + sl::support::to_string(size) + "]"));
+            content_size = static_cast<std::streamsize>(size);
+        }
+        if (0 != (flg & 0x01) && dictionary.empty()) throw io_exception(TRACEMSG(
+                "LZ4 frame requires a dictionary, ID: [" + sl::support::to_string(read32(desc + desc_len - 4)) + "]"));
+        independent = 0 != (flg & 0x20);
+        block_checksum = 0 != (flg & 0x10);
+        content_checksum = 0 != (flg & 0x04);
+        block_max = static_cast<size_t>(1) << (8 + 2 * bsid);
+        size_t cap = max_dictionary + 2 * block_max;
+        if (hist_cap < cap) {
+            hist.resize(cap + slack);
+            hist_cap = cap;
+        }
+        std::memcpy(hist.data(), dictionary.data(), dictionary.size());
+        out_pos = dictionary.size();
+        out_end = dictionary.size();
+        frame_out = 0;
+        content_hash.reset();
+        in_frame = true;
+    }
+
+    template<typename Source>
+    void finish_frame(Source& src) {
+        if (content_checksum) {
+            uint32_t expected = static_cast<uint32_t>(input.read_le(src, 4));
+            if (content_hash.digest() != expected) throw io_exception(TRACEMSG(
+                    "Invalid content checksum of LZ4 frame"));
+        }
+        if (content_size >= 0 && static_cast<uint64_t>(content_size) != frame_out) throw io_exception(TRACEMSG(
+                "Invalid uncompressed size of LZ4 frame, expected: [" + sl::support::to_string(content_size) + "]," +
+                " actual: [" + sl::support::to_string(frame_out) + "]"));
+        in_frame = false;
+        frames_count += 1;
+    }
+
+    // all output is consumed at this point
+    void prepare_history() {
+        if (independent) {
+            std::memcpy(hist.data(), dictionary.data(), dictionary.size());
+            out_end = dictionary.size();
+        } else if (out_end + block_max > hist_cap) {
+            std::memmove(hist.data(), hist.data() + out_end - max_dictionary, max_dictionary);
+            out_end = max_dictionary;
+        }
+        out_pos = out_end;
+    }
+
+    template<typename Source>
+    void check_block(Source& src, const unsigned char* data, size_t len) {
+        if (block_checksum) {
+            uint32_t expected = static_cast<uint32_t>(input.read_le(src, 4));
+            if (detail_xxhash::xxh32::hash(data, len) != expected) throw io_exception(TRACEMSG(
+                    "Invalid block checksum of LZ4 frame"));
+        }
+    }
+
+    static size_t read_length(const unsigned char* src, size_t& ip, size_t src_len, size_t len) {
+        unsigned char byte = 255;
+        while (255 == byte) {
+            if (ip >= src_len) throw io_exception(TRACEMSG("Invalid LZ4 compressed block"));
+            byte = src[ip++];
+            len += byte;
+        }
+        return len;
+    }
+
+    // history before "op" is a valid prefix, up to "slack" bytes after "limit" may be overwritten
+    static size_t decode_block(const unsigned char* src, size_t src_len, char* hist, size_t op, size_t limit) {
+        size_t ip = 0;
+        for (;;) {
+            if (ip >= src_len) throw io_exception(TRACEMSG("Invalid LZ4 compressed block"));
+            unsigned char token = src[ip++];
+            size_t lit = token >> 4;
+            if (lit <= 14 && src_len - ip >= 16) {
+                std::memcpy(hist + op, src + ip, 16);
+            } else {
+                if (15 == lit) {
+                    lit = read_length(src, ip, src_len, lit);
+                }
+                if (lit > src_len - ip || lit > limit - op) throw io_exception(TRACEMSG(
+                        "Invalid LZ4 compressed block"));
+                std::memcpy(hist + op, src + ip, lit);
+            }
+            if (lit > limit - op) throw io_exception(TRACEMSG("Invalid LZ4 compressed block"));
+            ip += lit;
+            op += lit;
+            if (ip == src_len) {
+                return op;
+            }
+            if (src_len - ip < 2) throw io_exception(TRACEMSG("Invalid LZ4 compressed block"));
+            size_t offset = static_cast<size_t>(src[ip]) | (static_cast<size_t>(src[ip + 1]) << 8);
+            ip += 2;
+            size_t mlen = token & 15;
+            if (15 == mlen) {
+                mlen = read_length(src, ip, src_len, mlen);
+            }
+            mlen += min_match;
+            if (0 == offset || offset > op || mlen > limit - op) throw io_exception(TRACEMSG(
+                    "Invalid LZ4 compressed block"));
+            char* dest = hist + op;
+            const char* from = dest - offset;
+            if (offset >= 16) {
+                for (size_t i = 0; i < mlen; i += 16) {
+                    std::memcpy(dest + i, from + i, 16);
+                }
+            } else if (offset >= 8) {
+                for (size_t i = 0; i < mlen; i += 8) {
+                    std::memcpy(dest + i, from + i, 8);
+                }
+            } else {
+                for (size_t i = 0; i < mlen; i++) {
+                    dest[i] = from[i];
+                }
+            }
+            op += mlen;
+        }
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_LZ4_DECOMPRESSOR_HPP */
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_format.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:50 PM
+ */
+
+#ifndef STATICLIB_IO_LZ4_FORMAT_HPP
+#define STATICLIB_IO_LZ4_FORMAT_HPP
+
+#include <cstdint>
+#include <ios>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Options of LZ4 frame compression
+ */
+struct lz4_options {
+    /**
+     * Max uncompressed size of a block, one of 64 KiB, 256 KiB, 1 MiB or 4 MiB
+     */
+    size_t block_size = 1 << 16;
+    /**
+     * Whether to append checksum to each block
+     */
+    bool block_checksum = false;
+    /**
+     * Whether to append checksum of uncompressed data to the frame
+     */
+    bool content_checksum = true;
+    /**
+     * Uncompressed data size to store in the frame header, negative if unknown;
+     * "size_hint" operation can be used to get it from the input source
+     */
+    std::streamsize content_size = -1;
+    /**
+     * Data that is likely to be found in compressed data,
+     * last 64 KiB of it are used, must be the same for decompression
+     */
+    std::string dictionary;
+    /**
+     * Dictionary ID to store in the frame header, zero for none
+     */
+    uint32_t dictionary_id = 0;
+    /**
+     * Greater values make compression faster at the cost of compression ratio
+     */
+    int acceleration = 1;
+    /**
+     * Number of threads that compress blocks concurrently,
+     * zero to compress blocks in the calling thread
+     */
+    size_t workers = 0;
+};
+
+namespace detail_lz4 {
+
+const uint32_t frame_magic = 0x184D2204;
+const uint32_t skippable_magic = 0x184D2A50;
+const uint32_t skippable_mask = 0xFFFFFFF0;
+const size_t min_match = 4;
+// last literals and last match start restrictions
+const size_t last_literals = 5;
+const size_t mf_limit = 12;
+const size_t max_distance = 65535;
+const size_t max_dictionary = 1 << 16;
+const uint32_t uncompressed_flag = 0x80000000;
+
+inline size_t block_size_id(size_t block_size) {
+    switch (block_size) {
+    case 1 << 16: return 4;
+    case 1 << 18: return 5;
+    case 1 << 20: return 6;
+    case 1 << 22: return 7;
+    default: return 0;
+    }
+}
+
+inline uint32_t read32(const unsigned char* ptr) {
+    return static_cast<uint32_t>(ptr[0]) | (static_cast<uint32_t>(ptr[1]) << 8) |
+            (static_cast<uint32_t>(ptr[2]) << 16) | (static_cast<uint32_t>(ptr[3]) << 24);
+}
+
+inline void write32(char* ptr, uint32_t value) {
+    ptr[0] = static_cast<char>(value & 0xff);
+    ptr[1] = static_cast<char>((value >> 8) & 0xff);
+    ptr[2] = static_cast<char>((value >> 16) & 0xff);
+    ptr[3] = static_cast<char>((value >> 24) & 0xff);
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_LZ4_FORMAT_HPP */
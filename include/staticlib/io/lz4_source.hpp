@@ -0,0 +1,179 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_source.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:59 PM
+ */
+
+#ifndef STATICLIB_IO_LZ4_SOURCE_HPP
+#define STATICLIB_IO_LZ4_SOURCE_HPP
+
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/lz4_decompressor.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source wrapper that decompresses data in LZ4 frame format,
+ * concatenated frames are decompressed as a single stream,
+ * compressed data is read from the input source in chunks,
+ * so more data than the compressed stream contains may be read from it
+ */
+template<typename Source>
+class lz4_source {
+    /**
+     * Input source
+     */
+    Source src;
+    /**
+     * Decompressor
+     */
+    detail_lz4::decompressor decompressor;
+
+public:
+    /**
+     * Constructor,
+     * created source wrapper will own specified source
+     * 
+     * @param src input source
+     * @param dictionary dictionary that was used for compression
+     */
+    explicit lz4_source(Source&& src, const std::string& dictionary = "") :
+    src(std::move(src)),
+    decompressor(dictionary) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    lz4_source(const lz4_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    lz4_source& operator=(const lz4_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    lz4_source(lz4_source&& other) STATICLIB_NOEXCEPT :
+    src(std::move(other.src)),
+    decompressor(std::move(other.decompressor)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    lz4_source& operator=(lz4_source&& other) STATICLIB_NOEXCEPT {
+        src = std::move(other.src);
+        decompressor = std::move(other.decompressor);
+        return *this;
+    }
+
+    /**
+     * Decompressing read implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes read or "eof" at the end of compressed data
+     * @throws io_exception on invalid or truncated compressed data
+     */
+    std::streamsize read(span<char> span) {
+        return decompressor.read(src, span);
+    }
+
+    /**
+     * Returns uncompressed size stored in the header of the current frame,
+     * available after the first read call
+     * 
+     * @return uncompressed size, -1 if it is unknown
+     */
+    std::streamsize get_content_size() const {
+        return decompressor.get_content_size();
+    }
+
+    /**
+     * Resets this source to decompress the stream from the
+     * specified input source, allocated buffers are reused
+     * 
+     * @param source new input source
+     */
+    void reset(Source&& source) {
+        src = std::move(source);
+        decompressor.reset(false);
+    }
+
+    /**
+     * Underlying source accessor
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return src;
+    }
+
+};
+
+/**
+ * Factory function for creating LZ4 sources,
+ * created source wrapper will own specified source
+ * 
+ * @param source input source
+ * @param dictionary dictionary that was used for compression
+ * @return LZ4 source
+ */
+template <typename Source,
+        class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
+lz4_source<Source> make_lz4_source(Source&& source, const std::string& dictionary = "") {
+    return lz4_source<Source>(std::move(source), dictionary);
+}
+
+/**
+ * Factory function for creating LZ4 sources,
+ * created source wrapper will NOT own specified source
+ * 
+ * @param source input source
+ * @param dictionary dictionary that was used for compression
+ * @return LZ4 source
+ */
+template <typename Source>
+lz4_source<reference_source<Source>> make_lz4_source(Source& source, const std::string& dictionary = "") {
+    return lz4_source<reference_source<Source>>(make_reference_source(source), dictionary);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_LZ4_SOURCE_HPP */
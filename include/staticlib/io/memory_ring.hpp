@@ -0,0 +1,193 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   memory_ring.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 9:12 AM
+ */
+
+#ifndef STATICLIB_IO_MEMORY_RING_HPP
+#define STATICLIB_IO_MEMORY_RING_HPP
+
+#include <cstring>
+#include <atomic>
+#include <ios>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Ring buffer over the fixed-size memory area, that is not owned
+ * by the ring. Can be used concurrently by a single writer thread
+ * and a single reader thread without locking and allocations.
+ * Usually accessed through "ring_memory_sink" and "ring_memory_source".
+ */
+class memory_ring {
+    /**
+     * Memory area
+     */
+    span<char> area;
+    /**
+     * Total number of bytes written, modified only by writer
+     */
+    std::atomic<size_t> written;
+    /**
+     * Padding to keep writer and reader counters in separate cache lines
+     */
+    char written_pad[64];
+    /**
+     * Total number of bytes read, modified only by reader
+     */
+    std::atomic<size_t> read_count;
+    /**
+     * Padding to keep reader counter and close flag in separate cache lines
+     */
+    char read_pad[64];
+    /**
+     * Whether writer closed the ring
+     */
+    std::atomic<bool> closed;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param area memory area to use for the ring storage
+     */
+    explicit memory_ring(span<char> area) :
+    area(area),
+    written(0),
+    read_count(0),
+    closed(false) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    memory_ring(const memory_ring&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    memory_ring& operator=(const memory_ring&) = delete;
+
+    /**
+     * Writes as much data as fits into the free space of the ring,
+     * must be called only from the writer thread
+     * 
+     * @param span buffer span
+     * @return number of bytes written, zero if ring is full
+     */
+    size_t write(span<const char> span) {
+        size_t wr = written.load(std::memory_order_relaxed);
+        size_t rd = read_count.load(std::memory_order_acquire);
+        size_t free_space = area.size() - (wr - rd);
+        size_t len = span.size() <= free_space ? span.size() : free_space;
+        if (len > 0) {
+            size_t start = wr % area.size();
+            size_t head = area.size() - start;
+            if (len <= head) {
+                std::memcpy(area.data() + start, span.data(), len);
+            } else {
+                std::memcpy(area.data() + start, span.data(), head);
+                std::memcpy(area.data(), span.data() + head, len - head);
+            }
+            written.store(wr + len, std::memory_order_release);
+        }
+        return len;
+    }
+
+    /**
+     * Reads as much data as available in the ring,
+     * must be called only from the reader thread
+     * 
+     * @param span buffer span
+     * @return number of bytes read, zero if ring is empty
+     */
+    size_t read(span<char> span) {
+        size_t rd = read_count.load(std::memory_order_relaxed);
+        size_t wr = written.load(std::memory_order_acquire);
+        size_t avail = wr - rd;
+        size_t len = span.size() <= avail ? span.size() : avail;
+        if (len > 0) {
+            size_t start = rd % area.size();
+            size_t head = area.size() - start;
+            if (len <= head) {
+                std::memcpy(span.data(), area.data() + start, len);
+            } else {
+                std::memcpy(span.data(), area.data() + start, head);
+                std::memcpy(span.data() + head, area.data(), len - head);
+            }
+            read_count.store(rd + len, std::memory_order_release);
+        }
+        return len;
+    }
+
+    /**
+     * Marks the ring as closed, reader will get EOF
+     * after all written data is consumed
+     */
+    void close() {
+        closed.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Checks whether the ring was closed by writer
+     * 
+     * @return true if ring was closed, false otherwise
+     */
+    bool is_closed() const {
+        return closed.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Returns number of bytes available for reading,
+     * value may be outdated when called concurrently with writer or reader
+     * 
+     * @return number of bytes available for reading
+     */
+    size_t get_available() const {
+        // reader counter never passes the writer one, so it is loaded first
+        size_t rd = read_count.load(std::memory_order_acquire);
+        size_t wr = written.load(std::memory_order_acquire);
+        return wr - rd;
+    }
+
+    /**
+     * Returns capacity of the ring
+     * 
+     * @return ring capacity in bytes
+     */
+    size_t get_capacity() const {
+        return area.size();
+    }
+
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_MEMORY_RING_HPP */
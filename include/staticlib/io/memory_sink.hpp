@@ -31,6 +31,7 @@
 #include "staticlib/support.hpp"
 
 #include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/seekable.hpp"
 #include "staticlib/io/span.hpp"
 
 namespace staticlib {
@@ -38,7 +39,8 @@ namespace io {
 
 /**
  * Sink implementation that writes into fixed-size
- * memory area. Exception is thrown on overwrite.
+ * memory area. Exception is thrown on overwrite
+ * unless partial writes are enabled.
  */
 class memory_sink {
 
@@ -50,12 +52,23 @@ class memory_sink {
      * Dest index
      */
     size_t idx = 0;
+    /**
+     * Whether to accept partial writes instead of throwing on overwrite
+     */
+    bool partial_writes;
+
 public:
     /**
      * Constructor
+     * 
+     * @param dest destination memory area
+     * @param partial_writes whether to write as much data as fits into
+     *        the remaining area (returning the number of bytes written)
+     *        instead of throwing on overwrite
      */
-    memory_sink(span<char> dest):
-    dest(dest) { }
+    memory_sink(span<char> dest, bool partial_writes = false):
+    dest(dest),
+    partial_writes(partial_writes) { }
 
     /**
      * Copy constructor
@@ -64,7 +77,8 @@ public:
      */
     memory_sink(const memory_sink& other) :
     dest(other.dest),
-    idx(other.idx) { }
+    idx(other.idx),
+    partial_writes(other.partial_writes) { }
 
     /**
      * Copy assignment operator
@@ -75,6 +89,7 @@ public:
     memory_sink& operator=(const memory_sink& other) {
         dest = other.dest;
         idx = other.idx;
+        partial_writes = other.partial_writes;
         return *this;
     }
 
@@ -85,7 +100,8 @@ public:
      */
     memory_sink(memory_sink&& other) STATICLIB_NOEXCEPT :
     dest(std::move(other.dest)),
-    idx(other.idx) { }
+    idx(other.idx),
+    partial_writes(other.partial_writes) { }
 
     /**
      * Move assignment operator
@@ -96,6 +112,7 @@ public:
     memory_sink& operator=(memory_sink&& other) STATICLIB_NOEXCEPT {
         dest = std::move(other.dest);
         idx = other.idx;
+        partial_writes = other.partial_writes;
         return *this;
     }
 
@@ -103,19 +120,53 @@ public:
      * Write implementation
      * 
      * @param span buffer span
-     * @return specified length
+     * @return specified length, or, with partial writes enabled,
+     *         number of bytes that did fit into the remaining area
      */
     std::streamsize write(span<const char> span) {
-        if (span.size() <= dest.size() - idx) {
+        size_t avail = dest.size() - idx;
+        if (span.size() <= avail) {
             std::memcpy(dest.data() + idx, span.data(), span.size());
             idx += span.size();
             return span.size_signed();
         }
+        if (partial_writes) {
+            std::memcpy(dest.data() + idx, span.data(), avail);
+            idx += avail;
+            return static_cast<std::streamsize>(avail);
+        }
         throw io_exception(TRACEMSG("Write overflow," + 
                 " req: [" + sl::support::to_string(span.size()) + "]," +
                 " avail: [" + sl::support::to_string(dest.size() - idx) + "]"));
     }
 
+    /**
+     * Positional write implementation, does not change
+     * the current position and can be called concurrently
+     * for non-overlapping regions
+     * 
+     * @param offset offset in destination area to write at
+     * @param span buffer span
+     * @return number of bytes written
+     */
+    std::streamsize write_at(size_t offset, span<const char> span) {
+        size_t avail = offset < dest.size() ? dest.size() - offset : 0;
+        if (span.size() <= avail) {
+            std::memcpy(dest.data() + offset, span.data(), span.size());
+            return span.size_signed();
+        }
+        if (partial_writes) {
+            if (avail > 0) {
+                std::memcpy(dest.data() + offset, span.data(), avail);
+            }
+            return static_cast<std::streamsize>(avail);
+        }
+        throw io_exception(TRACEMSG("Write overflow," +
+                " offset: [" + sl::support::to_string(offset) + "]," +
+                " req: [" + sl::support::to_string(span.size()) + "]," +
+                " avail: [" + sl::support::to_string(avail) + "]"));
+    }
+
     /**
      * No-op flush implementation
      * 
@@ -126,6 +177,64 @@ public:
         return 0;
     }
 
+    /**
+     * Changes current position, subsequent writes will
+     * overwrite the data starting from the new position
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     * @throws io_exception if new position is out of bounds
+     */
+    size_t seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg) {
+        idx = seek_position(idx, dest.size(), offset, whence);
+        return idx;
+    }
+
+    /**
+     * Current position accessor
+     * 
+     * @return current position
+     */
+    size_t tell() const {
+        return idx;
+    }
+
+    /**
+     * Memory area size accessor
+     * 
+     * @return size of the memory area
+     */
+    size_t size() const {
+        return dest.size();
+    }
+
+    /**
+     * Returns number of bytes written into the memory area
+     * 
+     * @return number of bytes written
+     */
+    size_t get_count() const {
+        return idx;
+    }
+
+    /**
+     * Returns number of bytes that still can be written
+     * 
+     * @return remaining space in bytes
+     */
+    size_t get_available() const {
+        return dest.size() - idx;
+    }
+
+    /**
+     * Rewinds the sink to the start of the memory area,
+     * so the area can be reused as a staging buffer
+     */
+    void reset() {
+        idx = 0;
+    }
+
 };
 
 } // namespace
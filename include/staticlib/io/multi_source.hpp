@@ -24,12 +24,16 @@
 #ifndef STATICLIB_IO_MULTI_SOURCE_HPP
 #define STATICLIB_IO_MULTI_SOURCE_HPP
 
+#include <array>
 #include <ios>
 #include <vector>
 
 #include "staticlib/config.hpp"
 
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/operations.hpp"
 #include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/traits.hpp"
 #include "staticlib/io/span.hpp"
 
 namespace staticlib {
@@ -112,6 +116,113 @@ public:
         return std::char_traits<char>::eof();
     }
 
+    /**
+     * Lends data from the current source in range,
+     * available only if sources implement "borrow_read"
+     * 
+     * @param max max number of bytes to lend, must be positive
+     * @return span over the lent data, empty span if all sources are exhausted
+     */
+    template<typename T = typename Range::value_type>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        while (sources.end() != it) {
+            auto res = it->borrow_read(max);
+            if (res.size() > 0) {
+                return res;
+            }
+            ++it;
+        }
+        return span<const char>(nullptr, 0);
+    }
+
+    /**
+     * Skips specified number of bytes over the range of sources,
+     * each source is skipped using its own "skip", "seek" or "consume"
+     * methods if it implements them, and is read otherwise
+     * 
+     * @param to_skip number of bytes to skip
+     * @throws io_exception if sources have less than specified number of bytes
+     */
+    void skip(size_t to_skip) {
+        std::array<char, 4096> buf;
+        size_t remaining = to_skip;
+        while (remaining > 0 && sources.end() != it) {
+            bool exhausted = false;
+            size_t skipped = skip_current(*it, span<char>(buf), remaining, exhausted,
+                    detail_dispatch::priority<3>());
+            remaining -= skipped;
+            if (remaining > 0) {
+                if (!exhausted) {
+                    // no progress in current source
+                    break;
+                }
+                ++it;
+            }
+        }
+        if (remaining > 0) throw io_exception(TRACEMSG(
+                "Skip amount: [" + sl::support::to_string(to_skip - remaining) + "]" +
+                " of expected: [" + sl::support::to_string(to_skip) + "]"));
+    }
+
+private:
+    // source size is known, skipped with its "skip" or "seek"
+    template<typename Source>
+    auto skip_current(Source& src, span<char> buf, size_t to_skip, bool& exhausted,
+            detail_dispatch::priority<3>) -> decltype(src.seek(std::streamsize(0), std::ios_base::cur),
+                    src.tell(), src.size(), size_t()) {
+        size_t pos = static_cast<size_t>(src.tell());
+        size_t size = static_cast<size_t>(src.size());
+        size_t avail = size > pos ? size - pos : 0;
+        size_t len = to_skip <= avail ? to_skip : avail;
+        if (len > 0) {
+            detail_skip::skip_dispatch(src, buf, len);
+        }
+        exhausted = len < to_skip;
+        return len;
+    }
+
+    // source size is unknown, source must have enough data
+    template<typename Source>
+    auto skip_current(Source& src, span<char>, size_t to_skip, bool&,
+            detail_dispatch::priority<2>) -> decltype(src.skip(to_skip), size_t()) {
+        src.skip(to_skip);
+        return to_skip;
+    }
+
+    // buffered source, drop the buffer first
+    template<typename Source>
+    auto skip_current(Source& src, span<char> buf, size_t to_skip, bool& exhausted,
+            detail_dispatch::priority<1>) -> decltype(src.consume(to_skip), src.get_source(), size_t()) {
+        size_t consumed = src.consume(to_skip);
+        if (consumed == to_skip) {
+            return consumed;
+        }
+        return consumed + skip_current(src.get_source(), buf, to_skip - consumed, exhausted,
+                detail_dispatch::priority<3>());
+    }
+
+    // read and discard
+    template<typename Source>
+    size_t skip_current(Source& src, span<char> buf, size_t to_skip, bool& exhausted,
+            detail_dispatch::priority<0>) {
+        size_t skipped = 0;
+        while (skipped < to_skip) {
+            size_t len = to_skip - skipped <= buf.size() ? to_skip - skipped : buf.size();
+            std::streamsize read = src.read({buf.data(), len});
+            if (std::char_traits<char>::eof() == read) {
+                exhausted = true;
+                break;
+            }
+            if (!sl::support::is_sizet(read)) throw io_exception(TRACEMSG(
+                    "Invalid result returned by underlying 'read' operation: [" + sl::support::to_string(read) + "]"));
+            if (0 == read) {
+                break;
+            }
+            skipped += static_cast<size_t>(read);
+        }
+        return skipped;
+    }
+
 };
 
 /**
@@ -0,0 +1,289 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   operation_metrics.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:05 PM
+ */
+
+#ifndef STATICLIB_IO_OPERATION_METRICS_HPP
+#define STATICLIB_IO_OPERATION_METRICS_HPP
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <ios>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Number of buckets in latency histogram, bucket "i" holds calls
+ * that took from 2^i to 2^(i+1) nanoseconds, first bucket also holds
+ * calls that took less than 1 nanosecond, last bucket also holds
+ * all calls that took longer
+ */
+const size_t latency_buckets_count = 32;
+
+/**
+ * Point-in-time copy of the metrics of a single operation
+ * (read, write or flush), contains plain values that can be
+ * passed to metrics exporter
+ */
+struct operation_snapshot {
+    /**
+     * Number of calls
+     */
+    uint64_t calls = 0;
+    /**
+     * Number of bytes processed
+     */
+    uint64_t bytes = 0;
+    /**
+     * Number of calls that processed less bytes than requested
+     * (EOFs are not included)
+     */
+    uint64_t short_calls = 0;
+    /**
+     * Number of calls that returned EOF
+     */
+    uint64_t eofs = 0;
+    /**
+     * Number of calls that threw an exception
+     */
+    uint64_t exceptions = 0;
+    /**
+     * Sum of latencies of all calls in nanoseconds
+     */
+    uint64_t latency_total_ns = 0;
+    /**
+     * Latency histogram, see "latency_buckets_count"
+     */
+    std::array<uint64_t, latency_buckets_count> latency_histogram;
+
+    /**
+     * Constructor
+     */
+    operation_snapshot() {
+        latency_histogram.fill(0);
+    }
+
+    /**
+     * Returns approximate latency percentile as an upper bound
+     * of the histogram bucket where it falls into
+     * 
+     * @param fraction percentile as a fraction, e.g. "0.99"
+     * @return latency in nanoseconds, zero if no calls were recorded
+     */
+    uint64_t get_latency_percentile_ns(double fraction) const {
+        uint64_t total = 0;
+        for (uint64_t cnt : latency_histogram) {
+            total += cnt;
+        }
+        if (0 == total) {
+            return 0;
+        }
+        uint64_t threshold = static_cast<uint64_t>(static_cast<double>(total) * fraction);
+        if (threshold >= total) {
+            threshold = total - 1;
+        }
+        uint64_t seen = 0;
+        for (size_t i = 0; i < latency_histogram.size(); i++) {
+            seen += latency_histogram[i];
+            if (seen > threshold) {
+                return static_cast<uint64_t>(2) << i;
+            }
+        }
+        return static_cast<uint64_t>(2) << (latency_histogram.size() - 1);
+    }
+};
+
+/**
+ * Metrics of a single operation (read, write or flush).
+ * Counters are updated with relaxed atomic increments, so recording
+ * is cheap and does not take locks, and metrics can be scraped
+ * from another thread with "snapshot". Counters are independent from
+ * each other, snapshot taken concurrently with recording can be
+ * off by the calls that are in progress.
+ */
+class operation_metrics {
+    /**
+     * Number of calls
+     */
+    std::atomic<uint64_t> calls;
+    /**
+     * Number of bytes processed
+     */
+    std::atomic<uint64_t> bytes;
+    /**
+     * Number of short calls
+     */
+    std::atomic<uint64_t> short_calls;
+    /**
+     * Number of EOFs
+     */
+    std::atomic<uint64_t> eofs;
+    /**
+     * Number of exceptions
+     */
+    std::atomic<uint64_t> exceptions;
+    /**
+     * Sum of latencies
+     */
+    std::atomic<uint64_t> latency_total_ns;
+    /**
+     * Latency histogram
+     */
+    std::array<std::atomic<uint64_t>, latency_buckets_count> latency_histogram;
+
+public:
+    /**
+     * Constructor
+     */
+    operation_metrics() :
+    calls(0),
+    bytes(0),
+    short_calls(0),
+    eofs(0),
+    exceptions(0),
+    latency_total_ns(0) {
+        for (auto& el : latency_histogram) {
+            el.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    operation_metrics(const operation_metrics&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    operation_metrics& operator=(const operation_metrics&) = delete;
+
+    /**
+     * Records a completed call
+     * 
+     * @param requested number of bytes requested by the caller
+     * @param result value returned from the call
+     * @param latency_ns call duration in nanoseconds
+     */
+    void record(size_t requested, std::streamsize result, uint64_t latency_ns) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if (std::char_traits<char>::eof() == result) {
+            eofs.fetch_add(1, std::memory_order_relaxed);
+        } else if (result >= 0) {
+            bytes.fetch_add(static_cast<uint64_t>(result), std::memory_order_relaxed);
+            if (static_cast<size_t>(result) < requested) {
+                short_calls.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        record_latency(latency_ns);
+    }
+
+    /**
+     * Records a call that threw an exception
+     * 
+     * @param latency_ns call duration in nanoseconds
+     */
+    void record_exception(uint64_t latency_ns) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        exceptions.fetch_add(1, std::memory_order_relaxed);
+        record_latency(latency_ns);
+    }
+
+    /**
+     * Returns current values of all counters
+     * 
+     * @return metrics snapshot
+     */
+    operation_snapshot snapshot() const {
+        operation_snapshot res;
+        res.calls = calls.load(std::memory_order_relaxed);
+        res.bytes = bytes.load(std::memory_order_relaxed);
+        res.short_calls = short_calls.load(std::memory_order_relaxed);
+        res.eofs = eofs.load(std::memory_order_relaxed);
+        res.exceptions = exceptions.load(std::memory_order_relaxed);
+        res.latency_total_ns = latency_total_ns.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < latency_histogram.size(); i++) {
+            res.latency_histogram[i] = latency_histogram[i].load(std::memory_order_relaxed);
+        }
+        return res;
+    }
+
+    /**
+     * Resets all counters to zero
+     */
+    void reset() {
+        calls.store(0, std::memory_order_relaxed);
+        bytes.store(0, std::memory_order_relaxed);
+        short_calls.store(0, std::memory_order_relaxed);
+        eofs.store(0, std::memory_order_relaxed);
+        exceptions.store(0, std::memory_order_relaxed);
+        latency_total_ns.store(0, std::memory_order_relaxed);
+        for (auto& el : latency_histogram) {
+            el.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    void record_latency(uint64_t latency_ns) {
+        latency_total_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+        size_t idx = 0;
+        while (latency_ns > 1 && idx < latency_histogram.size() - 1) {
+            latency_ns >>= 1;
+            idx += 1;
+        }
+        latency_histogram[idx].fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+namespace detail_metrics {
+
+/**
+ * Monotonic clock used for latency measurements
+ */
+typedef std::chrono::steady_clock clock;
+
+/**
+ * Returns nanoseconds elapsed since the specified time point
+ * 
+ * @param start start time point
+ * @return elapsed nanoseconds
+ */
+inline uint64_t elapsed_ns(clock::time_point start) {
+    auto diff = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+    return diff.count() > 0 ? static_cast<uint64_t>(diff.count()) : 0;
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_OPERATION_METRICS_HPP */
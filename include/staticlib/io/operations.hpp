@@ -27,19 +27,24 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cerrno>
+#include <cstring>
 #include <algorithm>
 #include <array>
 #include <ios>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include "staticlib/config.hpp"
 
+#include "staticlib/io/byte_order.hpp"
 #include "staticlib/io/io_exception.hpp"
 #include "staticlib/io/span.hpp"
 #include "staticlib/io/replacer_source.hpp"
 #include "staticlib/io/string_sink.hpp"
 #include "staticlib/io/string_source.hpp"
+#include "staticlib/io/traits.hpp"
 
 namespace staticlib {
 namespace io {
@@ -102,17 +107,50 @@ void read_exact(Source& src, span<char> span) {
             " of expected: [" + sl::support::to_string(span.size()) + "]"));
 }
 
-/**
- * Copies data from Source to Sink using specified buffer until 
- * source will be exhausted.
- * 
- * @param src iostreams source
- * @param sink iostreams sink
- * @param span buffer span
- * @return number of bytes copied
- */
+namespace detail_dispatch {
+
+template<int N>
+struct priority : priority<N - 1> { };
+
+template<>
+struct priority<0> { };
+
+} // namespace
+
+namespace detail_copy {
+
+using detail_dispatch::priority;
+
+// source lends all its data, buffer is not used
 template<typename Source, typename Sink>
-size_t copy_all(Source& src, Sink& sink, span<char> span) {
+auto copy_impl(Source& src, Sink& sink, span<char>, priority<2>)
+        -> decltype(src.next_chunk(), size_t()) {
+    size_t result = 0;
+    for (;;) {
+        span<const char> chunk = src.next_chunk();
+        if (0 == chunk.size()) break;
+        write_all(sink, chunk);
+        result += chunk.size();
+    }
+    return result;
+}
+
+// source lends its data chunk by chunk, buffer is not used
+template<typename Source, typename Sink>
+auto copy_impl(Source& src, Sink& sink, span<char>, priority<1>)
+        -> decltype(src.borrow_read(size_t(0)), size_t()) {
+    size_t result = 0;
+    for (;;) {
+        span<const char> chunk = src.borrow_read(std::numeric_limits<size_t>::max());
+        if (0 == chunk.size()) break;
+        write_all(sink, chunk);
+        result += chunk.size();
+    }
+    return result;
+}
+
+template<typename Source, typename Sink>
+size_t copy_impl(Source& src, Sink& sink, span<char> span, priority<0>) {
     size_t ulen = span.size();
     size_t result = 0;
     size_t amt;
@@ -128,6 +166,36 @@ size_t copy_all(Source& src, Sink& sink, span<char> span) {
     return result;
 }
 
+// no stack buffer is needed for lending sources
+template<uint16_t BufferSize, typename Source, typename Sink>
+size_t copy_stackbuf(Source& src, Sink& sink, std::true_type) {
+    return copy_impl(src, sink, span<char>(nullptr, 0), priority<2>());
+}
+
+template<uint16_t BufferSize, typename Source, typename Sink>
+size_t copy_stackbuf(Source& src, Sink& sink, std::false_type) {
+    std::array<char, BufferSize> buf;
+    return copy_impl(src, sink, span<char>(buf), priority<2>());
+}
+
+} // namespace
+
+/**
+ * Copies data from Source to Sink using specified buffer until 
+ * source will be exhausted. If Source implements "next_chunk()"
+ * or "borrow_read(max)", lent data is written to Sink directly
+ * and buffer is not used.
+ * 
+ * @param src iostreams source
+ * @param sink iostreams sink
+ * @param span buffer span
+ * @return number of bytes copied
+ */
+template<typename Source, typename Sink>
+size_t copy_all(Source& src, Sink& sink, span<char> span) {
+    return detail_copy::copy_impl(src, sink, span, detail_copy::priority<2>());
+}
+
 /**
  * Copies data from Source to Sink using on-stack array buffer until
  * source will be exhausted.
@@ -138,32 +206,401 @@ size_t copy_all(Source& src, Sink& sink, span<char> span) {
  */
 template<typename Source, typename Sink, uint16_t BufferSize = 4096>
 size_t copy_all(Source& src, Sink& sink) {
-    std::array<char, BufferSize> buf;
-    span<char> span(buf);
-    return copy_all(src, sink, span);
+    return detail_copy::copy_stackbuf<BufferSize>(src, sink, std::integral_constant<bool,
+            has_next_chunk<Source>::value || has_borrow_read<Source>::value>());
 }
 
+namespace detail_skip {
+
+using detail_dispatch::priority;
+
+template<typename Source>
+void skip_dispatch(Source& src, span<char> span, size_t to_skip);
+
+// upstream skip implementation
+template<typename Source>
+auto skip_impl(Source& src, span<char>, size_t to_skip, priority<3>)
+        -> decltype(src.skip(to_skip), void()) {
+    src.skip(to_skip);
+}
+
+// seekable source
+template<typename Source>
+auto skip_impl(Source& src, span<char>, size_t to_skip, priority<2>)
+        -> decltype(src.seek(std::streamsize(0), std::ios_base::cur), void()) {
+    src.seek(static_cast<std::streamsize>(to_skip), std::ios_base::cur);
+}
+
+// buffered source, drop the buffer first
+template<typename Source>
+auto skip_impl(Source& src, span<char> span, size_t to_skip, priority<1>)
+        -> decltype(src.consume(to_skip), src.get_source(), void()) {
+    size_t consumed = src.consume(to_skip);
+    if (consumed < to_skip) {
+        skip_dispatch(src.get_source(), span, to_skip - consumed);
+    }
+}
+
+// read and discard
+template<typename Source>
+void skip_impl(Source& src, span<char> span, size_t to_skip, priority<0>) {
+    if (0 == span.size()) throw io_exception(TRACEMSG(
+            "Invalid empty buffer specified for 'skip' operation"));
+    size_t ulen = span.size();
+    size_t uskip = to_skip;
+    while (uskip > 0) {
+        size_t chunklen = uskip <= ulen ? uskip : ulen;
+        io::read_exact(src, {span.data(), chunklen});
+        uskip -= chunklen;
+    }
+}
+
+template<typename Source>
+void skip_dispatch(Source& src, span<char> span, size_t to_skip) {
+    skip_impl(src, span, to_skip, priority<3>());
+}
+
+} // namespace
+
 /**
- * Skips specified number of bytes reading data repeatedly from specified
- * source into specified buffer
+ * Skips specified number of bytes in specified source.
+ * Source "skip(count)" method is used if it is available, then
+ * source "seek" is used if source is seekable, then "consume" is used
+ * if source has internal buffer. Otherwise (or, for buffered sources,
+ * for the data past the internal buffer) data is read repeatedly
+ * from specified source into specified buffer.
  * 
  * @param src input source
  * @param span buffer span
  * @param to_skip number of bytes to skip
+ * @throws io_exception if source has less than specified number of bytes
  */
 template<typename Source, typename IntTypeSkip>
 void skip(Source& src, span<char> span, IntTypeSkip to_skip) {
     if (!(sl::support::is_sizet(to_skip) && sl::support::is_streamsize(to_skip))) throw io_exception(TRACEMSG(
             "Invalid 'skip' parameter specified, to_skip: [" + sl::support::to_string(to_skip) + "]"));
-    size_t ulen = span.size();
     size_t uskip = static_cast<size_t>(to_skip);
-    while (uskip > 0) {
-        size_t chunklen = uskip <= ulen ? uskip : ulen;
-        io::read_exact(src, {span.data(), chunklen});
-        uskip -= chunklen;
+    if (uskip > 0) {
+        detail_skip::skip_dispatch(src, span, uskip);
     }
 }
 
+/**
+ * Skips specified number of bytes in specified source
+ * using on-stack array buffer, if data needs to be read
+ * 
+ * @param src input source
+ * @param to_skip number of bytes to skip
+ * @throws io_exception if source has less than specified number of bytes
+ */
+template<typename Source, typename IntTypeSkip, uint16_t BufferSize = 4096>
+void skip(Source& src, IntTypeSkip to_skip) {
+    std::array<char, BufferSize> buf;
+    skip(src, span<char>(buf), to_skip);
+}
+
+namespace detail_size_hint {
+
+using detail_dispatch::priority;
+
+// source knows its size and position
+template<typename Source>
+auto size_hint_impl(Source& src, priority<1>)
+        -> decltype(src.size(), src.tell(), std::streamsize()) {
+    size_t total = static_cast<size_t>(src.size());
+    size_t pos = static_cast<size_t>(src.tell());
+    size_t res = total >= pos ? total - pos : 0;
+    return sl::support::is_streamsize(res) ? static_cast<std::streamsize>(res) : -1;
+}
+
+// unknown
+template<typename Source>
+std::streamsize size_hint_impl(Source&, priority<0>) {
+    return -1;
+}
+
+} // namespace
+
+/**
+ * Returns the number of bytes that remain to be read from the specified source,
+ * available for sources that implement "size" and "tell" (directly or through
+ * wrappers like "counting_source" and "limited_source"). Can be used
+ * as a content size hint for compressing sinks.
+ * 
+ * @param src input source
+ * @return number of remaining bytes, -1 if it is unknown
+ */
+template<typename Source>
+std::streamsize size_hint(Source& src) {
+    return detail_size_hint::size_hint_impl(src, detail_dispatch::priority<1>());
+}
+
+namespace detail_binary {
+
+using detail_dispatch::priority;
+
+// source lends its buffer, no read loop is needed for data in buffer
+template<typename Source>
+auto read_bytes(Source& src, char* dest, size_t len, priority<1>)
+        -> decltype(src.borrow_read(size_t(0)), void()) {
+    size_t done = 0;
+    while (done < len) {
+        span<const char> chunk = src.borrow_read(len - done);
+        if (0 == chunk.size()) throw io_exception(TRACEMSG(
+                "Read amount: [" + sl::support::to_string(done) + "]" +
+                " of expected: [" + sl::support::to_string(len) + "]"));
+        std::memcpy(dest + done, chunk.data(), chunk.size());
+        done += chunk.size();
+    }
+}
+
+template<typename Source>
+void read_bytes(Source& src, char* dest, size_t len, priority<0>) {
+    read_exact(src, {dest, len});
+}
+
+template<typename T, typename Source>
+auto read_value(Source& src, bool little_endian, priority<1>)
+        -> decltype(src.borrow_read(size_t(0)), T()) {
+    span<const char> chunk = src.borrow_read(sizeof(T));
+    if (chunk.size() >= sizeof(T)) {
+        return detail_byte_order::load<T>(chunk.data(), little_endian);
+    }
+    // value crosses the end of the buffer
+    char buf[sizeof(T)];
+    if (chunk.size() > 0) {
+        std::memcpy(buf, chunk.data(), chunk.size());
+    }
+    read_bytes(src, buf + chunk.size(), sizeof(T) - chunk.size(), priority<1>());
+    return detail_byte_order::load<T>(buf, little_endian);
+}
+
+template<typename T, typename Source>
+T read_value(Source& src, bool little_endian, priority<0>) {
+    char buf[sizeof(T)];
+    read_exact(src, {buf, sizeof(T)});
+    return detail_byte_order::load<T>(buf, little_endian);
+}
+
+template<typename T, typename Sink>
+void write_value(Sink& sink, T value, bool little_endian) {
+    char buf[sizeof(T)];
+    detail_byte_order::store<T>(buf, value, little_endian);
+    write_all(sink, {buf, sizeof(T)});
+}
+
+template<typename T, typename Source>
+void read_array(Source& src, span<T> dest, bool little_endian) {
+    char* bytes = reinterpret_cast<char*>(dest.data());
+    if (dest.size() > 0) {
+        read_bytes(src, bytes, dest.size() * sizeof(T), priority<1>());
+        if (little_endian != detail_byte_order::host_little_endian) {
+            detail_byte_order::swap_array(bytes, dest.size(), sizeof(T));
+        }
+    }
+}
+
+// values are converted directly in the sink buffer
+template<typename Sink>
+auto write_array(Sink& sink, const char* data, size_t count, size_t width, bool swap, priority<1>)
+        -> decltype(sink.prepare(size_t(0)), sink.commit(size_t(0)), void()) {
+    while (count > 0) {
+        span<char> dest = sink.prepare(width);
+        size_t num = dest.size() / width < count ? dest.size() / width : count;
+        std::memcpy(dest.data(), data, num * width);
+        if (swap) {
+            detail_byte_order::swap_array(dest.data(), num, width);
+        }
+        sink.commit(num * width);
+        data += num * width;
+        count -= num;
+    }
+}
+
+template<typename Sink>
+void write_array(Sink& sink, const char* data, size_t count, size_t width, bool swap, priority<0>) {
+    std::array<char, 4096> buf;
+    while (count > 0) {
+        size_t num = buf.size() / width < count ? buf.size() / width : count;
+        std::memcpy(buf.data(), data, num * width);
+        if (swap) {
+            detail_byte_order::swap_array(buf.data(), num, width);
+        }
+        write_all(sink, {buf.data(), num * width});
+        data += num * width;
+        count -= num;
+    }
+}
+
+} // namespace
+
+/**
+ * Reads a little-endian value of the specified arithmetic type,
+ * values are taken directly from the buffer of the lending sources
+ * (like "buffered_source" or "array_source")
+ * 
+ * @param src input source
+ * @return value read
+ * @throws io_exception if source has less bytes than value size
+ */
+template<typename T, typename Source>
+T read_le(Source& src) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    return detail_binary::read_value<T>(src, true, detail_dispatch::priority<1>());
+}
+
+/**
+ * Reads a big-endian value of the specified arithmetic type,
+ * values are taken directly from the buffer of the lending sources
+ * (like "buffered_source" or "array_source")
+ * 
+ * @param src input source
+ * @return value read
+ * @throws io_exception if source has less bytes than value size
+ */
+template<typename T, typename Source>
+T read_be(Source& src) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    return detail_binary::read_value<T>(src, false, detail_dispatch::priority<1>());
+}
+
+/**
+ * Writes a value of the specified arithmetic type in little-endian byte order
+ * 
+ * @param sink destination sink
+ * @param value value to write
+ */
+template<typename T, typename Sink>
+void write_le(Sink& sink, T value) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    detail_binary::write_value(sink, value, true);
+}
+
+/**
+ * Writes a value of the specified arithmetic type in big-endian byte order
+ * 
+ * @param sink destination sink
+ * @param value value to write
+ */
+template<typename T, typename Sink>
+void write_be(Sink& sink, T value) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    detail_binary::write_value(sink, value, false);
+}
+
+/**
+ * Reads an array of little-endian values, bytes are swapped in bulk
+ * (using SSE2 on x86_64) if host byte order is different
+ * 
+ * @param src input source
+ * @param dest destination array
+ * @throws io_exception if source has less bytes than array size
+ */
+template<typename T, typename Source>
+void read_le_array(Source& src, span<T> dest) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    detail_binary::read_array(src, dest, true);
+}
+
+/**
+ * Reads an array of big-endian values, bytes are swapped in bulk
+ * (using SSE2 on x86_64) if host byte order is different
+ * 
+ * @param src input source
+ * @param dest destination array
+ * @throws io_exception if source has less bytes than array size
+ */
+template<typename T, typename Source>
+void read_be_array(Source& src, span<T> dest) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    detail_binary::read_array(src, dest, false);
+}
+
+/**
+ * Writes an array of values in little-endian byte order, values
+ * are converted directly in the buffer of the sinks that implement "prepare"
+ * 
+ * @param sink destination sink
+ * @param values values to write
+ */
+template<typename T, typename Sink>
+void write_le_array(Sink& sink, span<const T> values) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    detail_binary::write_array(sink, reinterpret_cast<const char*>(values.data()), values.size(), sizeof(T),
+            !detail_byte_order::host_little_endian, detail_dispatch::priority<1>());
+}
+
+/**
+ * Writes an array of values in big-endian byte order, values
+ * are converted directly in the buffer of the sinks that implement "prepare"
+ * 
+ * @param sink destination sink
+ * @param values values to write
+ */
+template<typename T, typename Sink>
+void write_be_array(Sink& sink, span<const T> values) {
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+    detail_binary::write_array(sink, reinterpret_cast<const char*>(values.data()), values.size(), sizeof(T),
+            detail_byte_order::host_little_endian, detail_dispatch::priority<1>());
+}
+
+/**
+ * Reads unsigned LEB128 varint (as in protobuf)
+ * 
+ * @param src input source
+ * @return value read
+ * @throws io_exception on end of stream or if value exceeds 64 bits
+ */
+template<typename Source>
+uint64_t read_varint(Source& src) {
+    uint64_t res = 0;
+    for (size_t i = 0; i < detail_byte_order::max_varint_len; i++) {
+        uint8_t byte = detail_binary::read_value<uint8_t>(src, true, detail_dispatch::priority<1>());
+        if (detail_byte_order::max_varint_len - 1 == i && byte > 1) {
+            break;
+        }
+        res |= static_cast<uint64_t>(byte & 0x7f) << (i * 7);
+        if (0 == (byte & 0x80)) {
+            return res;
+        }
+    }
+    throw io_exception(TRACEMSG("Invalid varint, value exceeds 64 bits"));
+}
+
+/**
+ * Writes unsigned LEB128 varint (as in protobuf)
+ * 
+ * @param sink destination sink
+ * @param value value to write
+ */
+template<typename Sink>
+void write_varint(Sink& sink, uint64_t value) {
+    char buf[detail_byte_order::max_varint_len];
+    size_t len = detail_byte_order::encode_varint(value, buf);
+    write_all(sink, {buf, len});
+}
+
+/**
+ * ZigZag encoding of signed value, small negative values
+ * become small unsigned values, to be written as varint
+ * 
+ * @param value signed value
+ * @return encoded value
+ */
+inline uint64_t zigzag_encode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+/**
+ * ZigZag decoding of signed value
+ * 
+ * @param value encoded value
+ * @return signed value
+ */
+inline int64_t zigzag_decode(uint64_t value) {
+    return static_cast<int64_t>((value >> 1) ^ (0 - (value & 1)));
+}
+
 /**
  * Replaces "{{placeholders}}" with specified values in specified string
  * 
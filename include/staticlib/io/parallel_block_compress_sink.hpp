@@ -0,0 +1,511 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parallel_block_compress_sink.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 2:40 AM
+ */
+#ifndef STATICLIB_IO_PARALLEL_BLOCK_COMPRESS_SINK_HPP
+#define STATICLIB_IO_PARALLEL_BLOCK_COMPRESS_SINK_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/block_workers.hpp"
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/deflater.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Framing of the independently compressed blocks
+ */
+enum class parallel_block_format {
+    /**
+     * Each block is a separate GZIP member, concatenated members
+     * are decompressed as a single stream by gzip tools and "inflate_source"
+     */
+    gzip,
+    /**
+     * Blocked GZIP (BGZF, as used by SAMtools): GZIP members that store
+     * their compressed size in the header extra field, so blocks can be located
+     * without decompression, blocks are limited to 65280 bytes of input,
+     * stream ends with an empty EOF member
+     */
+    bgzf
+};
+
+/**
+ * Position of the compressed block in the output stream
+ */
+struct parallel_block_index_entry {
+    /**
+     * Offset of the block in compressed stream
+     */
+    uint64_t compressed_offset;
+    /**
+     * Offset of the block data in uncompressed stream
+     */
+    uint64_t uncompressed_offset;
+};
+
+/**
+ * Options of parallel block compression
+ */
+struct parallel_block_options {
+    /**
+     * Framing of the compressed blocks
+     */
+    parallel_block_format format = parallel_block_format::gzip;
+    /**
+     * Compression level from 0 (no compression) to 9 (best compression)
+     */
+    int level = 6;
+    /**
+     * Max uncompressed size of a block, bigger blocks give better compression
+     * ratio, blocks are capped at 65280 bytes for "bgzf" format
+     */
+    size_t block_size = 1 << 17;
+    /**
+     * Number of compressing threads, zero to use the number of hardware threads
+     */
+    size_t workers = 0;
+    /**
+     * Max number of blocks that are compressed or wait to be written out,
+     * bounds the memory used by the sink, zero to use twice the number of workers
+     */
+    size_t max_in_flight = 0;
+    /**
+     * Whether to collect positions of all the blocks written, see "get_index"
+     */
+    bool collect_index = false;
+};
+
+namespace detail_parallel_block {
+
+const size_t bgzf_max_input = 0xff00;
+const size_t bgzf_max_block = 1 << 16;
+const size_t gzip_header_len = 10;
+const size_t bgzf_header_len = 18;
+const size_t trailer_len = 8;
+
+inline void put_le(std::vector<char>& out, uint32_t val, size_t nbytes) {
+    for (size_t i = 0; i < nbytes; i++) {
+        out.push_back(static_cast<char>((val >> (i * 8)) & 0xff));
+    }
+}
+
+inline void write_header(std::vector<char>& out, parallel_block_format format, int level) {
+    static const unsigned char gzip_header[] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0};
+    out.insert(out.end(), gzip_header, gzip_header + sizeof(gzip_header));
+    if (parallel_block_format::bgzf == format) {
+        // FEXTRA flag
+        out[3] = 4;
+    }
+    out.push_back(static_cast<char>(9 == level ? 2 : 1 == level ? 4 : 0));
+    // unknown OS
+    out.push_back(static_cast<char>(0xff));
+    if (parallel_block_format::bgzf == format) {
+        // XLEN, "BC" subfield, BSIZE is set when the block is complete
+        static const unsigned char extra[] = {6, 0, 'B', 'C', 2, 0, 0, 0};
+        out.insert(out.end(), extra, extra + sizeof(extra));
+    }
+}
+
+/**
+ * Compressing context of a single worker thread,
+ * each block is compressed into a complete GZIP member
+ */
+class block_context {
+    parallel_block_format format;
+    int level;
+    detail_deflate::deflater deflater;
+
+public:
+    block_context(parallel_block_format format, int level) :
+    format(format),
+    level(level),
+    deflater(deflate_format::raw, level, 15) { }
+
+    void process(const std::vector<char>& input, bool, std::vector<char>& output) {
+        write_header(output, format, level);
+        size_t header_len = output.size();
+        deflater.reset();
+        deflater.compress(span<const char>(input.data(), input.size()));
+        deflater.finish();
+        span<const char> compressed = deflater.get_output();
+        if (parallel_block_format::bgzf == format &&
+                header_len + compressed.size() + trailer_len > bgzf_max_block) {
+            // single stored block always fits
+            output.push_back(1);
+            put_le(output, static_cast<uint32_t>(input.size()), 2);
+            put_le(output, static_cast<uint32_t>(~input.size()), 2);
+            output.insert(output.end(), input.begin(), input.end());
+        } else {
+            output.insert(output.end(), compressed.data(), compressed.data() + compressed.size());
+        }
+        const unsigned char* data = reinterpret_cast<const unsigned char*>(input.data());
+        put_le(output, detail_deflate::crc32_update(0, data, input.size()), 4);
+        put_le(output, static_cast<uint32_t>(input.size()), 4);
+        if (parallel_block_format::bgzf == format) {
+            uint32_t bsize = static_cast<uint32_t>(output.size() - 1);
+            output[16] = static_cast<char>(bsize & 0xff);
+            output[17] = static_cast<char>(bsize >> 8);
+        }
+    }
+};
+
+} // namespace
+
+/**
+ * Sink wrapper that cuts the data into blocks of fixed size and compresses
+ * them independently using DEFLATE on a pool of worker threads, compressed
+ * blocks are written to the destination sink in order as GZIP members.
+ * Number of blocks in flight is bounded, block buffers are reused.
+ * Output is a valid GZIP stream, it is a bit bigger than the one produced
+ * by "deflate_sink" as matches do not cross block boundaries.
+ * Compressed stream is completed on "finish" call or on destruction.
+ */
+template<typename Sink>
+class parallel_block_compress_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Compression options
+     */
+    parallel_block_options options;
+    /**
+     * Worker threads
+     */
+    std::unique_ptr<detail_block_workers::ordered_workers<detail_parallel_block::block_context>> workers;
+    /**
+     * Positions of the blocks written
+     */
+    std::vector<parallel_block_index_entry> index;
+    /**
+     * Number of bytes written to destination sink
+     */
+    uint64_t compressed_count = 0;
+    /**
+     * Number of uncompressed bytes in the blocks written
+     */
+    uint64_t uncompressed_count = 0;
+    /**
+     * Number of blocks submitted
+     */
+    uint64_t blocks_count = 0;
+    /**
+     * Whether compressed stream is completed
+     */
+    bool finished = false;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param options compression options
+     * @throws io_exception on invalid options
+     */
+    explicit parallel_block_compress_sink(Sink&& sink, parallel_block_options options = parallel_block_options()) :
+    sink(std::move(sink)),
+    options(check_options(std::move(options))) {
+        std::vector<detail_parallel_block::block_context> contexts;
+        for (size_t i = 0; i < this->options.workers; i++) {
+            contexts.emplace_back(this->options.format, this->options.level);
+        }
+        workers.reset(new detail_block_workers::ordered_workers<detail_parallel_block::block_context>(
+                std::move(contexts), this->options.max_in_flight));
+        workers->next_input().clear();
+    }
+
+    /**
+     * Destructor, completes compressed stream
+     */
+    ~parallel_block_compress_sink() STATICLIB_NOEXCEPT {
+        try {
+            finish();
+        } catch(...) {
+            // ignore
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    parallel_block_compress_sink(const parallel_block_compress_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    parallel_block_compress_sink& operator=(const parallel_block_compress_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    parallel_block_compress_sink(parallel_block_compress_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    options(std::move(other.options)),
+    workers(std::move(other.workers)),
+    index(std::move(other.index)),
+    compressed_count(other.compressed_count),
+    uncompressed_count(other.uncompressed_count),
+    blocks_count(other.blocks_count),
+    finished(other.finished) {
+        other.finished = true;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    parallel_block_compress_sink& operator=(parallel_block_compress_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        options = std::move(other.options);
+        workers = std::move(other.workers);
+        index = std::move(other.index);
+        compressed_count = other.compressed_count;
+        uncompressed_count = other.uncompressed_count;
+        blocks_count = other.blocks_count;
+        finished = other.finished;
+        other.finished = true;
+        return *this;
+    }
+
+    /**
+     * Compressing write implementation, full blocks are submitted
+     * for compression, compressed blocks are written to the destination sink
+     * when they are ready, waits for the oldest block if the number
+     * of blocks in flight reaches the limit
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     * @throws io_exception on write after the end of compressed stream
+     */
+    std::streamsize write(span<const char> span) {
+        if (finished) throw io_exception(TRACEMSG("Invalid write after the end of compressed stream"));
+        size_t idx = 0;
+        while (idx < span.size()) {
+            std::vector<char>& block = workers->next_input();
+            size_t avail = options.block_size - block.size();
+            size_t len = span.size() - idx < avail ? span.size() - idx : avail;
+            block.insert(block.end(), span.data() + idx, span.data() + idx + len);
+            idx += len;
+            if (block.size() == options.block_size) {
+                submit();
+            }
+        }
+        return span.size_signed();
+    }
+
+    /**
+     * Compresses pending data into a (possibly short) block, waits
+     * for all the blocks in flight, writes them and flushes destination sink
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        if (!finished) {
+            if (!workers->next_input().empty()) {
+                submit();
+            }
+            drain();
+        }
+        return sink.flush();
+    }
+
+    /**
+     * Completes compressed stream and flushes destination sink,
+     * no-op if stream is already completed
+     */
+    void finish() {
+        if (finished) {
+            return;
+        }
+        finished = true;
+        // empty input still produces a valid GZIP stream
+        if (!workers->next_input().empty() || (0 == blocks_count &&
+                parallel_block_format::gzip == options.format)) {
+            submit();
+        }
+        drain();
+        if (parallel_block_format::bgzf == options.format) {
+            write_eof_block();
+        }
+        sink.flush();
+    }
+
+    /**
+     * Resets this sink to start the next compressed stream
+     * into the same destination sink, allocated buffers are reused
+     */
+    void reset() {
+        if (!finished) {
+            workers->drain([](span<const char>) {});
+        }
+        workers->next_input().clear();
+        index.clear();
+        compressed_count = 0;
+        uncompressed_count = 0;
+        blocks_count = 0;
+        finished = false;
+    }
+
+    /**
+     * Resets this sink to start the compressed stream
+     * into the specified destination sink, allocated buffers are reused
+     * 
+     * @param dest new destination sink
+     */
+    void reset(Sink&& dest) {
+        sink = std::move(dest);
+        reset();
+    }
+
+    /**
+     * Returns positions of all the blocks written since creation or last reset,
+     * available only if "collect_index" option is enabled
+     * 
+     * @return blocks positions
+     */
+    const std::vector<parallel_block_index_entry>& get_index() const {
+        return index;
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+private:
+    static parallel_block_options check_options(parallel_block_options options) {
+        if (options.level < 0 || options.level > 9) throw io_exception(TRACEMSG(
+                "Invalid compression level specified, level: [" + sl::support::to_string(options.level) + "]"));
+        if (0 == options.block_size) throw io_exception(TRACEMSG("Invalid zero block size specified"));
+        if (parallel_block_format::bgzf == options.format &&
+                options.block_size > detail_parallel_block::bgzf_max_input) {
+            options.block_size = detail_parallel_block::bgzf_max_input;
+        }
+        if (0 == options.workers) {
+            unsigned hc = std::thread::hardware_concurrency();
+            options.workers = hc > 0 ? hc : 1;
+        }
+        if (0 == options.max_in_flight) {
+            options.max_in_flight = options.workers * 2;
+        }
+        return options;
+    }
+
+    void submit() {
+        blocks_count += 1;
+        workers->submit(false, [this](span<const char> block) {
+            this->write_block(block);
+        });
+        workers->next_input().clear();
+    }
+
+    void drain() {
+        workers->drain([this](span<const char> block) {
+            this->write_block(block);
+        });
+    }
+
+    void write_block(span<const char> block) {
+        if (options.collect_index) {
+            index.push_back(parallel_block_index_entry{compressed_count, uncompressed_count});
+        }
+        write_all(sink, block);
+        compressed_count += block.size();
+        // ISIZE field of the member trailer
+        const unsigned char* isize = reinterpret_cast<const unsigned char*>(block.data() + block.size() - 4);
+        uncompressed_count += static_cast<uint32_t>(isize[0]) | (static_cast<uint32_t>(isize[1]) << 8) |
+                (static_cast<uint32_t>(isize[2]) << 16) | (static_cast<uint32_t>(isize[3]) << 24);
+    }
+
+    void write_eof_block() {
+        static const unsigned char eof[] = {
+            0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 6, 0, 'B', 'C', 2, 0, 0x1b, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        };
+        write_all(sink, span<const char>(reinterpret_cast<const char*>(eof), sizeof(eof)));
+        compressed_count += sizeof(eof);
+    }
+};
+
+/**
+ * Factory function for creating parallel block compress sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param options compression options
+ * @return parallel block compress sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+parallel_block_compress_sink<Sink> make_parallel_block_compress_sink(Sink&& sink,
+        parallel_block_options options = parallel_block_options()) {
+    return parallel_block_compress_sink<Sink>(std::move(sink), std::move(options));
+}
+
+/**
+ * Factory function for creating parallel block compress sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param options compression options
+ * @return parallel block compress sink
+ */
+template <typename Sink>
+parallel_block_compress_sink<reference_sink<Sink>> make_parallel_block_compress_sink(Sink& sink,
+        parallel_block_options options = parallel_block_options()) {
+    return parallel_block_compress_sink<reference_sink<Sink>>(make_reference_sink(sink), std::move(options));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PARALLEL_BLOCK_COMPRESS_SINK_HPP */
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   parallel_copy.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 6:10 PM
+ */
+
+#ifndef STATICLIB_IO_PARALLEL_COPY_HPP
+#define STATICLIB_IO_PARALLEL_COPY_HPP
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_parallel_copy {
+
+template<typename Source, typename Sink>
+size_t copy_range(Source& src, Sink& sink, size_t from, size_t to, bool last, span<char> buf) {
+    size_t copied = 0;
+    size_t offset = from;
+    while (offset < to) {
+        size_t len = to - offset <= buf.size() ? to - offset : buf.size();
+        std::streamsize amt = src.read_at(offset, {buf.data(), len});
+        // zero result is treated as EOF, otherwise range would never advance
+        if (std::char_traits<char>::eof() == amt || 0 == amt) {
+            // only the last range may end early, otherwise sink would have a hole
+            if (!last) throw io_exception(TRACEMSG(
+                    "Unexpected end of source data in range," +
+                    " from: [" + sl::support::to_string(from) + "]," +
+                    " to: [" + sl::support::to_string(to) + "]," +
+                    " read: [" + sl::support::to_string(offset) + "]"));
+            break;
+        }
+        if (!sl::support::is_sizet(amt)) throw io_exception(TRACEMSG(
+                "Invalid result returned by underlying 'read_at' operation: [" + sl::support::to_string(amt) + "]"));
+        size_t uamt = static_cast<size_t>(amt);
+        size_t written = 0;
+        while (written < uamt) {
+            std::streamsize wamt = sink.write_at(offset + written, {buf.data() + written, uamt - written});
+            if (!sl::support::is_sizet(wamt) || 0 == wamt) throw io_exception(TRACEMSG(
+                    "Invalid result returned by underlying 'write_at' operation: [" + sl::support::to_string(wamt) + "]"));
+            written += static_cast<size_t>(wamt);
+        }
+        offset += uamt;
+        copied += uamt;
+    }
+    return copied;
+}
+
+} // namespace
+
+/**
+ * Copies data from the positional Source to the positional Sink
+ * splitting the source into ranges and copying them concurrently using
+ * the specified number of threads (including the calling thread).
+ * Source must implement thread-safe "read_at(offset, span)" and "size()"
+ * methods, Sink must implement "write_at(offset, span)" method that is
+ * thread-safe for non-overlapping regions. Data is written to the same
+ * offsets in the sink, as it is read from the source.
+ * If any of the ranges fails, remaining ranges are skipped and the
+ * first error is rethrown after all threads are finished. Source
+ * data that ends before its reported size is treated as an error,
+ * unless it ends inside the last range.
+ * 
+ * @param src positional source
+ * @param sink positional sink
+ * @param threads_count number of threads to use, zero to use
+ *        the number of hardware threads
+ * @param range_size size of the range copied by single thread at once
+ * @param buffer_size size of the buffer used by every thread
+ * @return number of bytes copied
+ */
+template<typename Source, typename Sink>
+size_t parallel_copy(Source& src, Sink& sink, size_t threads_count = 0,
+        size_t range_size = (1 << 22), size_t buffer_size = (1 << 16)) {
+    if (0 == range_size || 0 == buffer_size) throw io_exception(TRACEMSG(
+            "Invalid zero range or buffer size specified," +
+            " range_size: [" + sl::support::to_string(range_size) + "]," +
+            " buffer_size: [" + sl::support::to_string(buffer_size) + "]"));
+    size_t total = src.size();
+    size_t ranges_count = total / range_size + (0 != total % range_size ? 1 : 0);
+    if (0 == threads_count) {
+        threads_count = std::thread::hardware_concurrency();
+    }
+    if (threads_count > ranges_count) {
+        threads_count = ranges_count;
+    }
+    if (0 == threads_count) {
+        return 0;
+    }
+    std::atomic<size_t> next_range(0);
+    std::atomic<size_t> copied(0);
+    std::atomic<bool> failed(false);
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    auto worker = [&] {
+        try {
+            auto buf = std::vector<char>(buffer_size <= range_size ? buffer_size : range_size);
+            auto buf_span = span<char>(buf);
+            for (;;) {
+                size_t idx = next_range.fetch_add(1);
+                if (idx >= ranges_count || failed.load()) {
+                    break;
+                }
+                size_t from = idx * range_size;
+                size_t to = total - from > range_size ? from + range_size : total;
+                copied.fetch_add(detail_parallel_copy::copy_range(src, sink, from, to, total == to, buf_span));
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> guard{error_mutex};
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed.store(true);
+        }
+    };
+    auto threads = std::vector<std::thread>();
+    try {
+        for (size_t i = 1; i < threads_count; i++) {
+            threads.emplace_back(worker);
+        }
+    } catch (...) {
+        failed.store(true);
+        for (auto& th : threads) {
+            th.join();
+        }
+        throw;
+    }
+    worker();
+    for (auto& th : threads) {
+        th.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return copied.load();
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PARALLEL_COPY_HPP */
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipe.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 12:10 PM
+ */
+
+#ifndef STATICLIB_IO_PIPE_HPP
+#define STATICLIB_IO_PIPE_HPP
+
+#include <memory>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/pipe_sink.hpp"
+#include "staticlib/io/pipe_source.hpp"
+#include "staticlib/io/pipe_state.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Factory function for creating pipes, that connect a Sink
+ * used in one thread with a Source used in another thread.
+ * Data is passed through the lock-free single-producer/single-consumer
+ * ring buffer of the specified capacity.
+ * 
+ * @param capacity pipe buffer capacity in bytes
+ * @return pair of the sink and the source of the pipe
+ */
+inline std::pair<pipe_sink, pipe_source> make_pipe(size_t capacity = 65536) {
+    auto state = std::make_shared<detail_pipe::pipe_state>(capacity);
+    auto sink = pipe_sink(state);
+    auto src = pipe_source(std::move(state));
+    return std::make_pair(std::move(sink), std::move(src));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PIPE_HPP */
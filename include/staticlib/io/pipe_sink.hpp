@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipe_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 11:40 AM
+ */
+
+#ifndef STATICLIB_IO_PIPE_SINK_HPP
+#define STATICLIB_IO_PIPE_SINK_HPP
+
+#include <exception>
+#include <ios>
+#include <memory>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/pipe_state.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink implementation that writes into the pipe, data
+ * written can be read from the paired "pipe_source" in another thread.
+ * Write blocks while the pipe is full. Pipe is closed on destruction.
+ * Must be used only from a single writer thread.
+ */
+class pipe_sink {
+    /**
+     * Shared pipe state
+     */
+    std::shared_ptr<detail_pipe::pipe_state> state;
+
+public:
+    /**
+     * Constructor, normally "make_pipe" should be used instead
+     * 
+     * @param state shared pipe state
+     */
+    explicit pipe_sink(std::shared_ptr<detail_pipe::pipe_state> state) :
+    state(std::move(state)) { }
+
+    /**
+     * Destructor, closes the pipe
+     */
+    ~pipe_sink() STATICLIB_NOEXCEPT {
+        close();
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    pipe_sink(const pipe_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    pipe_sink& operator=(const pipe_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    pipe_sink(pipe_sink&& other) STATICLIB_NOEXCEPT :
+    state(std::move(other.state)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    pipe_sink& operator=(pipe_sink&& other) STATICLIB_NOEXCEPT {
+        close();
+        state = std::move(other.state);
+        return *this;
+    }
+
+    /**
+     * Blocking write implementation, waits until at least
+     * one byte can be written
+     * 
+     * @param span buffer span
+     * @return number of bytes written
+     * @throws io_exception if pipe was closed by reader
+     */
+    std::streamsize write(span<const char> span) {
+        check_state();
+        return static_cast<std::streamsize>(state->write(span));
+    }
+
+    /**
+     * No-op flush implementation, written data
+     * is available to reader immediately
+     * 
+     * @return 0
+     */
+    std::streamsize flush() {
+        // no-op
+        return 0;
+    }
+
+    /**
+     * Closes the pipe, reader will get EOF after
+     * consuming all written data
+     */
+    void close() STATICLIB_NOEXCEPT {
+        if (nullptr != state.get()) {
+            state->close_writer();
+            state.reset();
+        }
+    }
+
+    /**
+     * Closes the pipe with error, reader will get the specified
+     * exception rethrown after consuming all written data
+     * 
+     * @param err error to pass to reader
+     */
+    void close_with_error(std::exception_ptr err) {
+        if (nullptr != state.get()) {
+            state->close_writer(std::move(err));
+            state.reset();
+        }
+    }
+
+private:
+    void check_state() {
+        if (nullptr == state.get()) throw io_exception(TRACEMSG("Write into closed pipe"));
+    }
+
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PIPE_SINK_HPP */
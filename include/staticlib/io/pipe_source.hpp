@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipe_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 11:58 AM
+ */
+
+#ifndef STATICLIB_IO_PIPE_SOURCE_HPP
+#define STATICLIB_IO_PIPE_SOURCE_HPP
+
+#include <ios>
+#include <memory>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/pipe_state.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source implementation that reads from the pipe, data
+ * is written into the paired "pipe_sink" in another thread.
+ * Read blocks while the pipe is empty, EOF is returned after the
+ * pipe was closed by writer, error passed by writer is rethrown.
+ * Pipe is closed for writer on destruction.
+ * Must be used only from a single reader thread.
+ */
+class pipe_source {
+    /**
+     * Shared pipe state
+     */
+    std::shared_ptr<detail_pipe::pipe_state> state;
+
+public:
+    /**
+     * Constructor, normally "make_pipe" should be used instead
+     * 
+     * @param state shared pipe state
+     */
+    explicit pipe_source(std::shared_ptr<detail_pipe::pipe_state> state) :
+    state(std::move(state)) { }
+
+    /**
+     * Destructor, closes the pipe
+     */
+    ~pipe_source() STATICLIB_NOEXCEPT {
+        close();
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    pipe_source(const pipe_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    pipe_source& operator=(const pipe_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    pipe_source(pipe_source&& other) STATICLIB_NOEXCEPT :
+    state(std::move(other.state)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    pipe_source& operator=(pipe_source&& other) STATICLIB_NOEXCEPT {
+        close();
+        state = std::move(other.state);
+        return *this;
+    }
+
+    /**
+     * Blocking read implementation, waits until at least
+     * one byte is available or the pipe is closed
+     * 
+     * @param span buffer span
+     * @return number of bytes read
+     */
+    std::streamsize read(span<char> span) {
+        if (nullptr == state.get()) {
+            return std::char_traits<char>::eof();
+        }
+        return state->read(span);
+    }
+
+    /**
+     * Closes the pipe, subsequent writes into it will throw
+     */
+    void close() STATICLIB_NOEXCEPT {
+        if (nullptr != state.get()) {
+            state->close_reader();
+            state.reset();
+        }
+    }
+
+    /**
+     * Returns number of bytes that can be read without blocking
+     * 
+     * @return number of bytes available
+     */
+    size_t get_available() const {
+        return nullptr != state.get() ? state->get_available() : 0;
+    }
+
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PIPE_SOURCE_HPP */
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipe_state.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 11:02 AM
+ */
+
+#ifndef STATICLIB_IO_PIPE_STATE_HPP
+#define STATICLIB_IO_PIPE_STATE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/memory_ring.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_pipe {
+
+/**
+ * State shared between "pipe_sink" and "pipe_source".
+ * Data is passed through the lock-free "memory_ring", mutex
+ * is only taken when one of the sides needs to wait or to wake up
+ * the other side.
+ */
+class pipe_state {
+    /**
+     * Ring storage
+     */
+    std::vector<char> storage;
+    /**
+     * Ring over the storage
+     */
+    memory_ring ring;
+
+    /**
+     * Mutex used for waiting only
+     */
+    std::mutex mutex;
+    /**
+     * Writer waits on it when ring is full
+     */
+    std::condition_variable not_full;
+    /**
+     * Reader waits on it when ring is empty
+     */
+    std::condition_variable not_empty;
+    /**
+     * Whether writer is waiting for free space
+     */
+    std::atomic<bool> writer_waiting;
+    /**
+     * Whether reader is waiting for data
+     */
+    std::atomic<bool> reader_waiting;
+    /**
+     * Whether reader closed the pipe
+     */
+    std::atomic<bool> reader_closed;
+    /**
+     * Error reported by writer, guarded by mutex
+     */
+    std::exception_ptr error;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param capacity ring capacity in bytes
+     */
+    explicit pipe_state(size_t capacity) :
+    storage(capacity),
+    ring(span<char>(capacity > 0 ? storage.data() : nullptr, capacity)),
+    writer_waiting(false),
+    reader_waiting(false),
+    reader_closed(false) {
+        if (0 == capacity) throw io_exception(TRACEMSG("Invalid zero pipe capacity specified"));
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    pipe_state(const pipe_state&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    pipe_state& operator=(const pipe_state&) = delete;
+
+    /**
+     * Writes at least one byte, blocks while the ring is full
+     * 
+     * @param span buffer span
+     * @return number of bytes written
+     */
+    size_t write(span<const char> span) {
+        if (0 == span.size()) {
+            return 0;
+        }
+        for (;;) {
+            if (reader_closed.load(std::memory_order_acquire)) throw io_exception(TRACEMSG(
+                    "Pipe was closed by reader"));
+            if (ring.is_closed()) throw io_exception(TRACEMSG(
+                    "Write into closed pipe"));
+            size_t res = ring.write(span);
+            if (res > 0) {
+                wake_up(reader_waiting, not_empty);
+                return res;
+            }
+            std::unique_lock<std::mutex> guard{mutex};
+            writer_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while (ring.get_available() == ring.get_capacity() &&
+                    !reader_closed.load(std::memory_order_acquire)) {
+                not_full.wait(guard);
+            }
+            writer_waiting.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Reads at least one byte, blocks while the ring is empty
+     * 
+     * @param span buffer span
+     * @return number of bytes read, EOF if pipe was closed
+     *         and all data is consumed
+     */
+    std::streamsize read(span<char> span) {
+        if (0 == span.size()) {
+            return 0;
+        }
+        for (;;) {
+            bool closed = ring.is_closed();
+            size_t res = ring.read(span);
+            if (res > 0) {
+                wake_up(writer_waiting, not_full);
+                return static_cast<std::streamsize>(res);
+            }
+            if (closed) {
+                std::lock_guard<std::mutex> guard{mutex};
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return std::char_traits<char>::eof();
+            }
+            std::unique_lock<std::mutex> guard{mutex};
+            reader_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while (0 == ring.get_available() && !ring.is_closed()) {
+                not_empty.wait(guard);
+            }
+            reader_waiting.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Closes the pipe from the writer side, optionally
+     * with the error that will be rethrown to the reader
+     * after all written data is consumed
+     * 
+     * @param err error to pass to reader, may be empty
+     */
+    void close_writer(std::exception_ptr err = std::exception_ptr()) {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (!ring.is_closed()) {
+            error = err;
+            ring.close();
+        }
+        not_empty.notify_all();
+    }
+
+    /**
+     * Closes the pipe from the reader side, subsequent
+     * writes will throw
+     */
+    void close_reader() {
+        std::lock_guard<std::mutex> guard{mutex};
+        reader_closed.store(true, std::memory_order_release);
+        not_full.notify_all();
+    }
+
+    /**
+     * Returns number of bytes available for reading
+     * 
+     * @return number of bytes available for reading
+     */
+    size_t get_available() const {
+        return ring.get_available();
+    }
+
+    /**
+     * Returns capacity of the pipe
+     * 
+     * @return pipe capacity in bytes
+     */
+    size_t get_capacity() const {
+        return ring.get_capacity();
+    }
+
+private:
+    void wake_up(std::atomic<bool>& waiting, std::condition_variable& cv) {
+        // pairs with the fence in waiting thread, one of the sides
+        // is guaranteed to see the other's update
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> guard{mutex};
+            cv.notify_one();
+        }
+    }
+
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PIPE_STATE_HPP */
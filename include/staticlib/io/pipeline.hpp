@@ -0,0 +1,599 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipeline.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:40 PM
+ */
+
+#ifndef STATICLIB_IO_PIPELINE_HPP
+#define STATICLIB_IO_PIPELINE_HPP
+
+#include <ios>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/buffered_sink.hpp"
+#include "staticlib/io/buffered_source.hpp"
+#include "staticlib/io/counting_sink.hpp"
+#include "staticlib/io/counting_source.hpp"
+#include "staticlib/io/deflate_format.hpp"
+#include "staticlib/io/deflate_sink.hpp"
+#include "staticlib/io/hex_sink.hpp"
+#include "staticlib/io/hex_source.hpp"
+#include "staticlib/io/inflate_source.hpp"
+#include "staticlib/io/limited_source.hpp"
+#include "staticlib/io/lz4_sink.hpp"
+#include "staticlib/io/lz4_source.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/reference_source.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/traits.hpp"
+#include "staticlib/io/zstd_sink.hpp"
+#include "staticlib/io/zstd_source.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_pipeline {
+
+// base class for all stages, used to enable pipe operator
+struct stage { };
+
+template<typename T>
+class is_source {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().read(std::declval<span<char>>()), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+// sources returned from "limit" stage already count the bytes read
+template<typename T>
+struct is_limited_source : std::false_type { };
+
+template<typename Source>
+struct is_limited_source<limited_source<Source>> : std::true_type { };
+
+// non-owning wrapper for lvalue sources and sinks
+template<typename T, bool source = is_source<T>::value>
+struct reference {
+    typedef reference_source<T> type;
+
+    static type make(T& src) {
+        return make_reference_source(src);
+    }
+};
+
+template<typename T>
+struct reference<T, false> {
+    typedef reference_sink<T> type;
+
+    static type make(T& sink) {
+        return make_reference_sink(sink);
+    }
+};
+
+} // namespace
+
+/**
+ * Pipeline stage that limits the number of bytes read from the source
+ */
+class limit_stage : public detail_pipeline::stage {
+    /**
+     * Limit in bytes
+     */
+    size_t limit_bytes;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param limit_bytes max number of bytes allowed to be read
+     */
+    explicit limit_stage(size_t limit_bytes) :
+    limit_bytes(limit_bytes) { }
+
+    /**
+     * Wraps specified source
+     * 
+     * @param src input source
+     * @return limited source
+     */
+    template<typename Source>
+    limited_source<Source> apply(Source&& src) const {
+        return limited_source<Source>(std::move(src), limit_bytes);
+    }
+};
+
+/**
+ * Pipeline stage that decodes Hexadecimal data read from the source,
+ * data lent by the source (or by a preceding "buffer" stage)
+ * is decoded without an additional buffer
+ */
+class hex_decode_stage : public detail_pipeline::stage {
+public:
+    /**
+     * Wraps specified source
+     * 
+     * @param src input source
+     * @return hex source
+     */
+    template<typename Source>
+    hex_source<Source> apply(Source&& src) const {
+        return hex_source<Source>(std::move(src));
+    }
+};
+
+/**
+ * Pipeline stage that encodes data written to the sink into Hexadecimal,
+ * data is encoded directly into the buffer lent by the sink
+ * (or by a following "buffer" stage)
+ */
+class hex_encode_stage : public detail_pipeline::stage {
+public:
+    /**
+     * Wraps specified sink
+     * 
+     * @param sink destination sink
+     * @return hex sink
+     */
+    template<typename Sink>
+    hex_sink<Sink> apply(Sink&& sink) const {
+        return hex_sink<Sink>(std::move(sink));
+    }
+};
+
+/**
+ * Pipeline stage that decompresses DEFLATE data read from the source
+ */
+class inflate_stage : public detail_pipeline::stage {
+    /**
+     * Compressed data framing
+     */
+    deflate_format format;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param format compressed data framing
+     */
+    explicit inflate_stage(deflate_format format) :
+    format(format) { }
+
+    /**
+     * Wraps specified source
+     * 
+     * @param src input source
+     * @return inflate source
+     */
+    template<typename Source>
+    inflate_source<Source> apply(Source&& src) const {
+        return inflate_source<Source>(std::move(src), format);
+    }
+};
+
+/**
+ * Pipeline stage that compresses data written to the sink using DEFLATE
+ */
+class deflate_stage : public detail_pipeline::stage {
+    /**
+     * Compressed data framing
+     */
+    deflate_format format;
+    /**
+     * Compression level
+     */
+    int level;
+    /**
+     * Base two logarithm of the window size
+     */
+    int window_bits;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param format compressed data framing
+     * @param level compression level from 0 (no compression) to 9 (best compression)
+     * @param window_bits base two logarithm of the window size, from 9 to 15
+     */
+    deflate_stage(deflate_format format, int level, int window_bits) :
+    format(format),
+    level(level),
+    window_bits(window_bits) { }
+
+    /**
+     * Wraps specified sink
+     * 
+     * @param sink destination sink
+     * @return deflate sink
+     */
+    template<typename Sink>
+    deflate_sink<Sink> apply(Sink&& sink) const {
+        return deflate_sink<Sink>(std::move(sink), format, level, window_bits);
+    }
+};
+
+/**
+ * Pipeline stage that decompresses LZ4 frames read from the source
+ */
+class lz4_decompress_stage : public detail_pipeline::stage {
+    /**
+     * Dictionary that was used for compression
+     */
+    std::string dictionary;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param dictionary dictionary that was used for compression
+     */
+    explicit lz4_decompress_stage(std::string dictionary) :
+    dictionary(std::move(dictionary)) { }
+
+    /**
+     * Wraps specified source
+     * 
+     * @param src input source
+     * @return LZ4 source
+     */
+    template<typename Source>
+    lz4_source<Source> apply(Source&& src) const {
+        return lz4_source<Source>(std::move(src), dictionary);
+    }
+};
+
+/**
+ * Pipeline stage that compresses data written to the sink into LZ4 frame
+ */
+class lz4_compress_stage : public detail_pipeline::stage {
+    /**
+     * Compression options
+     */
+    lz4_options options;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param options compression options
+     */
+    explicit lz4_compress_stage(lz4_options options) :
+    options(std::move(options)) { }
+
+    /**
+     * Wraps specified sink
+     * 
+     * @param sink destination sink
+     * @return LZ4 sink
+     */
+    template<typename Sink>
+    lz4_sink<Sink> apply(Sink&& sink) const {
+        return lz4_sink<Sink>(std::move(sink), options);
+    }
+};
+
+/**
+ * Pipeline stage that decompresses Zstandard frames read from the source
+ */
+class zstd_decompress_stage : public detail_pipeline::stage {
+    /**
+     * Dictionary that was used for compression
+     */
+    std::string dictionary;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param dictionary dictionary that was used for compression
+     */
+    explicit zstd_decompress_stage(std::string dictionary) :
+    dictionary(std::move(dictionary)) { }
+
+    /**
+     * Wraps specified source
+     * 
+     * @param src input source
+     * @return Zstandard source
+     */
+    template<typename Source>
+    zstd_source<Source> apply(Source&& src) const {
+        return zstd_source<Source>(std::move(src), dictionary);
+    }
+};
+
+/**
+ * Pipeline stage that compresses data written to the sink into Zstandard frame
+ */
+class zstd_compress_stage : public detail_pipeline::stage {
+    /**
+     * Compression options
+     */
+    zstd_options options;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param options compression options
+     */
+    explicit zstd_compress_stage(zstd_options options) :
+    options(std::move(options)) { }
+
+    /**
+     * Wraps specified sink
+     * 
+     * @param sink destination sink
+     * @return Zstandard sink
+     */
+    template<typename Sink>
+    zstd_sink<Sink> apply(Sink&& sink) const {
+        return zstd_sink<Sink>(std::move(sink), options);
+    }
+};
+
+/**
+ * Pipeline stage that counts the number of bytes passed through the
+ * source or sink, sources returned from "limit" stage already count
+ * the bytes and are left as is
+ */
+class count_stage : public detail_pipeline::stage {
+    template<typename T>
+    struct result {
+        typedef typename std::conditional<detail_pipeline::is_limited_source<T>::value, T,
+                typename std::conditional<detail_pipeline::is_source<T>::value,
+                        counting_source<T>, counting_sink<T>>::type>::type type;
+    };
+
+public:
+    /**
+     * Wraps specified source or sink
+     * 
+     * @param obj input source or destination sink
+     * @return counting source or sink
+     */
+    template<typename T>
+    typename result<T>::type apply(T&& obj) const {
+        return apply_impl(std::move(obj), std::integral_constant<int,
+                detail_pipeline::is_limited_source<T>::value ? 0 : detail_pipeline::is_source<T>::value ? 1 : 2>());
+    }
+
+private:
+    template<typename T>
+    T apply_impl(T&& obj, std::integral_constant<int, 0>) const {
+        return std::move(obj);
+    }
+
+    template<typename Source>
+    counting_source<Source> apply_impl(Source&& src, std::integral_constant<int, 1>) const {
+        return counting_source<Source>(std::move(src));
+    }
+
+    template<typename Sink>
+    counting_sink<Sink> apply_impl(Sink&& sink, std::integral_constant<int, 2>) const {
+        return counting_sink<Sink>(std::move(sink));
+    }
+};
+
+/**
+ * Pipeline stage that buffers the source or sink, sources that lend
+ * their data and sinks that lend their buffers are left as is
+ */
+class buffer_stage : public detail_pipeline::stage {
+    template<typename T>
+    struct result {
+        typedef typename std::conditional<detail_pipeline::is_source<T>::value,
+                typename std::conditional<has_borrow_read<T>::value, T, buffered_source<T>>::type,
+                typename std::conditional<has_prepare<T>::value, T, buffered_sink<T>>::type>::type type;
+    };
+
+public:
+    /**
+     * Wraps specified source or sink
+     * 
+     * @param obj input source or destination sink
+     * @return buffered source or sink
+     */
+    template<typename T>
+    typename result<T>::type apply(T&& obj) const {
+        return apply_impl(std::move(obj), std::integral_constant<int,
+                detail_pipeline::is_source<T>::value ?
+                        (has_borrow_read<T>::value ? 0 : 1) :
+                        (has_prepare<T>::value ? 0 : 2)>());
+    }
+
+private:
+    template<typename T>
+    T apply_impl(T&& obj, std::integral_constant<int, 0>) const {
+        return std::move(obj);
+    }
+
+    template<typename Source>
+    buffered_source<Source> apply_impl(Source&& src, std::integral_constant<int, 1>) const {
+        return buffered_source<Source>(std::move(src));
+    }
+
+    template<typename Sink>
+    buffered_sink<Sink> apply_impl(Sink&& sink, std::integral_constant<int, 2>) const {
+        return buffered_sink<Sink>(std::move(sink));
+    }
+};
+
+/**
+ * Creates pipeline stage that limits the number of bytes read from the source
+ * 
+ * @param limit_bytes max number of bytes allowed to be read
+ * @return pipeline stage
+ */
+inline limit_stage limit(size_t limit_bytes) {
+    return limit_stage(limit_bytes);
+}
+
+/**
+ * Creates pipeline stage that decodes Hexadecimal data read from the source
+ * 
+ * @return pipeline stage
+ */
+inline hex_decode_stage hex_decode() {
+    return hex_decode_stage();
+}
+
+/**
+ * Creates pipeline stage that encodes data written to the sink into Hexadecimal
+ * 
+ * @return pipeline stage
+ */
+inline hex_encode_stage hex_encode() {
+    return hex_encode_stage();
+}
+
+/**
+ * Creates pipeline stage that decompresses DEFLATE data read from the source
+ * 
+ * @param format compressed data framing
+ * @return pipeline stage
+ */
+inline inflate_stage inflate(deflate_format format = deflate_format::zlib) {
+    return inflate_stage(format);
+}
+
+/**
+ * Creates pipeline stage that compresses data written to the sink using DEFLATE,
+ * compressed stream is completed when the resulting sink is destroyed
+ * or its "finish" method is called
+ * 
+ * @param format compressed data framing
+ * @param level compression level from 0 (no compression) to 9 (best compression)
+ * @param window_bits base two logarithm of the window size, from 9 to 15
+ * @return pipeline stage
+ */
+inline deflate_stage deflate(deflate_format format = deflate_format::zlib, int level = 6, int window_bits = 15) {
+    return deflate_stage(format, level, window_bits);
+}
+
+/**
+ * Creates pipeline stage that decompresses LZ4 frames read from the source
+ * 
+ * @param dictionary dictionary that was used for compression
+ * @return pipeline stage
+ */
+inline lz4_decompress_stage lz4_decompress(std::string dictionary = "") {
+    return lz4_decompress_stage(std::move(dictionary));
+}
+
+/**
+ * Creates pipeline stage that compresses data written to the sink into LZ4 frame,
+ * frame is completed when the resulting sink is destroyed or its "finish" method is called
+ * 
+ * @param options compression options
+ * @return pipeline stage
+ */
+inline lz4_compress_stage lz4_compress(lz4_options options = lz4_options()) {
+    return lz4_compress_stage(std::move(options));
+}
+
+/**
+ * Creates pipeline stage that decompresses Zstandard frames read from the source
+ * 
+ * @param dictionary dictionary that was used for compression
+ * @return pipeline stage
+ */
+inline zstd_decompress_stage zstd_decompress(std::string dictionary = "") {
+    return zstd_decompress_stage(std::move(dictionary));
+}
+
+/**
+ * Creates pipeline stage that compresses data written to the sink into Zstandard frame,
+ * frame is completed when the resulting sink is destroyed or its "finish" method is called
+ * 
+ * @param options compression options
+ * @return pipeline stage
+ */
+inline zstd_compress_stage zstd_compress(zstd_options options = zstd_options()) {
+    return zstd_compress_stage(std::move(options));
+}
+
+/**
+ * Creates pipeline stage that counts the number of bytes
+ * passed through the source or sink
+ * 
+ * @return pipeline stage
+ */
+inline count_stage count() {
+    return count_stage();
+}
+
+/**
+ * Creates pipeline stage that buffers the source or sink
+ * 
+ * @return pipeline stage
+ */
+inline buffer_stage buffer() {
+    return buffer_stage();
+}
+
+/**
+ * Applies pipeline stage to the source or sink, stages are composed
+ * at compile time, resulting type is the same as if the wrappers were
+ * nested manually. Created wrapper will own specified source or sink.
+ * 
+ * Usage example: "auto src = string_source(str) | limit(42) | hex_decode() | count();",
+ * for sinks stages are applied starting from the destination sink:
+ * "auto sink = string_sink() | count() | hex_encode();"
+ * 
+ * @param obj input source or destination sink
+ * @param stage pipeline stage
+ * @return source or sink wrapper
+ */
+template<typename T, typename Stage,
+        class = typename std::enable_if<std::is_base_of<detail_pipeline::stage, Stage>::value>::type,
+        class = typename std::enable_if<!std::is_lvalue_reference<T>::value>::type>
+auto operator|(T&& obj, const Stage& stage) -> decltype(stage.apply(std::move(obj))) {
+    return stage.apply(std::move(obj));
+}
+
+/**
+ * Applies pipeline stage to the source or sink, stages are composed
+ * at compile time, resulting type is the same as if the wrappers were
+ * nested manually. Created wrapper will NOT own specified source or sink.
+ * 
+ * @param obj input source or destination sink
+ * @param stage pipeline stage
+ * @return source or sink wrapper
+ */
+template<typename T, typename Stage,
+        class = typename std::enable_if<std::is_base_of<detail_pipeline::stage, Stage>::value>::type>
+auto operator|(T& obj, const Stage& stage) -> decltype(stage.apply(detail_pipeline::reference<T>::make(obj))) {
+    return stage.apply(detail_pipeline::reference<T>::make(obj));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_PIPELINE_HPP */
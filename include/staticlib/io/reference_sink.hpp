@@ -26,6 +26,7 @@
 
 #include <ios>
 #include <functional>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
@@ -111,6 +112,76 @@ public:
         return sink.get().flush();
     }
 
+    /**
+     * Seek implementation delegated to the underlying sink,
+     * available only if underlying sink is seekable
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     */
+    template<typename T = Sink>
+    auto seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg)
+            -> decltype(std::declval<T&>().seek(offset, whence)) {
+        return sink.get().seek(offset, whence);
+    }
+
+    /**
+     * Current position accessor delegated to the underlying sink
+     * 
+     * @return current position
+     */
+    template<typename T = Sink>
+    auto tell() -> decltype(std::declval<T&>().tell()) {
+        return sink.get().tell();
+    }
+
+    /**
+     * Size accessor delegated to the underlying sink
+     * 
+     * @return size of the underlying data
+     */
+    template<typename T = Sink>
+    auto size() -> decltype(std::declval<T&>().size()) {
+        return sink.get().size();
+    }
+
+    /**
+     * Prepare implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param min min number of bytes required
+     * @return span lent by the underlying sink
+     */
+    template<typename T = Sink>
+    auto prepare(size_t min) -> decltype(std::declval<T&>().prepare(min)) {
+        return sink.get().prepare(min);
+    }
+
+    /**
+     * Commit implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param count number of bytes written
+     */
+    template<typename T = Sink>
+    auto commit(size_t count) -> decltype(std::declval<T&>().commit(count)) {
+        return sink.get().commit(count);
+    }
+
+    /**
+     * Positional write implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param offset offset to write at
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Sink>
+    auto write_at(size_t offset, span<const char> span) -> decltype(std::declval<T&>().write_at(offset, span)) {
+        return sink.get().write_at(offset, span);
+    }
+
     /**
      * Underlying sink accessor
      * 
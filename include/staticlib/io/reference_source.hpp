@@ -26,6 +26,7 @@
 
 #include <ios>
 #include <functional>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
@@ -102,6 +103,99 @@ public:
         return src.get().read(span);
     }
 
+    /**
+     * Seek implementation delegated to the underlying source,
+     * available only if underlying source is seekable
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     */
+    template<typename T = Source>
+    auto seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg)
+            -> decltype(std::declval<T&>().seek(offset, whence)) {
+        return src.get().seek(offset, whence);
+    }
+
+    /**
+     * Current position accessor delegated to the underlying source
+     * 
+     * @return current position
+     */
+    template<typename T = Source>
+    auto tell() -> decltype(std::declval<T&>().tell()) {
+        return src.get().tell();
+    }
+
+    /**
+     * Size accessor delegated to the underlying source
+     * 
+     * @return size of the underlying data
+     */
+    template<typename T = Source>
+    auto size() -> decltype(std::declval<T&>().size()) {
+        return src.get().size();
+    }
+
+    /**
+     * Skip implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param to_skip number of bytes to skip
+     */
+    template<typename T = Source>
+    auto skip(size_t to_skip) -> decltype(std::declval<T&>().skip(to_skip)) {
+        return src.get().skip(to_skip);
+    }
+
+    /**
+     * Consume implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param count number of bytes to drop from the internal buffer
+     * @return number of bytes dropped
+     */
+    template<typename T = Source>
+    auto consume(size_t count) -> decltype(std::declval<T&>().consume(count)) {
+        return src.get().consume(count);
+    }
+
+    /**
+     * Next chunk implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto next_chunk() -> decltype(std::declval<T&>().next_chunk()) {
+        return src.get().next_chunk();
+    }
+
+    /**
+     * Borrow read implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        return src.get().borrow_read(max);
+    }
+
+    /**
+     * Positional read implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param offset offset to read from
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Source>
+    auto read_at(size_t offset, span<char> span) -> decltype(std::declval<T&>().read_at(offset, span)) {
+        return src.get().read_at(offset, span);
+    }
+
     /**
      * Underlying source accessor
      * 
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   ring_memory_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 9:40 AM
+ */
+
+#ifndef STATICLIB_IO_RING_MEMORY_SINK_HPP
+#define STATICLIB_IO_RING_MEMORY_SINK_HPP
+
+#include <functional>
+#include <ios>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/memory_ring.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink implementation that writes into the "memory_ring".
+ * Writes are partial: only the data that fits into the free space
+ * of the ring is written, zero is returned when the ring is full.
+ * Must be used only from a single writer thread.
+ */
+class ring_memory_sink {
+    /**
+     * Destination ring
+     */
+    std::reference_wrapper<memory_ring> ring;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param ring destination ring
+     */
+    explicit ring_memory_sink(memory_ring& ring) :
+    ring(ring) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    ring_memory_sink(const ring_memory_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    ring_memory_sink& operator=(const ring_memory_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    ring_memory_sink(ring_memory_sink&& other) STATICLIB_NOEXCEPT :
+    ring(other.ring) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    ring_memory_sink& operator=(ring_memory_sink&& other) STATICLIB_NOEXCEPT {
+        ring = other.ring;
+        return *this;
+    }
+
+    /**
+     * Partial write implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes written, zero if ring is full
+     */
+    std::streamsize write(span<const char> span) {
+        return static_cast<std::streamsize>(ring.get().write(span));
+    }
+
+    /**
+     * No-op flush implementation
+     * 
+     * @return 0
+     */
+    std::streamsize flush() {
+        // no-op
+        return 0;
+    }
+
+    /**
+     * Closes the ring, reader will get EOF after
+     * consuming all written data
+     */
+    void close() {
+        ring.get().close();
+    }
+
+    /**
+     * Underlying ring accessor
+     * 
+     * @return underlying ring reference
+     */
+    memory_ring& get_ring() {
+        return ring.get();
+    }
+
+};
+
+/**
+ * Factory function for creating ring memory sinks
+ * 
+ * @param ring destination ring
+ * @return ring memory sink
+ */
+inline ring_memory_sink make_ring_memory_sink(memory_ring& ring) {
+    return ring_memory_sink(ring);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_RING_MEMORY_SINK_HPP */
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   ring_memory_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 9:52 AM
+ */
+
+#ifndef STATICLIB_IO_RING_MEMORY_SOURCE_HPP
+#define STATICLIB_IO_RING_MEMORY_SOURCE_HPP
+
+#include <functional>
+#include <ios>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/memory_ring.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source implementation that reads from the "memory_ring".
+ * Reads are non-blocking: zero is returned when the ring is empty,
+ * EOF is returned when the ring is empty and was closed by writer.
+ * Must be used only from a single reader thread.
+ */
+class ring_memory_source {
+    /**
+     * Input ring
+     */
+    std::reference_wrapper<memory_ring> ring;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param ring input ring
+     */
+    explicit ring_memory_source(memory_ring& ring) :
+    ring(ring) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    ring_memory_source(const ring_memory_source&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    ring_memory_source& operator=(const ring_memory_source&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    ring_memory_source(ring_memory_source&& other) STATICLIB_NOEXCEPT :
+    ring(other.ring) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    ring_memory_source& operator=(ring_memory_source&& other) STATICLIB_NOEXCEPT {
+        ring = other.ring;
+        return *this;
+    }
+
+    /**
+     * Non-blocking read implementation
+     * 
+     * @param span buffer span
+     * @return number of bytes read, zero if ring is empty,
+     *         EOF if ring is empty and closed
+     */
+    std::streamsize read(span<char> span) {
+        // closed flag must be checked before reading,
+        // otherwise data written just before close may be lost
+        bool closed = ring.get().is_closed();
+        size_t res = ring.get().read(span);
+        if (0 == res && closed && span.size() > 0) {
+            return std::char_traits<char>::eof();
+        }
+        return static_cast<std::streamsize>(res);
+    }
+
+    /**
+     * Underlying ring accessor
+     * 
+     * @return underlying ring reference
+     */
+    memory_ring& get_ring() {
+        return ring.get();
+    }
+
+};
+
+/**
+ * Factory function for creating ring memory sources
+ * 
+ * @param ring input ring
+ * @return ring memory source
+ */
+inline ring_memory_source make_ring_memory_source(memory_ring& ring) {
+    return ring_memory_source(ring);
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_RING_MEMORY_SOURCE_HPP */
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   seekable.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 7:45 PM
+ */
+
+#ifndef STATICLIB_IO_SEEKABLE_HPP
+#define STATICLIB_IO_SEEKABLE_HPP
+
+#include <ios>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/traits.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Computes new absolute position for the "seek(offset, whence)" operation
+ * in a Source or Sink, that may be positioned anywhere from zero to its size.
+ * 
+ * @param current current position
+ * @param size size of the underlying data
+ * @param offset position offset
+ * @param whence base position for the offset
+ * @return new position
+ * @throws io_exception if new position is out of bounds
+ */
+inline size_t seek_position(size_t current, size_t size, std::streamsize offset, std::ios_base::seekdir whence) {
+    size_t base = 0;
+    if (std::ios_base::cur == whence) {
+        base = current;
+    } else if (std::ios_base::end == whence) {
+        base = size;
+    }
+    bool valid = offset >= 0 ?
+            static_cast<size_t>(offset) <= size - base :
+            static_cast<size_t>(-(offset + 1)) < base;
+    if (!valid) throw io_exception(TRACEMSG("Invalid seek position specified," +
+            " offset: [" + sl::support::to_string(offset) + "]," +
+            " base: [" + sl::support::to_string(base) + "]," +
+            " size: [" + sl::support::to_string(size) + "]"));
+    return offset >= 0 ? base + static_cast<size_t>(offset) : base - static_cast<size_t>(-(offset + 1)) - 1;
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_SEEKABLE_HPP */
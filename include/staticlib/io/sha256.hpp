@@ -0,0 +1,294 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   sha256.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 4:10 AM
+ */
+#ifndef STATICLIB_IO_SHA256_HPP
+#define STATICLIB_IO_SHA256_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define STATICLIB_IO_SHA256_SHANI
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#define STATICLIB_IO_SHA256_TARGET_SHANI
+#else // !_MSC_VER
+#include <cpuid.h>
+#include <immintrin.h>
+#define STATICLIB_IO_SHA256_TARGET_SHANI __attribute__((target("sha,sse4.1,ssse3")))
+#endif // _MSC_VER
+#endif // x86_64
+
+namespace staticlib {
+namespace io {
+
+namespace detail_sha256 {
+
+inline const uint32_t* round_constants() {
+    static const uint32_t arr[] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+    return arr;
+}
+
+inline uint32_t rotr(uint32_t x, unsigned n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+inline uint32_t read_be32(const unsigned char* ptr) {
+    return (static_cast<uint32_t>(ptr[0]) << 24) | (static_cast<uint32_t>(ptr[1]) << 16) |
+            (static_cast<uint32_t>(ptr[2]) << 8) | static_cast<uint32_t>(ptr[3]);
+}
+
+inline void compress_portable(uint32_t* state, const unsigned char* data, size_t blocks) {
+    const uint32_t* k = round_constants();
+    uint32_t w[64];
+    for (; blocks > 0; blocks--, data += 64) {
+        for (size_t i = 0; i < 16; i++) {
+            w[i] = read_be32(data + i * 4);
+        }
+        for (size_t i = 16; i < 64; i++) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (size_t i = 0; i < 64; i++) {
+            uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+            uint32_t ch = (e & f) ^ (~e & g);
+            uint32_t t1 = h + s1 + ch + k[i] + w[i];
+            uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = s0 + maj;
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+}
+
+#ifdef STATICLIB_IO_SHA256_SHANI
+
+inline bool detect_shani() {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    bool ssse3_sse41 = 0 != (info[2] & (1 << 9)) && 0 != (info[2] & (1 << 19));
+    __cpuidex(info, 7, 0);
+    return ssse3_sse41 && 0 != (info[1] & (1 << 29));
+#else // !_MSC_VER
+    unsigned a = 0, b = 0, c = 0, d = 0;
+    if (!__get_cpuid(1, &a, &b, &c, &d) || 0 == (c & (1u << 9)) || 0 == (c & (1u << 19))) {
+        return false;
+    }
+    if (!__get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+        return false;
+    }
+    return 0 != (b & (1u << 29));
+#endif // _MSC_VER
+}
+
+inline bool has_shani() {
+    static const bool res = detect_shani();
+    return res;
+}
+
+// state is kept in ABEF/CDGH order as SHA extensions expect
+STATICLIB_IO_SHA256_TARGET_SHANI
+inline void compress_shani(uint32_t* state, const unsigned char* data, size_t blocks) {
+    const uint32_t* k = round_constants();
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0xb1);
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)), 0x1b);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+    for (; blocks > 0; blocks--, data += 64) {
+        __m128i abef = state0;
+        __m128i cdgh = state1;
+        __m128i msg[4];
+        for (size_t i = 0; i < 4; i++) {
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), mask);
+        }
+        for (size_t i = 0; i < 16; i++) {
+            __m128i wk = _mm_add_epi32(msg[i & 3], _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + i * 4)));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0e));
+            if (i < 12) {
+                // next message words replace the ones just used
+                __m128i next = _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]);
+                next = _mm_add_epi32(next, _mm_alignr_epi8(msg[(i + 3) & 3], msg[(i + 2) & 3], 4));
+                msg[i & 3] = _mm_sha256msg2_epu32(next, msg[(i + 3) & 3]);
+            }
+        }
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(tmp, state1, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(state1, tmp, 8));
+}
+
+#endif // STATICLIB_IO_SHA256_SHANI
+
+inline void compress(uint32_t* state, const unsigned char* data, size_t blocks) {
+#ifdef STATICLIB_IO_SHA256_SHANI
+    if (has_shani()) {
+        compress_shani(state, data, blocks);
+        return;
+    }
+#endif // STATICLIB_IO_SHA256_SHANI
+    compress_portable(state, data, blocks);
+}
+
+} // namespace
+
+/**
+ * SHA-256 (FIPS 180-4) digest computation, uses SHA extensions
+ * of x86_64 CPUs when they are available. Can be used with
+ * "digest_sink" and "digest_source".
+ */
+class sha256 {
+    uint32_t state[8];
+    unsigned char buffer[64];
+    size_t buffer_len = 0;
+    uint64_t total_len = 0;
+    bool finished = false;
+
+public:
+    /**
+     * Constructor
+     */
+    sha256() {
+        reset();
+    }
+
+    /**
+     * Resets the state to start a new digest computation
+     */
+    void reset() {
+        static const uint32_t iv[] = {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+        std::memcpy(state, iv, sizeof(state));
+        buffer_len = 0;
+        total_len = 0;
+        finished = false;
+    }
+
+    /**
+     * Adds data to digest computation
+     * 
+     * @param data input data
+     * @throws io_exception if the digest was already computed
+     */
+    void update(span<const char> data) {
+        if (finished) throw io_exception(TRACEMSG("Invalid update after the digest was computed"));
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(data.data());
+        size_t len = data.size();
+        total_len += len;
+        if (buffer_len > 0) {
+            size_t take = len < 64 - buffer_len ? len : 64 - buffer_len;
+            std::memcpy(buffer + buffer_len, src, take);
+            buffer_len += take;
+            src += take;
+            len -= take;
+            if (64 == buffer_len) {
+                detail_sha256::compress(state, buffer, 1);
+                buffer_len = 0;
+            }
+        }
+        if (len >= 64) {
+            detail_sha256::compress(state, src, len / 64);
+            src += len & ~static_cast<size_t>(63);
+            len &= 63;
+        }
+        if (len > 0) {
+            std::memcpy(buffer, src, len);
+            buffer_len = len;
+        }
+    }
+
+    /**
+     * Completes digest computation, "reset" must be called
+     * before computing the next digest
+     * 
+     * @return digest bytes
+     */
+    std::string digest() {
+        if (!finished) {
+            finished = true;
+            uint64_t bits = total_len * 8;
+            buffer[buffer_len++] = 0x80;
+            if (buffer_len > 56) {
+                std::memset(buffer + buffer_len, 0, 64 - buffer_len);
+                detail_sha256::compress(state, buffer, 1);
+                buffer_len = 0;
+            }
+            std::memset(buffer + buffer_len, 0, 56 - buffer_len);
+            for (size_t i = 0; i < 8; i++) {
+                buffer[56 + i] = static_cast<unsigned char>(bits >> (56 - i * 8));
+            }
+            detail_sha256::compress(state, buffer, 1);
+        }
+        std::string res;
+        res.reserve(32);
+        for (size_t i = 0; i < 8; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                res.push_back(static_cast<char>((state[i] >> (24 - j * 8)) & 0xff));
+            }
+        }
+        return res;
+    }
+
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_SHA256_HPP */
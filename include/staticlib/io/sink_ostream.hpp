@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   sink_ostream.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:30 PM
+ */
+
+#ifndef STATICLIB_IO_SINK_OSTREAM_HPP
+#define STATICLIB_IO_SINK_OSTREAM_HPP
+
+#include <ios>
+#include <memory>
+#include <ostream>
+
+#include "staticlib/io/buffered_streambuf.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Helper template that wraps an arbitrary sink
+ * into owning stream instance. Stream uses buffered streambuf,
+ * pending data is written to sink on "flush" and on destruction.
+ */
+template <typename Sink>
+class sink_ostream : public std::ostream {
+    /**
+     * Buffered streambuf
+     */
+    staticlib::io::buffered_ostreambuf<Sink> streambuf;
+
+public:
+
+    /**
+     * Constructor
+     * 
+     * @param sink arbitrary sink
+     * @param buffer_size put area size, not used if sink lends its buffer
+     */
+    explicit sink_ostream(Sink&& sink, size_t buffer_size = 4096) :
+    std::ostream(std::addressof(streambuf)),
+    streambuf(std::move(sink), buffer_size) { }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    sink_ostream(const sink_ostream&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    sink_ostream& operator=(const sink_ostream&) = delete;
+
+    /**
+     * Deleted move constructor
+     * 
+     * @param other instance
+     */
+    sink_ostream(sink_ostream&&) = delete;
+
+    /**
+     * Deleted move assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    sink_ostream& operator=(sink_ostream&&) = delete;
+
+};
+
+/**
+ * Factory function for creating sink ostream unique pointers,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param buffer_size put area size, not used if sink lends its buffer
+ * @return sink ostream pointer
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+std::unique_ptr<std::ostream> make_sink_ostream_ptr(Sink&& sink, size_t buffer_size = 4096) {
+    return std::unique_ptr<std::ostream>(new sink_ostream<Sink>(std::move(sink), buffer_size));
+}
+
+/**
+ * Factory function for creating sink ostream unique pointers,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param buffer_size put area size, not used if sink lends its buffer
+ * @return sink ostream pointer
+ */
+template <typename Sink>
+std::unique_ptr<std::ostream> make_sink_ostream_ptr(Sink& sink, size_t buffer_size = 4096) {
+    return std::unique_ptr<std::ostream>(new sink_ostream<reference_sink<Sink>>(
+            make_reference_sink(sink), buffer_size));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_SINK_OSTREAM_HPP */
@@ -28,7 +28,7 @@
 #include <istream>
 #include <memory>
 
-#include "staticlib/io/unbuffered_streambuf.hpp"
+#include "staticlib/io/buffered_streambuf.hpp"
 #include "staticlib/io/reference_source.hpp"
 #include "staticlib/io/span.hpp"
 
@@ -37,15 +37,15 @@ namespace io {
 
 /**
  * Helper template that wraps an arbitrary source
- * into owning stream instance. That stream may be used by client
- * only to obtain unbuffered streambuf from it.
+ * into owning stream instance. Stream uses buffered streambuf
+ * and supports formatted input, "getline" etc.
  */
 template <typename Source>
 class source_istream : public std::istream {
     /**
-     * Unbuffered streambuf
+     * Buffered streambuf
      */
-    staticlib::io::unbuffered_istreambuf<Source> streambuf;
+    staticlib::io::buffered_istreambuf<Source> streambuf;
 
 public:
 
@@ -53,10 +53,11 @@ public:
      * Constructor
      * 
      * @param source arbitrary source
+     * @param buffer_size max number of bytes to read from source at once
      */
-    explicit source_istream(Source&& source) :
+    explicit source_istream(Source&& source, size_t buffer_size = 4096) :
     std::istream(std::addressof(streambuf)),
-    streambuf(std::move(source)) { }
+    streambuf(std::move(source), buffer_size) { }
 
     /**
      * Deleted copy constructor
@@ -95,12 +96,13 @@ public:
  * created source wrapper will own specified source
  * 
  * @param source input source
+ * @param buffer_size max number of bytes to read from source at once
  * @return source istream pointer
  */
 template <typename Source,
         class = typename std::enable_if<!std::is_lvalue_reference<Source>::value>::type>
-std::unique_ptr<std::istream> make_source_istream_ptr(Source&& source) {
-    return std::unique_ptr<std::istream>(new source_istream<Source>(std::move(source)));
+std::unique_ptr<std::istream> make_source_istream_ptr(Source&& source, size_t buffer_size = 4096) {
+    return std::unique_ptr<std::istream>(new source_istream<Source>(std::move(source), buffer_size));
 }
 
 /**
@@ -108,11 +110,13 @@ std::unique_ptr<std::istream> make_source_istream_ptr(Source&& source) {
  * created source wrapper will NOT own specified source
  * 
  * @param source input source
+ * @param buffer_size max number of bytes to read from source at once
  * @return source istream pointer
  */
 template <typename Source>
-std::unique_ptr<std::istream> make_source_istream_ptr(Source& source) {
-    return std::unique_ptr<std::istream>(new source_istream<reference_source<Source>>(make_reference_source(source)));
+std::unique_ptr<std::istream> make_source_istream_ptr(Source& source, size_t buffer_size = 4096) {
+    return std::unique_ptr<std::istream>(new source_istream<reference_source<Source>>(
+            make_reference_source(source), buffer_size));
 }
 
 } // namespace
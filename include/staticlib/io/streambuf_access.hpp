@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   streambuf_access.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 4:45 PM
+ */
+
+#ifndef STATICLIB_IO_STREAMBUF_ACCESS_HPP
+#define STATICLIB_IO_STREAMBUF_ACCESS_HPP
+
+#include <climits>
+#include <cstring>
+#include <streambuf>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_streambuf {
+
+/**
+ * Access to get and put areas of arbitrary "std::streambuf".
+ * Protected area accessors are called through pointers to members
+ * obtained in the derived class, this is allowed for objects of
+ * any type derived from "std::streambuf" and does not require
+ * the streambuf itself to be of this type.
+ */
+class area_access : public std::streambuf {
+public:
+    /**
+     * Copies data from the get area of specified streambuf
+     * without calling any virtual methods
+     * 
+     * @param sb streambuf
+     * @param dest destination buffer
+     * @param len max number of bytes to copy
+     * @return number of bytes copied
+     */
+    static size_t copy_from_get_area(std::streambuf* sb, char* dest, size_t len) {
+        char* begin = (sb->*(&area_access::gptr))();
+        char* end = (sb->*(&area_access::egptr))();
+        size_t avail = begin < end ? static_cast<size_t>(end - begin) : 0;
+        size_t count = len < avail ? len : avail;
+        if (count > 0) {
+            std::memcpy(dest, begin, count);
+            advance(sb, &area_access::gbump, count);
+        }
+        return count;
+    }
+
+    /**
+     * Copies data into the put area of specified streambuf
+     * without calling any virtual methods
+     * 
+     * @param sb streambuf
+     * @param src source buffer
+     * @param len max number of bytes to copy
+     * @return number of bytes copied
+     */
+    static size_t copy_to_put_area(std::streambuf* sb, const char* src, size_t len) {
+        char* begin = (sb->*(&area_access::pptr))();
+        char* end = (sb->*(&area_access::epptr))();
+        size_t avail = begin < end ? static_cast<size_t>(end - begin) : 0;
+        size_t count = len < avail ? len : avail;
+        if (count > 0) {
+            std::memcpy(begin, src, count);
+            advance(sb, &area_access::pbump, count);
+        }
+        return count;
+    }
+
+private:
+    static void advance(std::streambuf* sb, void (std::streambuf::*bump)(int), size_t count) {
+        while (count > 0) {
+            int step = count < static_cast<size_t>(INT_MAX) ? static_cast<int>(count) : INT_MAX;
+            (sb->*bump)(step);
+            count -= static_cast<size_t>(step);
+        }
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_STREAMBUF_ACCESS_HPP */
@@ -30,6 +30,7 @@
 #include "staticlib/config.hpp"
 
 #include "staticlib/io/span.hpp"
+#include "staticlib/io/streambuf_access.hpp"
 
 namespace staticlib {
 namespace io {
@@ -90,13 +91,24 @@ public:
     }
 
     /**
-     * Write implementation delegated to the underlying streambuf
+     * Write implementation delegated to the underlying streambuf,
+     * data is copied directly into the free space of the put area,
+     * remaining data is written with "sputn"
      * 
      * @param span buffer span
      * @return number of bytes processed
      */
     std::streamsize write(span<const char> span) {
-        return streambuf->sputn(span.data(), span.size_signed());
+        size_t copied = detail_streambuf::area_access::copy_to_put_area(streambuf, span.data(), span.size());
+        if (copied == span.size()) {
+            return static_cast<std::streamsize>(copied);
+        }
+        std::streamsize res = streambuf->sputn(span.data() + copied,
+                static_cast<std::streamsize>(span.size() - copied));
+        if (0 == copied) {
+            return res;
+        }
+        return static_cast<std::streamsize>(copied) + (res > 0 ? res : 0);
     }
 
     /**
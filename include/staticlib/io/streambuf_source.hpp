@@ -30,6 +30,7 @@
 #include "staticlib/config.hpp"
 
 #include "staticlib/io/span.hpp"
+#include "staticlib/io/streambuf_access.hpp"
 
 namespace staticlib {
 namespace io {
@@ -91,19 +92,29 @@ public:
     }
 
     /**
-     * Read implementation delegated to the underlying streambuf
+     * Read implementation delegated to the underlying streambuf,
+     * data available in the get area is copied directly, remaining
+     * data is read with "sgetn", EOF is checked with "sgetc" that
+     * does not require putback support from the streambuf
      * 
      * @param span buffer span
      * @return number of bytes processed
      */    
     std::streamsize read(span<char> span) {
-        std::streamsize res = streambuf->sgetn(span.data(), span.size_signed());
-        if (res > 0) {
-            return res;
-        } else if (0 == res && std::char_traits<char>::eof() == streambuf->sbumpc()) {
+        if (0 == span.size()) {
+            return 0;
+        }
+        size_t copied = detail_streambuf::area_access::copy_from_get_area(streambuf, span.data(), span.size());
+        if (copied == span.size()) {
+            return static_cast<std::streamsize>(copied);
+        }
+        std::streamsize res = streambuf->sgetn(span.data() + copied,
+                static_cast<std::streamsize>(span.size() - copied));
+        if (res > 0 || copied > 0) {
+            return static_cast<std::streamsize>(copied) + (res > 0 ? res : 0);
+        } else if (0 == res && std::char_traits<char>::eof() == streambuf->sgetc()) {
             return std::char_traits<char>::eof();
         } else {
-            streambuf->sungetc();
             return res;
         }
     }
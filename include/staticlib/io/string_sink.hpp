@@ -45,6 +45,10 @@ class string_sink {
      * Destination string
      */
     std::string str;
+    /**
+     * Number of bytes at the end of the string lent by "prepare"
+     */
+    size_t prepared = 0;
     
 public:
     /**
@@ -81,7 +85,10 @@ public:
      * @param other other instance
      */
     string_sink(string_sink&& other) STATICLIB_NOEXCEPT :
-    str(std::move(other.str)) { }
+    str(std::move(other.str)),
+    prepared(other.prepared) {
+        other.prepared = 0;
+    }
 
     /**
      * Move assignment operator
@@ -91,6 +98,8 @@ public:
      */
     string_sink& operator=(string_sink&& other) STATICLIB_NOEXCEPT {
         str = std::move(other.str);
+        prepared = other.prepared;
+        other.prepared = 0;
         return *this;
     }
 
@@ -101,6 +110,7 @@ public:
      * @return number of bytes processed
      */
     std::streamsize write(span<const char> span) {
+        drop_prepared();
         size_t ulen = span.size();
         size_t size = str.size();
         if (!sl::support::is_streamsize(size)) throw io_exception(TRACEMSG(
@@ -110,12 +120,53 @@ public:
         return static_cast<std::streamsize> (ulen);
     }
 
+    /**
+     * Lends the tail of the string, so data can be written into it directly.
+     * String is grown by at least "min" bytes (and by no less than 8 KiB
+     * to keep the zero-filled tail small and cache-hot), string capacity
+     * is doubled when necessary. Grown tail is reused by subsequent
+     * "prepare" calls. Written data becomes a part of the string after
+     * "commit" call, uncommitted data is dropped on the next "write"
+     * or "get_string" call.
+     * 
+     * @param min min number of bytes required
+     * @return span over the string tail, at least "min" bytes long
+     */
+    span<char> prepare(size_t min) {
+        if (prepared < min || 0 == prepared) {
+            size_t size = str.size() - prepared;
+            size_t len = min > 8192 ? min : 8192;
+            if (str.capacity() - size < len) {
+                size_t doubled = size * 2;
+                str.reserve(size + len > doubled ? size + len : doubled);
+            }
+            str.resize(size + len);
+            prepared = len;
+        }
+        return span<char>(std::addressof(str.front()) + str.size() - prepared, prepared);
+    }
+
+    /**
+     * Appends specified number of bytes, written into the span returned
+     * from the last "prepare" call, to the string
+     * 
+     * @param count number of bytes written
+     * @throws io_exception if count exceeds prepared size
+     */
+    void commit(size_t count) {
+        if (count > prepared) throw io_exception(TRACEMSG(
+                "Commit size: [" + sl::support::to_string(count) + "]" +
+                " exceeds prepared size: [" + sl::support::to_string(prepared) + "]"));
+        prepared -= count;
+    }
+
     /**
      * Underlying string accessor
      * 
      * @return underlying string
      */
     std::string& get_string() {
+        drop_prepared();
         return str;
     }
 
@@ -129,6 +180,14 @@ public:
         return 0;
     }
 
+private:
+    void drop_prepared() {
+        if (prepared > 0) {
+            str.resize(str.size() - prepared);
+            prepared = 0;
+        }
+    }
+
 };
 
 } // namespace
@@ -32,6 +32,7 @@
 #include "staticlib/config.hpp"
 
 #include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/seekable.hpp"
 #include "staticlib/io/span.hpp"
 
 namespace staticlib {
@@ -45,6 +46,10 @@ class string_source {
      * Source string
      */
     std::string str;
+    /**
+     * Start index
+     */
+    size_t start;
     /**
      * Current string position
      */
@@ -62,6 +67,7 @@ public:
      */
     string_source(std::string&& str) :
     str(std::move(str)),
+    start(0),
     idx(0),
     str_len(this->str.length()) { }
 
@@ -82,6 +88,7 @@ public:
      */
     string_source(std::string&& str, size_t from, size_t to) :
     str(std::move(str)),
+    start(from),
     idx(from),
     str_len(to) { }
 
@@ -107,8 +114,10 @@ public:
      */
     string_source(string_source&& other) STATICLIB_NOEXCEPT :
     str(std::move(other.str)),
+    start(other.start),
     idx(other.idx),
     str_len(other.str_len) {
+        other.start = 0;
         other.idx = 0;
         other.str_len = 0;
     }
@@ -121,6 +130,8 @@ public:
      */
     string_source& operator=(string_source&& other) STATICLIB_NOEXCEPT {
         str = std::move(other.str);
+        start = other.start;
+        other.start = 0;
         idx = other.idx;
         other.idx = 0;
         str_len = other.str_len;
@@ -145,6 +156,84 @@ public:
         } else return std::char_traits<char>::eof();        
     }
 
+    /**
+     * Lends all the remaining data directly from the underlying string
+     * without copying it, current position is moved to the end
+     * 
+     * @return span over the remaining data, empty span if source is exhausted
+     */
+    span<const char> next_chunk() {
+        size_t avail = str_len - idx;
+        const char* ptr = str.data() + idx;
+        this->idx = str_len;
+        return span<const char>(ptr, avail);
+    }
+
+    /**
+     * Lends up to specified number of bytes directly from the underlying
+     * string without copying them, current position is moved accordingly
+     * 
+     * @param max max number of bytes to lend, must be positive
+     * @return span over the lent data, empty span if source is exhausted
+     */
+    span<const char> borrow_read(size_t max) {
+        size_t avail = str_len - idx;
+        size_t len = max <= avail ? max : avail;
+        const char* ptr = str.data() + idx;
+        this->idx += len;
+        return span<const char>(ptr, len);
+    }
+
+    /**
+     * Positional read implementation, does not change
+     * the current position and can be called concurrently
+     * 
+     * @param offset offset relative to the start index to read from
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize read_at(size_t offset, span<char> span) const {
+        size_t size = str_len - start;
+        if (offset < size) {
+            size_t avail = size - offset;
+            size_t len = span.size() <= avail ? span.size() : avail;
+            std::memcpy(span.data(), str.data() + start + offset, len);
+            return static_cast<std::streamsize>(len);
+        } else return std::char_traits<char>::eof();
+    }
+
+    /**
+     * Changes current position, positions are relative
+     * to the start index specified on creation
+     * 
+     * @param offset position offset
+     * @param whence base position for the offset
+     * @return new position
+     * @throws io_exception if new position is out of bounds
+     */
+    size_t seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg) {
+        idx = start + seek_position(idx - start, str_len - start, offset, whence);
+        return idx - start;
+    }
+
+    /**
+     * Current position accessor
+     * 
+     * @return current position relative to the start index
+     */
+    size_t tell() const {
+        return idx - start;
+    }
+
+    /**
+     * Size accessor
+     * 
+     * @return number of bytes between start and end indices
+     */
+    size_t size() const {
+        return str_len - start;
+    }
+
     /**
      * Underlying string accessor
      * 
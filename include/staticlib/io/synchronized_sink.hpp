@@ -0,0 +1,232 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   synchronized_sink.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:10 PM
+ */
+
+#ifndef STATICLIB_IO_SYNCHRONIZED_SINK_HPP
+#define STATICLIB_IO_SYNCHRONIZED_SINK_HPP
+
+#include <atomic>
+#include <ios>
+#include <memory>
+#include <mutex>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/buffered_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_synchronized {
+
+/**
+ * State shared between copies of the synchronized wrapper
+ */
+template<typename Target>
+class synchronized_state {
+public:
+    /**
+     * Wrapped instance
+     */
+    std::shared_ptr<Target> target;
+    /**
+     * Lock
+     */
+    std::mutex mutex;
+    /**
+     * Number of calls made
+     */
+    std::atomic<size_t> calls_count;
+    /**
+     * Number of calls that found the lock already taken
+     */
+    std::atomic<size_t> contended_count;
+
+    /**
+     * Constructor
+     * 
+     * @param target wrapped instance
+     */
+    explicit synchronized_state(std::shared_ptr<Target> target) :
+    target(std::move(target)),
+    calls_count(0),
+    contended_count(0) { }
+
+    /**
+     * Takes the lock, counting the contention
+     * 
+     * @return lock guard
+     */
+    std::unique_lock<std::mutex> lock() {
+        calls_count.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock<std::mutex> guard{mutex, std::try_to_lock};
+        if (!guard.owns_lock()) {
+            contended_count.fetch_add(1, std::memory_order_relaxed);
+            guard.lock();
+        }
+        return guard;
+    }
+};
+
+} // namespace
+
+/**
+ * Sink wrapper that holds a "std::shared_ptr" to the underlying sink
+ * and serializes "write" and "flush" calls with a mutex. Copies of this
+ * sink share the same mutex and can be used from different threads.
+ */
+template <typename Sink>
+class synchronized_sink {
+    /**
+     * Shared state
+     */
+    std::shared_ptr<detail_synchronized::synchronized_state<Sink>> state;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param sink destination sink
+     */
+    explicit synchronized_sink(std::shared_ptr<Sink> sink) :
+    state(std::make_shared<detail_synchronized::synchronized_state<Sink>>(std::move(sink))) { }
+
+    /**
+     * Copy constructor
+     * 
+     * @param other instance
+     */
+    synchronized_sink(const synchronized_sink& other) :
+    state(other.state) { }
+
+    /**
+     * Copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    synchronized_sink& operator=(const synchronized_sink& other) {
+        state = other.state;
+        return *this;
+    }
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    synchronized_sink(synchronized_sink&& other) STATICLIB_NOEXCEPT :
+    state(std::move(other.state)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    synchronized_sink& operator=(synchronized_sink&& other) STATICLIB_NOEXCEPT {
+        state = std::move(other.state);
+        return *this;
+    }
+
+    /**
+     * Write implementation delegated to the underlying sink under the lock
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        auto guard = state->lock();
+        return state->target->write(span);
+    }
+
+    /**
+     * Flushes destination sink under the lock
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        auto guard = state->lock();
+        return state->target->flush();
+    }
+
+    /**
+     * Returns number of "write" and "flush" calls made through all copies of this sink
+     * 
+     * @return number of calls
+     */
+    size_t get_calls_count() {
+        return state->calls_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns number of calls that had to wait for the lock
+     * 
+     * @return number of contended calls
+     */
+    size_t get_contended_count() {
+        return state->contended_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Underlying sink accessor, access to it is not synchronized
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return *state->target;
+    }
+
+};
+
+/**
+ * Factory function for creating synchronized sinks
+ * 
+ * @param sink destination sink
+ * @return synchronized sink
+ */
+template <typename Sink>
+synchronized_sink<Sink> make_synchronized_sink(std::shared_ptr<Sink> sink) {
+    return synchronized_sink<Sink>(std::move(sink));
+}
+
+/**
+ * Factory function for creating per-thread buffers over the synchronized sink.
+ * Each thread should create its own buffer, buffer contents is written
+ * to the destination under the lock when buffer is full or flushed,
+ * so the lock is taken once per buffer instead of once per write.
+ * Writes smaller than the buffer size are passed to destination
+ * as a part of a single locked write.
+ * 
+ * @param sink synchronized sink
+ * @return buffered sink owning a copy of the synchronized sink
+ */
+template <typename Sink>
+buffered_sink<synchronized_sink<Sink>> make_thread_buffered_sink(const synchronized_sink<Sink>& sink) {
+    return buffered_sink<synchronized_sink<Sink>>(synchronized_sink<Sink>(sink));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_SYNCHRONIZED_SINK_HPP */
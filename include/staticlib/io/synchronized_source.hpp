@@ -0,0 +1,151 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   synchronized_source.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:45 PM
+ */
+
+#ifndef STATICLIB_IO_SYNCHRONIZED_SOURCE_HPP
+#define STATICLIB_IO_SYNCHRONIZED_SOURCE_HPP
+
+#include <ios>
+#include <memory>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/synchronized_sink.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Source wrapper that holds a "std::shared_ptr" to the underlying source
+ * and serializes "read" calls with a mutex. Copies of this source
+ * share the same mutex and can be used from different threads.
+ */
+template <typename Source>
+class synchronized_source {
+    /**
+     * Shared state
+     */
+    std::shared_ptr<detail_synchronized::synchronized_state<Source>> state;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param src input source
+     */
+    explicit synchronized_source(std::shared_ptr<Source> src) :
+    state(std::make_shared<detail_synchronized::synchronized_state<Source>>(std::move(src))) { }
+
+    /**
+     * Copy constructor
+     * 
+     * @param other instance
+     */
+    synchronized_source(const synchronized_source& other) :
+    state(other.state) { }
+
+    /**
+     * Copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance
+     */
+    synchronized_source& operator=(const synchronized_source& other) {
+        state = other.state;
+        return *this;
+    }
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    synchronized_source(synchronized_source&& other) STATICLIB_NOEXCEPT :
+    state(std::move(other.state)) { }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    synchronized_source& operator=(synchronized_source&& other) STATICLIB_NOEXCEPT {
+        state = std::move(other.state);
+        return *this;
+    }
+
+    /**
+     * Read implementation delegated to the underlying source under the lock
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize read(span<char> span) {
+        auto guard = state->lock();
+        return state->target->read(span);
+    }
+
+    /**
+     * Returns number of "read" calls made through all copies of this source
+     * 
+     * @return number of calls
+     */
+    size_t get_calls_count() {
+        return state->calls_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns number of calls that had to wait for the lock
+     * 
+     * @return number of contended calls
+     */
+    size_t get_contended_count() {
+        return state->contended_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Underlying source accessor, access to it is not synchronized
+     * 
+     * @return underlying source reference
+     */
+    Source& get_source() {
+        return *state->target;
+    }
+
+};
+
+/**
+ * Factory function for creating synchronized sources
+ * 
+ * @param source input source
+ * @return synchronized source
+ */
+template <typename Source>
+synchronized_source<Source> make_synchronized_source(std::shared_ptr<Source> source) {
+    return synchronized_source<Source>(std::move(source));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_SYNCHRONIZED_SOURCE_HPP */
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   traits.hpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 7:30 PM
+ */
+
+#ifndef STATICLIB_IO_TRAITS_HPP
+#define STATICLIB_IO_TRAITS_HPP
+
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Checks whether specified Source or Sink type implements optional
+ * "seek(offset, whence)" method (with "tell()" and "size()" methods
+ * expected to be implemented along with it)
+ */
+template<typename T>
+class has_seek {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().seek(std::streamsize(0), std::ios_base::beg),
+            std::declval<U&>().tell(), std::declval<U&>().size(), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Source type implements optional
+ * "skip(count)" method
+ */
+template<typename T>
+class has_skip {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().skip(size_t(0)), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Source type implements optional
+ * "consume(count)" method, that drops data from the internal buffer,
+ * along with the "get_source()" method, that allows to skip
+ * the remaining data in underlying source after the buffer is emptied
+ */
+template<typename T>
+class has_consume {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().consume(size_t(0)),
+            std::declval<U&>().get_source(), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Source type implements optional
+ * "next_chunk()" method, that lends the data without copying it
+ */
+template<typename T>
+class has_next_chunk {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().next_chunk(), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Source type implements optional
+ * "borrow_read(max)" method, that lends up to specified number
+ * of bytes without copying them
+ */
+template<typename T>
+class has_borrow_read {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().borrow_read(size_t(0)), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Sink type implements optional
+ * "prepare(min)" and "commit(count)" methods, that allow
+ * to write data directly into the Sink buffer
+ */
+template<typename T>
+class has_prepare {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().prepare(size_t(0)),
+            std::declval<U&>().commit(size_t(0)), std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Source type implements optional
+ * positional "read_at(offset, span)" method
+ */
+template<typename T>
+class has_read_at {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().read_at(size_t(0), std::declval<span<char>>()),
+            std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+/**
+ * Checks whether specified Sink type implements optional
+ * positional "write_at(offset, span)" method
+ */
+template<typename T>
+class has_write_at {
+    template<typename U>
+    static auto test(int) -> decltype(std::declval<U&>().write_at(size_t(0), std::declval<span<const char>>()),
+            std::true_type());
+
+    template<typename>
+    static std::false_type test(...);
+
+public:
+    /**
+     * Check result
+     */
+    static const bool value = decltype(test<T>(0))::value;
+};
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_TRAITS_HPP */
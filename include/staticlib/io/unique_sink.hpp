@@ -26,6 +26,7 @@
 
 #include <ios>
 #include <memory>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
@@ -106,6 +107,42 @@ public:
         return sink->flush();
     }
 
+    /**
+     * Prepare implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param min min number of bytes required
+     * @return span lent by the underlying sink
+     */
+    template<typename T = Sink>
+    auto prepare(size_t min) -> decltype(std::declval<T&>().prepare(min)) {
+        return sink->prepare(min);
+    }
+
+    /**
+     * Commit implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param count number of bytes written
+     */
+    template<typename T = Sink>
+    auto commit(size_t count) -> decltype(std::declval<T&>().commit(count)) {
+        return sink->commit(count);
+    }
+
+    /**
+     * Positional write implementation delegated to the underlying sink,
+     * available only if underlying sink implements it
+     * 
+     * @param offset offset to write at
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Sink>
+    auto write_at(size_t offset, span<const char> span) -> decltype(std::declval<T&>().write_at(offset, span)) {
+        return sink->write_at(offset, span);
+    }
+
     /**
      * Underlying sink accessor
      * 
@@ -115,6 +152,15 @@ public:
         return *sink;
     }
 
+    /**
+     * Releases the ownership of the underlying sink
+     * 
+     * @return pointer to the underlying sink, must be deleted by the caller
+     */
+    Sink* release() {
+        return sink.release();
+    }
+
 };
 
 /**
@@ -26,6 +26,7 @@
 
 #include <ios>
 #include <memory>
+#include <utility>
 
 #include "staticlib/config.hpp"
 
@@ -97,6 +98,31 @@ public:
         return src->read(span);
     }
 
+    /**
+     * Borrow read implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param max max number of bytes to lend
+     * @return span over the data lent by the underlying source
+     */
+    template<typename T = Source>
+    auto borrow_read(size_t max) -> decltype(std::declval<T&>().borrow_read(max)) {
+        return src->borrow_read(max);
+    }
+
+    /**
+     * Positional read implementation delegated to the underlying source,
+     * available only if underlying source implements it
+     * 
+     * @param offset offset to read from
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    template<typename T = Source>
+    auto read_at(size_t offset, span<char> span) -> decltype(std::declval<T&>().read_at(offset, span)) {
+        return src->read_at(offset, span);
+    }
+
     /**
      * Underlying source accessor
      * 
@@ -105,6 +131,15 @@ public:
     Source& get_source() {
         return *src;
     }
+
+    /**
+     * Releases the ownership of the underlying source
+     * 
+     * @return pointer to the underlying source, must be deleted by the caller
+     */
+    Source* release() {
+        return src.release();
+    }
     
 };
 
@@ -0,0 +1,332 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   xxhash.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 10:10 PM
+ */
+
+#ifndef STATICLIB_IO_XXHASH_HPP
+#define STATICLIB_IO_XXHASH_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_xxhash {
+
+inline uint32_t read32(const unsigned char* ptr) {
+    return static_cast<uint32_t>(ptr[0]) | (static_cast<uint32_t>(ptr[1]) << 8) |
+            (static_cast<uint32_t>(ptr[2]) << 16) | (static_cast<uint32_t>(ptr[3]) << 24);
+}
+
+inline uint64_t read64(const unsigned char* ptr) {
+    return static_cast<uint64_t>(read32(ptr)) | (static_cast<uint64_t>(read32(ptr + 4)) << 32);
+}
+
+inline uint32_t rotl32(uint32_t x, int r) {
+    return (x << r) | (x >> (32 - r));
+}
+
+inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+/**
+ * Incremental 32-bit xxHash, used by LZ4 frame format
+ */
+class xxh32 {
+    static const uint32_t prime1 = 0x9E3779B1U;
+    static const uint32_t prime2 = 0x85EBCA77U;
+    static const uint32_t prime3 = 0xC2B2AE3DU;
+    static const uint32_t prime4 = 0x27D4EB2FU;
+    static const uint32_t prime5 = 0x165667B1U;
+
+    uint32_t seed;
+    std::array<uint32_t, 4> acc;
+    std::array<unsigned char, 16> stripe;
+    size_t stripe_len = 0;
+    uint64_t total_len = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param seed hash seed
+     */
+    explicit xxh32(uint32_t seed = 0) :
+    seed(seed) {
+        reset();
+    }
+
+    /**
+     * Resets the state to hash the new data
+     */
+    void reset() {
+        acc[0] = seed + prime1 + prime2;
+        acc[1] = seed + prime2;
+        acc[2] = seed;
+        acc[3] = seed - prime1;
+        stripe_len = 0;
+        total_len = 0;
+    }
+
+    /**
+     * Hashes specified data
+     * 
+     * @param data input data
+     * @param len data length
+     */
+    void update(const unsigned char* data, size_t len) {
+        total_len += len;
+        if (stripe_len > 0) {
+            size_t fill = len < 16 - stripe_len ? len : 16 - stripe_len;
+            std::memcpy(stripe.data() + stripe_len, data, fill);
+            stripe_len += fill;
+            data += fill;
+            len -= fill;
+            if (stripe_len < 16) {
+                return;
+            }
+            process(stripe.data());
+            stripe_len = 0;
+        }
+        while (len >= 16) {
+            process(data);
+            data += 16;
+            len -= 16;
+        }
+        if (len > 0) {
+            std::memcpy(stripe.data(), data, len);
+            stripe_len = len;
+        }
+    }
+
+    /**
+     * Computes the hash of all data passed so far,
+     * state is not changed
+     * 
+     * @return hash value
+     */
+    uint32_t digest() const {
+        uint32_t h = 0;
+        if (total_len >= 16) {
+            h = rotl32(acc[0], 1) + rotl32(acc[1], 7) + rotl32(acc[2], 12) + rotl32(acc[3], 18);
+        } else {
+            h = seed + prime5;
+        }
+        h += static_cast<uint32_t>(total_len);
+        const unsigned char* ptr = stripe.data();
+        size_t len = stripe_len;
+        for (; len >= 4; ptr += 4, len -= 4) {
+            h += read32(ptr) * prime3;
+            h = rotl32(h, 17) * prime4;
+        }
+        for (; len > 0; ptr++, len--) {
+            h += static_cast<uint32_t>(*ptr) * prime5;
+            h = rotl32(h, 11) * prime1;
+        }
+        h ^= h >> 15;
+        h *= prime2;
+        h ^= h >> 13;
+        h *= prime3;
+        h ^= h >> 16;
+        return h;
+    }
+
+    /**
+     * Computes the hash of specified data
+     * 
+     * @param data input data
+     * @param len data length
+     * @param seed hash seed
+     * @return hash value
+     */
+    static uint32_t hash(const unsigned char* data, size_t len, uint32_t seed = 0) {
+        xxh32 state(seed);
+        state.update(data, len);
+        return state.digest();
+    }
+
+private:
+    static uint32_t round(uint32_t acc, uint32_t input) {
+        acc += input * prime2;
+        acc = rotl32(acc, 13);
+        return acc * prime1;
+    }
+
+    void process(const unsigned char* ptr) {
+        acc[0] = round(acc[0], read32(ptr));
+        acc[1] = round(acc[1], read32(ptr + 4));
+        acc[2] = round(acc[2], read32(ptr + 8));
+        acc[3] = round(acc[3], read32(ptr + 12));
+    }
+};
+
+/**
+ * Incremental 64-bit xxHash, used by Zstandard frame format
+ */
+class xxh64 {
+    static const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static const uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    uint64_t seed;
+    std::array<uint64_t, 4> acc;
+    std::array<unsigned char, 32> stripe;
+    size_t stripe_len = 0;
+    uint64_t total_len = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param seed hash seed
+     */
+    explicit xxh64(uint64_t seed = 0) :
+    seed(seed) {
+        reset();
+    }
+
+    /**
+     * Resets the state to hash the new data
+     */
+    void reset() {
+        acc[0] = seed + prime1 + prime2;
+        acc[1] = seed + prime2;
+        acc[2] = seed;
+        acc[3] = seed - prime1;
+        stripe_len = 0;
+        total_len = 0;
+    }
+
+    /**
+     * Hashes specified data
+     * 
+     * @param data input data
+     * @param len data length
+     */
+    void update(const unsigned char* data, size_t len) {
+        total_len += len;
+        if (stripe_len > 0) {
+            size_t fill = len < 32 - stripe_len ? len : 32 - stripe_len;
+            std::memcpy(stripe.data() + stripe_len, data, fill);
+            stripe_len += fill;
+            data += fill;
+            len -= fill;
+            if (stripe_len < 32) {
+                return;
+            }
+            process(stripe.data());
+            stripe_len = 0;
+        }
+        while (len >= 32) {
+            process(data);
+            data += 32;
+            len -= 32;
+        }
+        if (len > 0) {
+            std::memcpy(stripe.data(), data, len);
+            stripe_len = len;
+        }
+    }
+
+    /**
+     * Computes the hash of all data passed so far,
+     * state is not changed
+     * 
+     * @return hash value
+     */
+    uint64_t digest() const {
+        uint64_t h = 0;
+        if (total_len >= 32) {
+            h = rotl64(acc[0], 1) + rotl64(acc[1], 7) + rotl64(acc[2], 12) + rotl64(acc[3], 18);
+            for (size_t i = 0; i < acc.size(); i++) {
+                h ^= round(0, acc[i]);
+                h = h * prime1 + prime4;
+            }
+        } else {
+            h = seed + prime5;
+        }
+        h += total_len;
+        const unsigned char* ptr = stripe.data();
+        size_t len = stripe_len;
+        for (; len >= 8; ptr += 8, len -= 8) {
+            h ^= round(0, read64(ptr));
+            h = rotl64(h, 27) * prime1 + prime4;
+        }
+        if (len >= 4) {
+            h ^= static_cast<uint64_t>(read32(ptr)) * prime1;
+            h = rotl64(h, 23) * prime2 + prime3;
+            ptr += 4;
+            len -= 4;
+        }
+        for (; len > 0; ptr++, len--) {
+            h ^= static_cast<uint64_t>(*ptr) * prime5;
+            h = rotl64(h, 11) * prime1;
+        }
+        h ^= h >> 33;
+        h *= prime2;
+        h ^= h >> 29;
+        h *= prime3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    /**
+     * Computes the hash of specified data
+     * 
+     * @param data input data
+     * @param len data length
+     * @param seed hash seed
+     * @return hash value
+     */
+    static uint64_t hash(const unsigned char* data, size_t len, uint64_t seed = 0) {
+        xxh64 state(seed);
+        state.update(data, len);
+        return state.digest();
+    }
+
+private:
+    static uint64_t round(uint64_t acc, uint64_t input) {
+        acc += input * prime2;
+        acc = rotl64(acc, 31);
+        return acc * prime1;
+    }
+
+    void process(const unsigned char* ptr) {
+        acc[0] = round(acc[0], read64(ptr));
+        acc[1] = round(acc[1], read64(ptr + 8));
+        acc[2] = round(acc[2], read64(ptr + 16));
+        acc[3] = round(acc[3], read64(ptr + 24));
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_XXHASH_HPP */
@@ -0,0 +1,1291 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zstd_compressor.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 1:30 AM
+ */
+
+#ifndef STATICLIB_IO_ZSTD_COMPRESSOR_HPP
+#define STATICLIB_IO_ZSTD_COMPRESSOR_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/block_workers.hpp"
+#include "staticlib/io/deflater.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/xxhash.hpp"
+#include "staticlib/io/zstd_decompressor.hpp"
+#include "staticlib/io/zstd_format.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_zstd {
+
+// uncompressed size of the job for worker threads
+const size_t job_size = 1 << 21;
+
+/**
+ * Writer of the bitstream that is read backward by the decoder
+ */
+class bit_writer {
+    std::vector<char>& out;
+    uint64_t acc = 0;
+    unsigned count = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param out output buffer
+     */
+    explicit bit_writer(std::vector<char>& out) :
+    out(out) { }
+
+    /**
+     * Appends lower bits of the specified value
+     * 
+     * @param value bits value
+     * @param nbits number of bits, up to 32
+     */
+    void add(uint64_t value, unsigned nbits) {
+        acc |= (value & ((static_cast<uint64_t>(1) << nbits) - 1)) << count;
+        count += nbits;
+        if (count >= 32) {
+            char bytes[4];
+            write_le(bytes, acc, 4);
+            out.insert(out.end(), bytes, bytes + 4);
+            acc >>= 32;
+            count -= 32;
+        }
+    }
+
+    /**
+     * Appends end mark and writes out remaining bits
+     */
+    void close() {
+        add(1, 1);
+        while (count > 0) {
+            out.push_back(static_cast<char>(acc & 0xff));
+            acc >>= 8;
+            count = count > 8 ? count - 8 : 0;
+        }
+    }
+};
+
+/**
+ * FSE encoding table
+ */
+class fse_encoder {
+    struct transform {
+        int find_state;
+        uint32_t delta_nbits;
+    };
+
+    std::vector<uint16_t> states;
+    std::vector<unsigned char> spread;
+    std::array<transform, 256> symbols;
+    unsigned log = 0;
+    bool rle = false;
+
+public:
+    /**
+     * Builds the table from normalized distribution
+     * 
+     * @param norm normalized counts
+     * @param max_symbol max symbol
+     * @param table_log accuracy log
+     */
+    void build(const short* norm, unsigned max_symbol, unsigned table_log) {
+        size_t size = static_cast<size_t>(1) << table_log;
+        states.resize(size);
+        spread.resize(size);
+        std::array<uint32_t, 257> cumul;
+        cumul[0] = 0;
+        size_t high = size - 1;
+        for (unsigned s = 1; s <= max_symbol + 1; s++) {
+            if (-1 == norm[s - 1]) {
+                cumul[s] = cumul[s - 1] + 1;
+                spread[high--] = static_cast<unsigned char>(s - 1);
+            } else {
+                cumul[s] = cumul[s - 1] + static_cast<uint32_t>(norm[s - 1]);
+            }
+        }
+        size_t step = (size >> 1) + (size >> 3) + 3;
+        size_t mask = size - 1;
+        size_t pos = 0;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            for (short i = 0; i < norm[s]; i++) {
+                spread[pos] = static_cast<unsigned char>(s);
+                do {
+                    pos = (pos + step) & mask;
+                } while (pos > high);
+            }
+        }
+        for (size_t i = 0; i < size; i++) {
+            states[cumul[spread[i]]++] = static_cast<uint16_t>(size + i);
+        }
+        int total = 0;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            transform& tr = symbols[s];
+            if (0 == norm[s]) {
+                tr.find_state = 0;
+                tr.delta_nbits = static_cast<uint32_t>(((table_log + 1) << 16) - size);
+            } else if (-1 == norm[s] || 1 == norm[s]) {
+                tr.find_state = total - 1;
+                tr.delta_nbits = static_cast<uint32_t>((table_log << 16) - size);
+                total += 1;
+            } else {
+                uint32_t max_bits_out = table_log - highbit(static_cast<uint32_t>(norm[s] - 1));
+                uint32_t min_state_plus = static_cast<uint32_t>(norm[s]) << max_bits_out;
+                tr.find_state = total - norm[s];
+                tr.delta_nbits = (max_bits_out << 16) - min_state_plus;
+                total += norm[s];
+            }
+        }
+        log = table_log;
+        rle = false;
+    }
+
+    /**
+     * Builds the table for the single symbol that is encoded without bits
+     */
+    void build_rle() {
+        log = 0;
+        rle = true;
+    }
+
+    /**
+     * Returns initial state for the specified symbol
+     * 
+     * @param symbol first encoded symbol
+     * @return encoder state
+     */
+    uint32_t init(unsigned symbol) const {
+        if (rle) {
+            return 0;
+        }
+        const transform& tr = symbols[symbol];
+        uint32_t nbits = (tr.delta_nbits + (1 << 15)) >> 16;
+        uint32_t value = (nbits << 16) - tr.delta_nbits;
+        return states[static_cast<size_t>(static_cast<int>(value >> nbits) + tr.find_state)];
+    }
+
+    /**
+     * Encodes the symbol
+     * 
+     * @param bits output bitstream
+     * @param state encoder state
+     * @param symbol symbol to encode
+     */
+    void encode(bit_writer& bits, uint32_t& state, unsigned symbol) const {
+        if (rle) {
+            return;
+        }
+        const transform& tr = symbols[symbol];
+        uint32_t nbits = (state + tr.delta_nbits) >> 16;
+        bits.add(state, nbits);
+        state = states[static_cast<size_t>(static_cast<int>(state >> nbits) + tr.find_state)];
+    }
+
+    /**
+     * Writes final state
+     * 
+     * @param bits output bitstream
+     * @param state encoder state
+     */
+    void flush(bit_writer& bits, uint32_t state) const {
+        if (!rle) {
+            bits.add(state, log);
+        }
+    }
+};
+
+/**
+ * Chooses accuracy log for the distribution
+ * 
+ * @param total number of encoded symbols
+ * @param max_symbol max symbol
+ * @param max_log max allowed accuracy log
+ * @return accuracy log
+ */
+inline unsigned optimal_log(size_t total, unsigned max_symbol, unsigned max_log) {
+    unsigned log = max_log;
+    unsigned src_bits = total > 4 ? highbit(static_cast<uint32_t>(total - 1)) - 1 : 1;
+    if (src_bits < log) {
+        log = src_bits;
+    }
+    unsigned min_bits = std::min(highbit(static_cast<uint32_t>(total)) + 1, highbit(max_symbol) + 2);
+    if (log < min_bits) {
+        log = min_bits;
+    }
+    return std::max(5u, std::min(log, max_log));
+}
+
+/**
+ * Normalizes symbol counts to the sum of table size, every
+ * present symbol gets non-zero probability
+ * 
+ * @param counts symbol counts
+ * @param max_symbol max symbol
+ * @param total sum of counts
+ * @param table_log accuracy log
+ * @param norm normalized counts output
+ */
+inline void normalize(const uint32_t* counts, unsigned max_symbol, size_t total, unsigned table_log, short* norm) {
+    int size = 1 << table_log;
+    int sum = 0;
+    unsigned largest = 0;
+    for (unsigned s = 0; s <= max_symbol; s++) {
+        if (0 == counts[s]) {
+            norm[s] = 0;
+            continue;
+        }
+        uint64_t scaled = (static_cast<uint64_t>(counts[s]) * static_cast<uint64_t>(size) + total / 2) / total;
+        norm[s] = static_cast<short>(scaled > 0 ? scaled : 1);
+        sum += norm[s];
+        if (counts[s] > counts[largest]) {
+            largest = s;
+        }
+    }
+    if (sum <= size) {
+        norm[largest] = static_cast<short>(norm[largest] + size - sum);
+        return;
+    }
+    while (sum > size) {
+        unsigned idx = largest;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            if (norm[s] > norm[idx]) {
+                idx = s;
+            }
+        }
+        norm[idx] -= 1;
+        sum -= 1;
+    }
+}
+
+/**
+ * Writes normalized distribution of FSE table
+ * 
+ * @param norm normalized counts
+ * @param max_symbol max symbol
+ * @param table_log accuracy log
+ * @param out output buffer
+ */
+inline void write_ncount(const short* norm, unsigned max_symbol, unsigned table_log, std::vector<char>& out) {
+    uint32_t acc = 0;
+    unsigned count = 0;
+    auto add = [&acc, &count, &out](uint32_t value, unsigned nbits) {
+        acc |= value << count;
+        count += nbits;
+        while (count >= 8) {
+            out.push_back(static_cast<char>(acc & 0xff));
+            acc >>= 8;
+            count -= 8;
+        }
+    };
+    int size = 1 << table_log;
+    int remaining = size + 1;
+    int threshold = size;
+    unsigned nbits = table_log + 1;
+    add(table_log - 5, 4);
+    unsigned symbol = 0;
+    bool previous0 = false;
+    while (symbol <= max_symbol && remaining > 1) {
+        if (previous0) {
+            unsigned start = symbol;
+            while (0 == norm[symbol]) {
+                symbol += 1;
+            }
+            while (symbol >= start + 3) {
+                start += 3;
+                add(3, 2);
+            }
+            add(symbol - start, 2);
+        }
+        int value = norm[symbol++];
+        int max = (2 * threshold - 1) - remaining;
+        remaining -= value < 0 ? -value : value;
+        value += 1;
+        if (value >= threshold) {
+            value += max;
+        }
+        add(static_cast<uint32_t>(value), value < max ? nbits - 1 : nbits);
+        previous0 = 1 == value;
+        while (remaining < threshold) {
+            nbits -= 1;
+            threshold >>= 1;
+        }
+    }
+    if (count > 0) {
+        out.push_back(static_cast<char>(acc & 0xff));
+    }
+}
+
+/**
+ * Parameters of the compression level
+ */
+struct level_params {
+    unsigned hash_log;
+    unsigned chain_log;
+    unsigned depth;
+    bool lazy;
+    size_t target_length;
+};
+
+inline level_params get_level_params(int level) {
+    static const level_params params[] = {
+        {16, 16, 2, false, 16},
+        {16, 17, 4, false, 24},
+        {17, 17, 6, true, 32},
+        {17, 18, 12, true, 32},
+        {17, 18, 24, true, 48},
+        {17, 19, 48, true, 64},
+        {17, 19, 64, true, 96},
+        {17, 20, 96, true, 128},
+        {17, 20, 128, true, 256}
+    };
+    return params[level - 1];
+}
+
+/**
+ * Compresses data into Zstandard blocks using hash chains matcher,
+ * keeps the window of previous data between blocks, used both in
+ * the calling thread and in worker threads
+ */
+class block_context {
+    struct sequence {
+        uint32_t lit_len;
+        uint32_t match_len;
+        uint32_t offset_value;
+    };
+
+    level_params params;
+    size_t window;
+    size_t block_size;
+    size_t buf_cap;
+    std::vector<unsigned char> buf;
+    size_t done = 0;
+    size_t next_insert = 0;
+    std::vector<uint32_t> head;
+    std::vector<uint32_t> chain;
+    std::vector<uint32_t> long_head;
+    std::array<uint32_t, 3> reps;
+    std::array<uint32_t, 3> saved_reps;
+    size_t known_reps = 0;
+    std::vector<sequence> sequences;
+    std::vector<unsigned char> literals;
+    std::vector<char> body;
+    std::vector<unsigned char> ll_codes;
+    std::vector<unsigned char> ml_codes;
+    std::vector<unsigned char> of_codes;
+    fse_encoder ll_encoder;
+    fse_encoder ml_encoder;
+    fse_encoder of_encoder;
+    detail_deflate::huffman_builder huffman;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param level compression level
+     * @param window_log base two logarithm of the window size
+     * @param max_input max data size kept in memory besides the window
+     */
+    block_context(int level, unsigned window_log, size_t max_input) :
+    params(get_level_params(level)),
+    window(static_cast<size_t>(1) << window_log),
+    block_size(std::min(window, max_block)),
+    buf_cap(std::min(window, max_input) + max_input),
+    head(static_cast<size_t>(1) << params.hash_log),
+    chain(static_cast<size_t>(1) << std::min(params.chain_log, window_log)),
+    long_head(static_cast<size_t>(1) << params.hash_log) {
+        reset(nullptr);
+    }
+
+    /**
+     * Resets the context to start a new frame
+     * 
+     * @param dict dictionary or null
+     */
+    void reset(const dictionary_data* dict) {
+        buf.clear();
+        done = 0;
+        next_insert = 0;
+        std::fill(head.begin(), head.end(), 0);
+        std::fill(long_head.begin(), long_head.end(), 0);
+        reps[0] = 1;
+        reps[1] = 4;
+        reps[2] = 8;
+        known_reps = 3;
+        if (nullptr != dict) {
+            size_t len = std::min(dict->content.size(), window);
+            buf.insert(buf.end(), dict->content.end() - len, dict->content.end());
+            done = len;
+            if (dict->has_entropy) {
+                reps = dict->entropy.reps;
+            }
+        }
+    }
+
+    /**
+     * Appends data to compress
+     * 
+     * @param data input data
+     * @param len input length
+     */
+    void append(const char* data, size_t len) {
+        if (buf.size() + len > buf_cap) {
+            slide();
+        }
+        buf.insert(buf.end(), data, data + len);
+    }
+
+    /**
+     * Returns amount of appended data that is not compressed yet
+     * 
+     * @return amount of pending data
+     */
+    size_t pending() const {
+        return buf.size() - done;
+    }
+
+    /**
+     * Returns max block size
+     * 
+     * @return block size
+     */
+    size_t get_block_size() const {
+        return block_size;
+    }
+
+    /**
+     * Compresses all pending data into blocks
+     * 
+     * @param last whether the last block must be marked as the end of frame
+     * @param out output buffer
+     */
+    void compress(bool last, std::vector<char>& out) {
+        bool written = false;
+        while (done < buf.size() || (last && !written)) {
+            size_t len = std::min(block_size, buf.size() - done);
+            bool block_last = last && done + len == buf.size();
+            compress_block(len, block_last, out);
+            done += len;
+            written = true;
+        }
+    }
+
+    /**
+     * Compresses the job independently from the previous data,
+     * repeated offsets are used only after they are set in this job
+     * 
+     * @param input uncompressed data
+     * @param last whether the job is the last one in the frame
+     * @param output compressed blocks
+     */
+    void process(const std::vector<char>& input, bool last, std::vector<char>& output) {
+        reset(nullptr);
+        known_reps = 0;
+        append(input.data(), input.size());
+        compress(last, output);
+    }
+
+private:
+    void slide() {
+        size_t keep = std::min(window, done);
+        size_t shift = done - keep;
+        if (0 == shift) {
+            return;
+        }
+        std::memmove(buf.data(), buf.data() + shift, buf.size() - shift);
+        buf.resize(buf.size() - shift);
+        done -= shift;
+        next_insert = next_insert > shift ? next_insert - shift : 0;
+        uint32_t delta = static_cast<uint32_t>(shift);
+        for (uint32_t& en : head) {
+            en = en > delta ? en - delta : 0;
+        }
+        for (uint32_t& en : chain) {
+            en = en > delta ? en - delta : 0;
+        }
+        for (uint32_t& en : long_head) {
+            en = en > delta ? en - delta : 0;
+        }
+    }
+
+    void compress_block(size_t len, bool last, std::vector<char>& out) {
+        const unsigned char* data = buf.data() + done;
+        size_t header = out.size();
+        out.resize(header + 3);
+        unsigned type = block_raw;
+        size_t size = len;
+        if (len > 0 && is_rle(data, len)) {
+            type = block_rle;
+            out.push_back(static_cast<char>(data[0]));
+        } else if (len > 0) {
+            saved_reps = reps;
+            size_t saved_known = known_reps;
+            find_sequences(done, done + len);
+            body.clear();
+            encode_literals();
+            encode_sequences();
+            if (body.size() < len) {
+                type = block_compressed;
+                size = body.size();
+                out.insert(out.end(), body.begin(), body.end());
+            } else {
+                reps = saved_reps;
+                known_reps = saved_known;
+            }
+        }
+        if (block_raw == type) {
+            out.insert(out.end(), data, data + len);
+        }
+        uint32_t bh = (last ? 1 : 0) | (type << 1) | static_cast<uint32_t>(size << 3);
+        write_le(out.data() + header, bh, 3);
+    }
+
+    static bool is_rle(const unsigned char* data, size_t len) {
+        for (size_t i = 1; i < len; i++) {
+            if (data[i] != data[0]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t hash(size_t pos) const {
+        return (read32(buf.data() + pos) * 2654435761U) >> (32 - params.hash_log);
+    }
+
+    // hash of 8 bytes finds long repeats that are deep in the chains
+    uint32_t long_hash(size_t pos) const {
+        return static_cast<uint32_t>((read64(buf.data() + pos) * 0x9E3779B185EBCA87ULL) >> (64 - params.hash_log));
+    }
+
+    size_t count_equal(size_t a, size_t b, size_t end) const {
+        const unsigned char* base = buf.data();
+        size_t len = 0;
+        size_t max = end - a;
+        while (len + 8 <= max) {
+            uint64_t diff = read64(base + a + len) ^ read64(base + b + len);
+            if (0 != diff) {
+                return len + trailing_zero_bytes(diff);
+            }
+            len += 8;
+        }
+        while (len < max && base[a + len] == base[b + len]) {
+            len += 1;
+        }
+        return len;
+    }
+
+    static size_t trailing_zero_bytes(uint64_t diff) {
+        size_t res = 0;
+        while (0 == (diff & 0xff)) {
+            diff >>= 8;
+            res += 1;
+        }
+        return res;
+    }
+
+    void insert(size_t pos) {
+        size_t mask = chain.size() - 1;
+        for (; next_insert < pos; next_insert++) {
+            uint32_t& en = head[hash(next_insert)];
+            chain[next_insert & mask] = en;
+            en = static_cast<uint32_t>(next_insert);
+            long_head[long_hash(next_insert)] = static_cast<uint32_t>(next_insert);
+        }
+    }
+
+    // returns match length, zero if not found
+    size_t search(size_t ip, size_t end, size_t& offset) {
+        insert(ip);
+        size_t low = ip > window ? ip - window : 0;
+        // older chain entries are overwritten
+        size_t chain_low = ip > chain.size() ? ip - chain.size() : 0;
+        size_t mask = chain.size() - 1;
+        const unsigned char* base = buf.data();
+        size_t best = 0;
+        size_t long_cand = long_head[long_hash(ip)];
+        if (long_cand >= low && long_cand < ip && read64(base + long_cand) == read64(base + ip)) {
+            best = count_equal(ip, long_cand, end);
+            offset = ip - long_cand;
+            if (ip + best == end || best >= params.target_length) {
+                return best;
+            }
+        }
+        size_t cand = head[hash(ip)];
+        for (unsigned depth = params.depth; depth > 0 && cand >= low && cand < ip; depth--) {
+            if (base[cand + best] == base[ip + best]) {
+                size_t len = count_equal(ip, cand, end);
+                if (len > best) {
+                    best = len;
+                    offset = ip - cand;
+                    if (ip + len == end || len >= params.target_length) {
+                        break;
+                    }
+                }
+            }
+            size_t next = chain[cand & mask];
+            if (next >= cand || cand < chain_low) {
+                break;
+            }
+            cand = next;
+        }
+        return best >= 4 ? best : 0;
+    }
+
+    size_t search_rep(size_t ip, size_t anchor, size_t end) const {
+        if (0 == known_reps || ip == anchor || reps[0] > ip || reps[0] > window) {
+            return 0;
+        }
+        size_t ref = ip - reps[0];
+        if (read32(buf.data() + ref) != read32(buf.data() + ip)) {
+            return 0;
+        }
+        return count_equal(ip, ref, end);
+    }
+
+    static int gain(size_t len, size_t offset) {
+        return static_cast<int>(len * 4) - static_cast<int>(highbit(static_cast<uint32_t>(offset + 1)));
+    }
+
+    void find_sequences(size_t start, size_t end) {
+        sequences.clear();
+        literals.clear();
+        const unsigned char* base = buf.data();
+        size_t anchor = start;
+        size_t ip = start;
+        size_t limit = end - start > 8 ? end - 8 : start;
+        while (ip < limit) {
+            size_t offset = 0;
+            size_t mlen = search(ip, end, offset);
+            size_t rep_len = search_rep(ip, anchor, end);
+            bool rep = false;
+            if (rep_len >= 4 && (rep_len + 1 >= mlen)) {
+                mlen = rep_len;
+                offset = reps[0];
+                rep = true;
+            }
+            if (0 == mlen) {
+                ip += 1 + ((ip - anchor) >> 8);
+                continue;
+            }
+            if (params.lazy) {
+                while (ip + 1 < limit && mlen < params.target_length) {
+                    size_t offset2 = 0;
+                    size_t mlen2 = search(ip + 1, end, offset2);
+                    if (0 == mlen2 || gain(mlen2, offset2) <= gain(mlen, rep ? 1 : offset) + 4) {
+                        break;
+                    }
+                    ip += 1;
+                    mlen = mlen2;
+                    offset = offset2;
+                    rep = false;
+                }
+            }
+            if (!rep) {
+                while (ip > anchor && ip > offset && base[ip - 1] == base[ip - 1 - offset]) {
+                    ip -= 1;
+                    mlen += 1;
+                }
+            }
+            add_sequence(base + anchor, ip - anchor, offset, mlen, rep);
+            ip += mlen;
+            anchor = ip;
+        }
+        literals.insert(literals.end(), base + anchor, base + end);
+    }
+
+    void add_sequence(const unsigned char* lits, size_t lit_len, size_t offset, size_t mlen, bool rep) {
+        literals.insert(literals.end(), lits, lits + lit_len);
+        sequence seq;
+        seq.lit_len = static_cast<uint32_t>(lit_len);
+        seq.match_len = static_cast<uint32_t>(mlen);
+        if (rep) {
+            seq.offset_value = 1;
+        } else {
+            seq.offset_value = static_cast<uint32_t>(offset + 3);
+            reps[2] = reps[1];
+            reps[1] = reps[0];
+            reps[0] = static_cast<uint32_t>(offset);
+            if (known_reps < 3) {
+                known_reps += 1;
+            }
+        }
+        sequences.push_back(seq);
+    }
+
+    void write_literals_header(unsigned type, size_t len) {
+        char bytes[3];
+        if (len < 32) {
+            bytes[0] = static_cast<char>(type | (len << 3));
+            body.insert(body.end(), bytes, bytes + 1);
+        } else if (len < 4096) {
+            write_le(bytes, type | (1 << 2) | (len << 4), 2);
+            body.insert(body.end(), bytes, bytes + 2);
+        } else {
+            write_le(bytes, type | (3 << 2) | (len << 4), 3);
+            body.insert(body.end(), bytes, bytes + 3);
+        }
+    }
+
+    void encode_literals() {
+        size_t len = literals.size();
+        if (len > 0 && is_rle(literals.data(), len)) {
+            write_literals_header(1, len);
+            body.push_back(static_cast<char>(literals[0]));
+            return;
+        }
+        if (len >= 64) {
+            size_t start = body.size();
+            if (encode_huffman()) {
+                return;
+            }
+            body.resize(start);
+        }
+        write_literals_header(0, len);
+        body.insert(body.end(), literals.begin(), literals.end());
+    }
+
+    bool encode_huffman() {
+        size_t len = literals.size();
+        std::array<uint32_t, 256> freqs;
+        freqs.fill(0);
+        for (unsigned char ch : literals) {
+            freqs[ch] += 1;
+        }
+        unsigned max_symbol = 255;
+        while (0 == freqs[max_symbol]) {
+            max_symbol -= 1;
+        }
+        std::array<uint8_t, 256> lengths;
+        huffman.build(freqs.data(), max_symbol + 1, lengths.data(), max_huffman_bits);
+        unsigned max_bits = 0;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            max_bits = std::max(max_bits, static_cast<unsigned>(lengths[s]));
+        }
+        std::array<unsigned char, 256> weights;
+        std::array<uint32_t, 16> ranks;
+        ranks.fill(0);
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            weights[s] = static_cast<unsigned char>(lengths[s] > 0 ? max_bits + 1 - lengths[s] : 0);
+            ranks[weights[s]] += 1;
+        }
+        // codes are assigned in the order of decoding table filling
+        uint32_t next = 0;
+        for (unsigned w = 1; w <= max_bits; w++) {
+            uint32_t current = next;
+            next += ranks[w] << (w - 1);
+            ranks[w] = current;
+        }
+        std::array<uint16_t, 256> codes;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            unsigned w = weights[s];
+            if (w > 0) {
+                codes[s] = static_cast<uint16_t>(ranks[w] >> (w - 1));
+                ranks[w] += 1u << (w - 1);
+            }
+        }
+        size_t header_pos = body.size();
+        size_t streams = len < 256 ? 1 : 4;
+        size_t format = 1 == streams ? 0 : len < 1024 ? 1 : len < 16384 ? 2 : 3;
+        size_t header_len = format < 2 ? 3 : format + 2;
+        body.resize(header_pos + header_len);
+        size_t tree_pos = body.size();
+        if (max_symbol <= 128) {
+            body.push_back(static_cast<char>(127 + max_symbol));
+            for (unsigned s = 0; s < max_symbol; s += 2) {
+                unsigned low = s + 1 < max_symbol ? weights[s + 1] : 0;
+                body.push_back(static_cast<char>((weights[s] << 4) | low));
+            }
+        } else if (!encode_weights(weights.data(), max_symbol)) {
+            return false;
+        }
+        if (1 == streams) {
+            encode_stream(codes.data(), lengths.data(), 0, len);
+        } else {
+            size_t segment = (len + 3) / 4;
+            size_t jump = body.size();
+            body.resize(jump + 6);
+            for (size_t i = 0; i < 4; i++) {
+                size_t begin = i * segment;
+                size_t stream_start = body.size();
+                encode_stream(codes.data(), lengths.data(), begin, std::min(begin + segment, len));
+                if (i < 3) {
+                    write_le(body.data() + jump + 2 * i, body.size() - stream_start, 2);
+                }
+            }
+        }
+        size_t csize = body.size() - tree_pos;
+        size_t bits = format < 2 ? 10 : 2 == format ? 14 : 18;
+        if (csize >= (static_cast<size_t>(1) << bits) || csize + header_len >= len) {
+            return false;
+        }
+        uint64_t header = 2 | (format << 2) | (static_cast<uint64_t>(len) << 4) |
+                (static_cast<uint64_t>(csize) << (4 + bits));
+        write_le(body.data() + header_pos, header, header_len);
+        return true;
+    }
+
+    void encode_stream(const uint16_t* codes, const uint8_t* lengths, size_t begin, size_t end) {
+        bit_writer bits(body);
+        for (size_t i = end; i > begin; i--) {
+            unsigned char ch = literals[i - 1];
+            bits.add(codes[ch], lengths[ch]);
+        }
+        bits.close();
+    }
+
+    // weights are FSE-compressed with two interleaved states
+    bool encode_weights(const unsigned char* weights, size_t count) {
+        std::array<uint32_t, 16> counts;
+        counts.fill(0);
+        unsigned max_weight = 0;
+        for (size_t i = 0; i < count; i++) {
+            counts[weights[i]] += 1;
+            max_weight = std::max(max_weight, static_cast<unsigned>(weights[i]));
+        }
+        if (counts[weights[0]] == count) {
+            return false;
+        }
+        unsigned log = optimal_log(count, max_weight, 6);
+        std::array<short, 16> norm;
+        normalize(counts.data(), max_weight, count, log, norm.data());
+        size_t size_pos = body.size();
+        body.push_back(0);
+        write_ncount(norm.data(), max_weight, log, body);
+        fse_encoder encoder;
+        encoder.build(norm.data(), max_weight, log);
+        bit_writer bits(body);
+        size_t ip = count;
+        uint32_t state1 = 0;
+        uint32_t state2 = 0;
+        if (1 == (count & 1)) {
+            state1 = encoder.init(weights[--ip]);
+            state2 = encoder.init(weights[--ip]);
+            encoder.encode(bits, state1, weights[--ip]);
+        } else {
+            state2 = encoder.init(weights[--ip]);
+            state1 = encoder.init(weights[--ip]);
+        }
+        if (2 == (ip & 3)) {
+            encoder.encode(bits, state2, weights[--ip]);
+            encoder.encode(bits, state1, weights[--ip]);
+        }
+        while (ip > 0) {
+            encoder.encode(bits, state2, weights[--ip]);
+            encoder.encode(bits, state1, weights[--ip]);
+            encoder.encode(bits, state2, weights[--ip]);
+            encoder.encode(bits, state1, weights[--ip]);
+        }
+        encoder.flush(bits, state2);
+        encoder.flush(bits, state1);
+        bits.close();
+        size_t csize = body.size() - size_pos - 1;
+        if (csize >= 128) {
+            return false;
+        }
+        body[size_pos] = static_cast<char>(csize);
+        return true;
+    }
+
+    static unsigned ll_code(uint32_t len) {
+        if (len < 16) {
+            return len;
+        }
+        if (len > 63) {
+            return highbit(len) + 19;
+        }
+        unsigned code = 16;
+        while (ll_base[code + 1] <= len) {
+            code += 1;
+        }
+        return code;
+    }
+
+    static unsigned ml_code(uint32_t len) {
+        uint32_t base = len - 3;
+        if (base < 32) {
+            return base;
+        }
+        if (base > 127) {
+            return highbit(base) + 36;
+        }
+        unsigned code = 32;
+        while (ml_base[code + 1] <= len) {
+            code += 1;
+        }
+        return code;
+    }
+
+    unsigned select_table(fse_encoder& encoder, const std::vector<unsigned char>& codes,
+            const short* default_norm, unsigned default_max, unsigned default_log, unsigned max_log) {
+        std::array<uint32_t, 64> counts;
+        counts.fill(0);
+        unsigned max_symbol = 0;
+        for (unsigned char code : codes) {
+            counts[code] += 1;
+            max_symbol = std::max(max_symbol, static_cast<unsigned>(code));
+        }
+        if (counts[max_symbol] == codes.size()) {
+            body.push_back(static_cast<char>(max_symbol));
+            encoder.build_rle();
+            return mode_rle;
+        }
+        if (codes.size() < 64 && max_symbol <= default_max) {
+            encoder.build(default_norm, default_max, default_log);
+            return mode_predefined;
+        }
+        unsigned log = optimal_log(codes.size(), max_symbol, max_log);
+        std::array<short, 64> norm;
+        normalize(counts.data(), max_symbol, codes.size(), log, norm.data());
+        write_ncount(norm.data(), max_symbol, log, body);
+        encoder.build(norm.data(), max_symbol, log);
+        return mode_compressed;
+    }
+
+    void encode_sequences() {
+        size_t nseq = sequences.size();
+        char bytes[3];
+        if (nseq < 128) {
+            body.push_back(static_cast<char>(nseq));
+        } else if (nseq < 0x7f00) {
+            bytes[0] = static_cast<char>((nseq >> 8) + 128);
+            bytes[1] = static_cast<char>(nseq & 0xff);
+            body.insert(body.end(), bytes, bytes + 2);
+        } else {
+            bytes[0] = static_cast<char>(255);
+            write_le(bytes + 1, nseq - 0x7f00, 2);
+            body.insert(body.end(), bytes, bytes + 3);
+        }
+        if (0 == nseq) {
+            return;
+        }
+        ll_codes.resize(nseq);
+        ml_codes.resize(nseq);
+        of_codes.resize(nseq);
+        for (size_t i = 0; i < nseq; i++) {
+            const sequence& seq = sequences[i];
+            ll_codes[i] = static_cast<unsigned char>(ll_code(seq.lit_len));
+            ml_codes[i] = static_cast<unsigned char>(ml_code(seq.match_len));
+            of_codes[i] = static_cast<unsigned char>(highbit(seq.offset_value));
+        }
+        size_t modes_pos = body.size();
+        body.push_back(0);
+        unsigned ll_mode = select_table(ll_encoder, ll_codes, ll_default_norm, max_ll_symbol,
+                ll_default_log, max_ll_log);
+        unsigned of_mode = select_table(of_encoder, of_codes, of_default_norm, of_default_max,
+                of_default_log, max_of_log);
+        unsigned ml_mode = select_table(ml_encoder, ml_codes, ml_default_norm, max_ml_symbol,
+                ml_default_log, max_ml_log);
+        body[modes_pos] = static_cast<char>((ll_mode << 6) | (of_mode << 4) | (ml_mode << 2));
+        bit_writer bits(body);
+        size_t last = nseq - 1;
+        uint32_t ml_state = ml_encoder.init(ml_codes[last]);
+        uint32_t of_state = of_encoder.init(of_codes[last]);
+        uint32_t ll_state = ll_encoder.init(ll_codes[last]);
+        add_extra_bits(bits, last);
+        for (size_t i = last; i > 0; i--) {
+            size_t idx = i - 1;
+            of_encoder.encode(bits, of_state, of_codes[idx]);
+            ml_encoder.encode(bits, ml_state, ml_codes[idx]);
+            ll_encoder.encode(bits, ll_state, ll_codes[idx]);
+            add_extra_bits(bits, idx);
+        }
+        ml_encoder.flush(bits, ml_state);
+        of_encoder.flush(bits, of_state);
+        ll_encoder.flush(bits, ll_state);
+        bits.close();
+    }
+
+    void add_extra_bits(bit_writer& bits, size_t idx) {
+        const sequence& seq = sequences[idx];
+        unsigned llc = ll_codes[idx];
+        unsigned mlc = ml_codes[idx];
+        unsigned ofc = of_codes[idx];
+        bits.add(seq.lit_len - ll_base[llc], ll_bits[llc]);
+        bits.add(seq.match_len - ml_base[mlc], ml_bits[mlc]);
+        bits.add(seq.offset_value - (static_cast<uint32_t>(1) << ofc), ofc);
+    }
+};
+
+/**
+ * Streaming Zstandard frame compressor, input is compressed either in the
+ * calling thread keeping the window between blocks, or in worker threads
+ * in independent jobs (the first job of the frame is compressed in the
+ * calling thread with the dictionary)
+ */
+class compressor {
+    zstd_options options;
+    dictionary_data dict;
+    block_context context;
+    std::unique_ptr<detail_block_workers::ordered_workers<block_context>> workers;
+    std::vector<char> out;
+    detail_xxhash::xxh64 content_hash;
+    uint64_t total_in = 0;
+    bool header_written = false;
+    bool finished = false;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param opts compression options
+     * @throws io_exception on invalid options
+     */
+    explicit compressor(zstd_options opts) :
+    options(check_options(std::move(opts))),
+    dict(options.dictionary),
+    context(options.level, static_cast<unsigned>(options.window_log),
+            options.workers > 0 ? job_size : std::max(static_cast<size_t>(1) << options.window_log, 2 * max_block)) {
+        if (options.workers > 0) {
+            std::vector<block_context> contexts;
+            unsigned job_log = std::min(static_cast<unsigned>(options.window_log), 21u);
+            for (size_t i = 0; i < options.workers; i++) {
+                contexts.emplace_back(options.level, job_log, job_size);
+            }
+            workers.reset(new detail_block_workers::ordered_workers<block_context>(
+                    std::move(contexts), options.workers * 2));
+            workers->next_input().clear();
+        }
+        context.reset(std::addressof(dict));
+    }
+
+    /**
+     * Resets the compressor to start a new frame, allocated buffers are kept
+     */
+    void reset() {
+        if (workers.get()) {
+            workers->drain([](span<const char>) {});
+            workers->next_input().clear();
+        }
+        context.reset(std::addressof(dict));
+        out.clear();
+        content_hash.reset();
+        total_in = 0;
+        header_written = false;
+        finished = false;
+    }
+
+    /**
+     * Compresses specified data, complete blocks are written to the sink
+     * 
+     * @param sink destination sink
+     * @param data input data
+     */
+    template<typename Sink>
+    void write(Sink& sink, span<const char> data) {
+        if (finished) throw io_exception(TRACEMSG("Invalid write after the end of compressed frame"));
+        write_header(sink);
+        if (options.checksum) {
+            content_hash.update(reinterpret_cast<const unsigned char*>(data.data()), data.size());
+        }
+        size_t idx = 0;
+        while (idx < data.size()) {
+            size_t avail = data.size() - idx;
+            if (!in_jobs()) {
+                size_t len = std::min(avail, context.get_block_size() - context.pending());
+                if (workers.get()) {
+                    len = std::min(len, static_cast<size_t>(job_size - total_in));
+                }
+                context.append(data.data() + idx, len);
+                idx += len;
+                total_in += len;
+                if (context.pending() == context.get_block_size() || in_jobs()) {
+                    context.compress(false, out);
+                    write_out(sink);
+                }
+            } else {
+                std::vector<char>& job = workers->next_input();
+                size_t len = std::min(avail, job_size - job.size());
+                job.insert(job.end(), data.data() + idx, data.data() + idx + len);
+                idx += len;
+                total_in += len;
+                if (job.size() == job_size) {
+                    submit_job(sink, false);
+                }
+            }
+        }
+    }
+
+    /**
+     * Compresses pending data into a (possibly short) block
+     * and writes all compressed blocks to the sink
+     * 
+     * @param sink destination sink
+     */
+    template<typename Sink>
+    void flush(Sink& sink) {
+        if (finished) {
+            return;
+        }
+        write_header(sink);
+        if (in_jobs()) {
+            submit_job(sink, false);
+            workers->drain([&sink](span<const char> blocks) {
+                write_all(sink, blocks);
+            });
+        } else {
+            context.compress(false, out);
+            write_out(sink);
+        }
+    }
+
+    /**
+     * Compresses pending data and writes the last block and checksum of the frame
+     * 
+     * @param sink destination sink
+     * @throws io_exception if the amount of data written does not match the content size
+     */
+    template<typename Sink>
+    void finish(Sink& sink) {
+        if (finished) {
+            return;
+        }
+        write_header(sink);
+        finished = true;
+        if (in_jobs()) {
+            bool submitted = submit_job(sink, true);
+            workers->drain([&sink](span<const char> blocks) {
+                write_all(sink, blocks);
+            });
+            if (!submitted) {
+                // empty last block
+                out.resize(3);
+                write_le(out.data(), 1, 3);
+            }
+        } else {
+            context.compress(true, out);
+        }
+        if (options.content_size >= 0 && static_cast<uint64_t>(options.content_size) != total_in) {
+            throw io_exception(TRACEMSG("Invalid amount of data compressed," +
+                    " expected: [" + sl::support::to_string(options.content_size) + "]," +
+                    " actual: [" + sl::support::to_string(total_in) + "]"));
+        }
+        if (options.checksum) {
+            size_t idx = out.size();
+            out.resize(idx + 4);
+            write_le(out.data() + idx, content_hash.digest() & 0xffffffff, 4);
+        }
+        write_out(sink);
+    }
+
+private:
+    static zstd_options check_options(zstd_options options) {
+        if (options.level < 1 || options.level > 9) throw io_exception(TRACEMSG(
+                "Invalid Zstandard compression level specified, level: [" + sl::support::to_string(options.level) + "]"));
+        if (options.window_log < static_cast<int>(min_window_log) || options.window_log > static_cast<int>(max_window_log)) {
+            throw io_exception(TRACEMSG("Invalid Zstandard window size specified," +
+                    " window_log: [" + sl::support::to_string(options.window_log) + "]"));
+        }
+        return options;
+    }
+
+    bool in_jobs() const {
+        return workers.get() && total_in >= job_size;
+    }
+
+    template<typename Sink>
+    bool submit_job(Sink& sink, bool last) {
+        if (workers->next_input().empty()) {
+            return false;
+        }
+        workers->submit(last, [&sink](span<const char> blocks) {
+            write_all(sink, blocks);
+        });
+        workers->next_input().clear();
+        return true;
+    }
+
+    template<typename Sink>
+    void write_header(Sink& sink) {
+        if (header_written) {
+            return;
+        }
+        header_written = true;
+        out.resize(4);
+        write_le(out.data(), frame_magic, 4);
+        size_t fhd_pos = out.size();
+        out.push_back(0);
+        uint64_t window = static_cast<uint64_t>(1) << options.window_log;
+        uint64_t size = static_cast<uint64_t>(options.content_size);
+        bool single_segment = options.content_size >= 0 && size <= window;
+        unsigned fcs_flag = 0;
+        if (options.content_size >= 0) {
+            // window is larger than 256 bytes, so such frames are single segment
+            if (size < 256) {
+                fcs_flag = 0;
+            } else if (size < 65536 + 256) {
+                fcs_flag = 1;
+            } else if (size <= 0xffffffff) {
+                fcs_flag = 2;
+            } else {
+                fcs_flag = 3;
+            }
+        }
+        unsigned dict_flag = 0 == dict.id ? 0 : dict.id < 256 ? 1 : dict.id < 65536 ? 2 : 3;
+        unsigned fhd = (fcs_flag << 6) | (single_segment ? 0x20 : 0) | (options.checksum ? 0x04 : 0) | dict_flag;
+        out[fhd_pos] = static_cast<char>(fhd);
+        if (!single_segment) {
+            out.push_back(static_cast<char>((options.window_log - min_window_log) << 3));
+        }
+        static const size_t did_sizes[] = {0, 1, 2, 4};
+        size_t idx = out.size();
+        out.resize(idx + did_sizes[dict_flag]);
+        write_le(out.data() + idx, dict.id, did_sizes[dict_flag]);
+        if (options.content_size >= 0) {
+            static const size_t fcs_sizes[] = {1, 2, 4, 8};
+            size_t len = fcs_sizes[fcs_flag];
+            idx = out.size();
+            out.resize(idx + len);
+            write_le(out.data() + idx, 1 == fcs_flag ? size - 256 : size, len);
+        }
+        write_out(sink);
+    }
+
+    template<typename Sink>
+    void write_out(Sink& sink) {
+        if (!out.empty()) {
+            write_all(sink, span<const char>(out.data(), out.size()));
+            out.clear();
+        }
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ZSTD_COMPRESSOR_HPP */
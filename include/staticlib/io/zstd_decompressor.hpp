@@ -0,0 +1,1058 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zstd_decompressor.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 12:45 AM
+ */
+
+#ifndef STATICLIB_IO_ZSTD_DECOMPRESSOR_HPP
+#define STATICLIB_IO_ZSTD_DECOMPRESSOR_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <ios>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "staticlib/config.hpp"
+#include "staticlib/support.hpp"
+
+#include "staticlib/io/frame_input.hpp"
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/span.hpp"
+#include "staticlib/io/xxhash.hpp"
+#include "staticlib/io/zstd_format.hpp"
+
+namespace staticlib {
+namespace io {
+
+namespace detail_zstd {
+
+/**
+ * Reader of the bitstream that is written forward and read backward,
+ * starting from the highest set bit of the last byte
+ */
+class backward_bits {
+    const unsigned char* start;
+    size_t ptr;
+    uint64_t container = 0;
+    unsigned consumed = 0;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param data bitstream data
+     * @param len bitstream length
+     * @throws io_exception on invalid bitstream
+     */
+    backward_bits(const unsigned char* data, size_t len) :
+    start(data) {
+        if (0 == len || 0 == data[len - 1]) throw io_exception(TRACEMSG("Invalid Zstandard bitstream"));
+        if (len >= 8) {
+            ptr = len - 8;
+            container = read64(data + ptr);
+        } else {
+            ptr = 0;
+            for (size_t i = 0; i < len; i++) {
+                container |= static_cast<uint64_t>(data[i]) << (8 * i);
+            }
+            consumed = static_cast<unsigned>(8 - len) * 8;
+        }
+        consumed += 8 - highbit(data[len - 1]);
+    }
+
+    /**
+     * Returns next bits without consuming them,
+     * result is undefined if stream is overflown
+     * 
+     * @param count number of bits, up to 57 after reload
+     * @return bits value
+     */
+    uint64_t peek(unsigned count) const {
+        return ((container << (consumed & 63)) >> 1) >> (63 - count);
+    }
+
+    /**
+     * Consumes specified number of bits
+     * 
+     * @param count number of bits
+     */
+    void skip(unsigned count) {
+        consumed += count;
+    }
+
+    /**
+     * Reads specified number of bits
+     * 
+     * @param count number of bits
+     * @return bits value
+     */
+    uint64_t read(unsigned count) {
+        uint64_t res = peek(count);
+        consumed += count;
+        return res;
+    }
+
+    /**
+     * Loads next bytes from the stream
+     * 
+     * @return false if more bits were consumed than the stream has
+     */
+    bool reload() {
+        if (consumed > 64) {
+            return false;
+        }
+        if (ptr >= 8) {
+            ptr -= consumed >> 3;
+            consumed &= 7;
+        } else if (ptr > 0) {
+            size_t bytes = consumed >> 3;
+            if (bytes > ptr) {
+                bytes = ptr;
+            }
+            ptr -= bytes;
+            consumed -= static_cast<unsigned>(bytes) * 8;
+        } else {
+            return true;
+        }
+        container = read64(start + ptr);
+        return true;
+    }
+
+    /**
+     * Number of bits that can be read without reload
+     * 
+     * @return number of bits
+     */
+    unsigned available() const {
+        return consumed < 64 ? 64 - consumed : 0;
+    }
+
+    /**
+     * Checks whether all bits of the stream were consumed exactly
+     * 
+     * @return true if stream is consumed
+     */
+    bool is_finished() const {
+        return 0 == ptr && 64 == consumed;
+    }
+};
+
+/**
+ * Reads normalized distribution of FSE table
+ * 
+ * @param src input data
+ * @param len input length
+ * @param norm normalized counts, at least "max_symbol + 1" elements
+ * @param max_symbol max allowed symbol on input, max present symbol on output
+ * @param max_log max allowed accuracy log
+ * @param log accuracy log output
+ * @return number of bytes read
+ */
+inline size_t read_ncount(const unsigned char* src, size_t len, short* norm, unsigned& max_symbol,
+        unsigned max_log, unsigned& log) {
+    size_t bit_pos = 0;
+    auto peek = [src, len, &bit_pos](unsigned count) -> uint32_t {
+        uint32_t res = 0;
+        for (size_t i = 0; i < 3; i++) {
+            size_t idx = (bit_pos >> 3) + i;
+            if (idx < len) {
+                res |= static_cast<uint32_t>(src[idx]) << (8 * i);
+            }
+        }
+        return (res >> (bit_pos & 7)) & ((1u << count) - 1);
+    };
+    log = peek(4) + 5;
+    bit_pos += 4;
+    if (log > max_log) throw io_exception(TRACEMSG("Invalid FSE table accuracy log: [" +
+            sl::support::to_string(log) + "]"));
+    int remaining = (1 << log) + 1;
+    int threshold = 1 << log;
+    unsigned nbits = log + 1;
+    unsigned symbol = 0;
+    bool previous0 = false;
+    while (remaining > 1 && symbol <= max_symbol) {
+        if (previous0) {
+            uint32_t repeat = 3;
+            while (3 == repeat) {
+                repeat = peek(2);
+                bit_pos += 2;
+                if (symbol + repeat > max_symbol + 1) throw io_exception(TRACEMSG(
+                        "Invalid FSE table description"));
+                for (uint32_t i = 0; i < repeat; i++) {
+                    norm[symbol++] = 0;
+                }
+            }
+            if (symbol > max_symbol) throw io_exception(TRACEMSG("Invalid FSE table description"));
+        }
+        int max = (2 * threshold - 1) - remaining;
+        int count = static_cast<int>(peek(nbits));
+        if ((count & (threshold - 1)) < max) {
+            count &= threshold - 1;
+            bit_pos += nbits - 1;
+        } else {
+            count &= 2 * threshold - 1;
+            if (count >= threshold) {
+                count -= max;
+            }
+            bit_pos += nbits;
+        }
+        count -= 1;
+        remaining -= count < 0 ? -count : count;
+        norm[symbol++] = static_cast<short>(count);
+        previous0 = 0 == count;
+        if (remaining < 1) {
+            break;
+        }
+        while (remaining < threshold) {
+            nbits -= 1;
+            threshold >>= 1;
+        }
+    }
+    if (1 != remaining || bit_pos > len * 8) throw io_exception(TRACEMSG("Invalid FSE table description"));
+    max_symbol = symbol - 1;
+    return (bit_pos + 7) >> 3;
+}
+
+/**
+ * FSE decoding table
+ */
+class fse_table {
+public:
+    /**
+     * Decoding table entry
+     */
+    struct entry {
+        uint16_t base;
+        unsigned char symbol;
+        unsigned char nbits;
+    };
+
+private:
+    std::vector<entry> entries;
+    unsigned log = 0;
+    bool valid = false;
+
+public:
+    /**
+     * Builds the table from normalized distribution
+     * 
+     * @param norm normalized counts
+     * @param max_symbol max symbol
+     * @param table_log accuracy log
+     */
+    void build(const short* norm, unsigned max_symbol, unsigned table_log) {
+        size_t size = static_cast<size_t>(1) << table_log;
+        entries.resize(size);
+        std::array<uint16_t, 256> next;
+        size_t high = size - 1;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            if (-1 == norm[s]) {
+                entries[high--].symbol = static_cast<unsigned char>(s);
+                next[s] = 1;
+            } else {
+                next[s] = static_cast<uint16_t>(norm[s]);
+            }
+        }
+        size_t step = (size >> 1) + (size >> 3) + 3;
+        size_t mask = size - 1;
+        size_t pos = 0;
+        for (unsigned s = 0; s <= max_symbol; s++) {
+            for (short i = 0; i < norm[s]; i++) {
+                entries[pos].symbol = static_cast<unsigned char>(s);
+                do {
+                    pos = (pos + step) & mask;
+                } while (pos > high);
+            }
+        }
+        if (0 != pos) throw io_exception(TRACEMSG("Invalid FSE table description"));
+        for (size_t i = 0; i < size; i++) {
+            entry& en = entries[i];
+            uint32_t state = next[en.symbol]++;
+            en.nbits = static_cast<unsigned char>(table_log - highbit(state));
+            en.base = static_cast<uint16_t>((state << en.nbits) - size);
+        }
+        log = table_log;
+        valid = true;
+    }
+
+    /**
+     * Builds the table that always returns a single symbol
+     * 
+     * @param symbol symbol value
+     */
+    void build_rle(unsigned char symbol) {
+        entries.resize(1);
+        entries[0].base = 0;
+        entries[0].symbol = symbol;
+        entries[0].nbits = 0;
+        log = 0;
+        valid = true;
+    }
+
+    /**
+     * Reads table description and builds the table
+     * 
+     * @param src input data
+     * @param len input length
+     * @param max_symbol max allowed symbol
+     * @param max_log max allowed accuracy log
+     * @return number of bytes read
+     */
+    size_t read(const unsigned char* src, size_t len, unsigned max_symbol, unsigned max_log) {
+        std::array<short, 256> norm;
+        unsigned table_log = 0;
+        size_t res = read_ncount(src, len, norm.data(), max_symbol, max_log, table_log);
+        build(norm.data(), max_symbol, table_log);
+        return res;
+    }
+
+    /**
+     * Marks table as not available
+     */
+    void invalidate() {
+        valid = false;
+    }
+
+    bool is_valid() const {
+        return valid;
+    }
+
+    unsigned get_log() const {
+        return log;
+    }
+
+    const entry& get(size_t state) const {
+        return entries[state];
+    }
+};
+
+/**
+ * Huffman decoding table for literals
+ */
+class huffman_table {
+    struct entry {
+        unsigned char symbol;
+        unsigned char nbits;
+    };
+
+    std::vector<entry> entries;
+    unsigned log = 0;
+    bool valid = false;
+
+public:
+    /**
+     * Reads Huffman tree description and builds the table
+     * 
+     * @param src input data
+     * @param len input length
+     * @return number of bytes read
+     */
+    size_t read(const unsigned char* src, size_t len) {
+        if (0 == len) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+        std::array<unsigned char, 256> weights;
+        size_t count = 0;
+        size_t used = 0;
+        unsigned header = src[0];
+        if (header >= 128) {
+            count = header - 127;
+            used = 1 + (count + 1) / 2;
+            if (used > len) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+            for (size_t i = 0; i < count; i++) {
+                unsigned char byte = src[1 + i / 2];
+                weights[i] = 0 == i % 2 ? byte >> 4 : byte & 0xf;
+            }
+        } else {
+            used = 1 + header;
+            if (used > len) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+            count = read_fse_weights(src + 1, header, weights.data());
+        }
+        build(weights.data(), count);
+        return used;
+    }
+
+    /**
+     * Marks table as not available
+     */
+    void invalidate() {
+        valid = false;
+    }
+
+    /**
+     * Decodes single stream of literals
+     * 
+     * @param src stream data
+     * @param len stream length
+     * @param out output buffer
+     * @param count number of literals to decode
+     */
+    void decode(const unsigned char* src, size_t len, unsigned char* out, size_t count) const {
+        backward_bits bits(src, len);
+        const entry* table = entries.data();
+        size_t i = 0;
+        while (count - i >= 4 && bits.reload() && bits.available() >= 4 * log) {
+            for (size_t j = 0; j < 4; j++) {
+                const entry& en = table[bits.peek(log)];
+                out[i + j] = en.symbol;
+                bits.skip(en.nbits);
+            }
+            i += 4;
+        }
+        for (; i < count; i++) {
+            bits.reload();
+            const entry& en = table[bits.peek(log)];
+            out[i] = en.symbol;
+            bits.skip(en.nbits);
+        }
+        bits.reload();
+        if (!bits.is_finished()) throw io_exception(TRACEMSG("Invalid Huffman-coded literals stream"));
+    }
+
+    bool is_valid() const {
+        return valid;
+    }
+
+private:
+    static size_t read_fse_weights(const unsigned char* src, size_t len, unsigned char* weights) {
+        fse_table table;
+        size_t header = table.read(src, len, 255, 6);
+        if (header >= len) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+        backward_bits bits(src + header, len - header);
+        unsigned log = table.get_log();
+        size_t state1 = bits.read(log);
+        size_t state2 = bits.read(log);
+        size_t count = 0;
+        for (;;) {
+            if (count > 253) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+            const fse_table::entry& en1 = table.get(state1);
+            weights[count++] = en1.symbol;
+            state1 = en1.base + bits.read(en1.nbits);
+            if (!bits.reload()) {
+                weights[count++] = table.get(state2).symbol;
+                break;
+            }
+            const fse_table::entry& en2 = table.get(state2);
+            weights[count++] = en2.symbol;
+            state2 = en2.base + bits.read(en2.nbits);
+            if (!bits.reload()) {
+                weights[count++] = table.get(state1).symbol;
+                break;
+            }
+        }
+        return count;
+    }
+
+    void build(unsigned char* weights, size_t count) {
+        std::array<uint32_t, 16> ranks;
+        ranks.fill(0);
+        uint32_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (weights[i] > max_huffman_bits) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+            ranks[weights[i]] += 1;
+            total += (1u << weights[i]) >> 1;
+        }
+        if (0 == total) throw io_exception(TRACEMSG("Invalid Huffman tree description"));
+        unsigned max_bits = highbit(total) + 1;
+        uint32_t rest = (1u << max_bits) - total;
+        if (max_bits > max_huffman_bits || 0 != (rest & (rest - 1))) throw io_exception(TRACEMSG(
+                "Invalid Huffman tree description"));
+        weights[count] = static_cast<unsigned char>(highbit(rest) + 1);
+        ranks[weights[count]] += 1;
+        count += 1;
+        uint32_t next = 0;
+        for (unsigned w = 1; w <= max_bits; w++) {
+            uint32_t current = next;
+            next += ranks[w] << (w - 1);
+            ranks[w] = current;
+        }
+        entries.resize(static_cast<size_t>(1) << max_bits);
+        for (size_t sym = 0; sym < count; sym++) {
+            unsigned w = weights[sym];
+            if (0 == w) {
+                continue;
+            }
+            uint32_t len = (1u << w) >> 1;
+            entry en;
+            en.symbol = static_cast<unsigned char>(sym);
+            en.nbits = static_cast<unsigned char>(max_bits + 1 - w);
+            for (uint32_t i = ranks[w]; i < ranks[w] + len; i++) {
+                entries[i] = en;
+            }
+            ranks[w] += len;
+        }
+        log = max_bits;
+        valid = true;
+    }
+};
+
+/**
+ * Entropy state that is carried between blocks of the frame
+ */
+struct entropy_state {
+    huffman_table literals;
+    fse_table ll;
+    fse_table of;
+    fse_table ml;
+    std::array<uint32_t, 3> reps;
+
+    entropy_state() {
+        reset();
+    }
+
+    void reset() {
+        literals.invalidate();
+        ll.invalidate();
+        of.invalidate();
+        ml.invalidate();
+        reps[0] = 1;
+        reps[1] = 4;
+        reps[2] = 8;
+    }
+};
+
+/**
+ * Dictionary, either raw content or in Zstandard format with entropy tables
+ */
+struct dictionary_data {
+    uint32_t id = 0;
+    std::string content;
+    bool has_entropy = false;
+    entropy_state entropy;
+
+    /**
+     * Constructor
+     * 
+     * @param dict dictionary data
+     */
+    explicit dictionary_data(const std::string& dict) {
+        const unsigned char* src = reinterpret_cast<const unsigned char*>(dict.data());
+        if (dict.size() < 8 || dictionary_magic != read32(src)) {
+            content = dict;
+            return;
+        }
+        id = read32(src + 4);
+        size_t pos = 8;
+        size_t len = dict.size();
+        pos += entropy.literals.read(src + pos, len - pos);
+        pos += entropy.of.read(src + pos, len - pos, max_of_symbol, max_of_log);
+        pos += entropy.ml.read(src + pos, len - pos, max_ml_symbol, max_ml_log);
+        pos += entropy.ll.read(src + pos, len - pos, max_ll_symbol, max_ll_log);
+        if (len - pos < 12) throw io_exception(TRACEMSG("Invalid Zstandard dictionary"));
+        content = dict.substr(pos + 12);
+        for (size_t i = 0; i < 3; i++) {
+            uint32_t rep = read32(src + pos + 4 * i);
+            if (0 == rep || rep > content.size()) throw io_exception(TRACEMSG("Invalid Zstandard dictionary"));
+            entropy.reps[i] = rep;
+        }
+        has_entropy = true;
+    }
+};
+
+/**
+ * Streaming Zstandard frame decompressor, supports all the block and entropy
+ * coding types, dictionaries, skippable frames and concatenated frames
+ */
+class decompressor {
+    // allows copying matches in 16 byte chunks
+    static const size_t slack = 32;
+
+    dictionary_data dict;
+    entropy_state entropy;
+    detail_frame::input_buffer input;
+    std::vector<char> hist;
+    std::vector<unsigned char> block;
+    std::vector<unsigned char> literals;
+    size_t out_pos = 0;
+    size_t out_end = 0;
+    size_t window = 0;
+    size_t hist_cap = 0;
+    size_t block_max = 0;
+    bool in_frame = false;
+    bool last_block = false;
+    bool checksum = false;
+    bool finished = false;
+    size_t frames_count = 0;
+    std::streamsize content_size = -1;
+    uint64_t frame_out = 0;
+    detail_xxhash::xxh64 content_hash;
+
+public:
+    /**
+     * Constructor
+     * 
+     * @param dictionary dictionary that was used for compression
+     * @throws io_exception on invalid dictionary
+     */
+    explicit decompressor(const std::string& dictionary) :
+    dict(dictionary),
+    input(1 << 17) { }
+
+    /**
+     * Resets the decompressor, allocated buffers are kept
+     * 
+     * @param keep_input whether to keep data that was read from the source
+     *        but was not decompressed yet
+     */
+    void reset(bool keep_input) {
+        if (!keep_input) {
+            input.clear();
+        }
+        out_pos = 0;
+        out_end = 0;
+        in_frame = false;
+        finished = false;
+        frames_count = 0;
+        content_size = -1;
+    }
+
+    /**
+     * Reads decompressed data, single block is decompressed at a time
+     * 
+     * @param src source of compressed data
+     * @param span buffer span
+     * @return number of bytes read or "eof" at the end of compressed data
+     * @throws io_exception on invalid or truncated compressed data
+     */
+    template<typename Source>
+    std::streamsize read(Source& src, span<char> span) {
+        while (out_pos == out_end && !finished && span.size() > 0) {
+            decompress_next(src);
+        }
+        size_t avail = out_end - out_pos;
+        size_t len = span.size() <= avail ? span.size() : avail;
+        if (len > 0) {
+            std::memcpy(span.data(), hist.data() + out_pos, len);
+            out_pos += len;
+            return static_cast<std::streamsize>(len);
+        }
+        if (finished) {
+            return std::char_traits<char>::eof();
+        }
+        return 0;
+    }
+
+    /**
+     * Returns uncompressed size stored in the header of the current frame
+     * 
+     * @return uncompressed size, -1 if it is unknown
+     */
+    std::streamsize get_content_size() const {
+        return content_size;
+    }
+
+private:
+    template<typename Source>
+    void decompress_next(Source& src) {
+        if (!in_frame) {
+            if (!input.has_more(src)) {
+                if (0 == frames_count) throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+                finished = true;
+                return;
+            }
+            read_header(src);
+            return;
+        }
+        if (last_block) {
+            finish_frame(src);
+            return;
+        }
+        uint32_t header = static_cast<uint32_t>(input.read_le(src, 3));
+        last_block = 0 != (header & 1);
+        unsigned type = (header >> 1) & 3;
+        size_t size = header >> 3;
+        prepare_history();
+        switch (type) {
+        case block_raw:
+            check_block_size(size);
+            input.read_exact(src, hist.data() + out_end, size);
+            out_end += size;
+            break;
+        case block_rle: {
+            check_block_size(size);
+            char byte = static_cast<char>(input.read_le(src, 1));
+            std::memset(hist.data() + out_end, byte, size);
+            out_end += size;
+            break;
+        }
+        case block_compressed:
+            if (size > block_max) throw io_exception(TRACEMSG("Invalid Zstandard block size: [" +
+                    sl::support::to_string(size) + "]"));
+            block.resize(size);
+            input.read_exact(src, reinterpret_cast<char*>(block.data()), size);
+            decode_block();
+            break;
+        default:
+            throw io_exception(TRACEMSG("Invalid Zstandard block type"));
+        }
+        if (checksum) {
+            content_hash.update(reinterpret_cast<const unsigned char*>(hist.data() + out_pos), out_end - out_pos);
+        }
+        frame_out += out_end - out_pos;
+    }
+
+    template<typename Source>
+    void read_header(Source& src) {
+        for (;;) {
+            uint32_t magic = static_cast<uint32_t>(input.read_le(src, 4));
+            if (skippable_magic == (magic & skippable_mask)) {
+                input.skip(src, static_cast<size_t>(input.read_le(src, 4)));
+                if (!input.has_more(src)) {
+                    finished = 0 != frames_count;
+                    if (!finished) throw io_exception(TRACEMSG("Unexpected end of compressed data"));
+                    return;
+                }
+                continue;
+            }
+            if (frame_magic != magic) throw io_exception(TRACEMSG(
+                    "Invalid Zstandard frame magic number: [" + sl::support::to_string(magic) + "]"));
+            break;
+        }
+        unsigned fhd = static_cast<unsigned>(input.read_le(src, 1));
+        if (0 != (fhd & 0x08)) throw io_exception(TRACEMSG("Invalid Zstandard frame header descriptor: [" +
+                sl::support::to_string(fhd) + "]"));
+        unsigned fcs_flag = fhd >> 6;
+        bool single_segment = 0 != (fhd & 0x20);
+        checksum = 0 != (fhd & 0x04);
+        uint64_t window_size = 0;
+        if (!single_segment) {
+            unsigned wd = static_cast<unsigned>(input.read_le(src, 1));
+            unsigned window_log = 10 + (wd >> 3);
+            if (window_log > max_window_log) throw io_exception(TRACEMSG(
+                    "Zstandard window size is too large, log: [" + sl::support::to_string(window_log) + "]"));
+            uint64_t base = static_cast<uint64_t>(1) << window_log;
+            window_size = base + (base / 8) * (wd & 7);
+        }
+        static const size_t did_sizes[] = {0, 1, 2, 4};
+        uint32_t dict_id = static_cast<uint32_t>(input.read_le(src, did_sizes[fhd & 3]));
+        static const size_t fcs_sizes[] = {0, 2, 4, 8};
+        size_t fcs_len = 0 == fcs_flag && single_segment ? 1 : fcs_sizes[fcs_flag];
+        content_size = -1;
+        if (fcs_len > 0) {
+            uint64_t fcs = input.read_le(src, fcs_len);
+            if (2 == fcs_len) {
+                fcs += 256;
+            }
+            if (fcs > static_cast<uint64_t>(std::numeric_limits<std::streamsize>::max())) throw io_exception(TRACEMSG(
+                    "Invalid Zstandard frame content size: [" + sl::support::to_string(fcs) + "]"));
+            content_size = static_cast<std::streamsize>(fcs);
+            if (single_segment) {
+                if (fcs > (static_cast<uint64_t>(1) << max_window_log)) throw io_exception(TRACEMSG(
+                        "Zstandard window size is too large, size: [" + sl::support::to_string(fcs) + "]"));
+                window_size = fcs;
+            }
+        }
+        if (0 != dict_id && dict_id != dict.id) throw io_exception(TRACEMSG(
+                "Zstandard frame requires a dictionary, ID: [" + sl::support::to_string(dict_id) + "]"));
+        window = static_cast<size_t>(window_size);
+        block_max = window < max_block ? window : max_block;
+        size_t cap = window + dict.content.size() + 2 * block_max;
+        if (hist_cap < cap) {
+            hist_cap = cap;
+        }
+        if (hist.size() < dict.content.size() + slack) {
+            hist.resize(dict.content.size() + slack);
+        }
+        std::memcpy(hist.data(), dict.content.data(), dict.content.size());
+        out_pos = dict.content.size();
+        out_end = dict.content.size();
+        if (dict.has_entropy) {
+            entropy = dict.entropy;
+        } else {
+            entropy.reset();
+        }
+        frame_out = 0;
+        content_hash.reset();
+        last_block = false;
+        in_frame = true;
+    }
+
+    template<typename Source>
+    void finish_frame(Source& src) {
+        if (checksum) {
+            uint32_t expected = static_cast<uint32_t>(input.read_le(src, 4));
+            if ((content_hash.digest() & 0xffffffff) != expected) throw io_exception(TRACEMSG(
+                    "Invalid content checksum of Zstandard frame"));
+        }
+        if (content_size >= 0 && static_cast<uint64_t>(content_size) != frame_out) throw io_exception(TRACEMSG(
+                "Invalid uncompressed size of Zstandard frame, expected: [" + sl::support::to_string(content_size) + "]," +
+                " actual: [" + sl::support::to_string(frame_out) + "]"));
+        in_frame = false;
+        frames_count += 1;
+    }
+
+    void check_block_size(size_t size) {
+        if (size > block_max) throw io_exception(TRACEMSG("Invalid Zstandard block size: [" +
+                sl::support::to_string(size) + "]"));
+    }
+
+    // all output is consumed at this point, only the window is kept
+    void prepare_history() {
+        size_t needed = out_end + block_max + slack;
+        if (needed > hist.size()) {
+            if (out_end + block_max > hist_cap) {
+                size_t keep = window < out_end ? window : out_end;
+                std::memmove(hist.data(), hist.data() + out_end - keep, keep);
+                out_end = keep;
+                needed = out_end + block_max + slack;
+            }
+            if (needed > hist.size()) {
+                size_t grown = hist.size() * 2;
+                hist.resize(grown > needed ? (grown < hist_cap + slack ? grown : hist_cap + slack) : needed);
+            }
+        }
+        out_pos = out_end;
+    }
+
+    void decode_block() {
+        const unsigned char* src = block.data();
+        size_t len = block.size();
+        const unsigned char* lits = nullptr;
+        size_t lits_len = 0;
+        size_t pos = decode_literals(src, len, lits, lits_len);
+        if (pos >= len) throw io_exception(TRACEMSG("Invalid Zstandard compressed block"));
+        size_t nseq = src[pos++];
+        if (nseq >= 128) {
+            if (pos >= len) throw io_exception(TRACEMSG("Invalid Zstandard compressed block"));
+            if (255 == nseq) {
+                if (len - pos < 2) throw io_exception(TRACEMSG("Invalid Zstandard compressed block"));
+                nseq = src[pos] + (static_cast<size_t>(src[pos + 1]) << 8) + 0x7f00;
+                pos += 2;
+            } else {
+                nseq = ((nseq - 128) << 8) + src[pos++];
+            }
+        }
+        size_t op = out_end;
+        size_t limit = out_end + block_max;
+        if (nseq > 0) {
+            if (pos >= len) throw io_exception(TRACEMSG("Invalid Zstandard compressed block"));
+            unsigned modes = src[pos++];
+            if (0 != (modes & 3)) throw io_exception(TRACEMSG("Invalid Zstandard sequences header"));
+            pos += read_table(entropy.ll, modes >> 6, src + pos, len - pos,
+                    ll_default_norm, max_ll_symbol, ll_default_log, max_ll_symbol, max_ll_log);
+            pos += read_table(entropy.of, (modes >> 4) & 3, src + pos, len - pos,
+                    of_default_norm, of_default_max, of_default_log, max_of_symbol, max_of_log);
+            pos += read_table(entropy.ml, (modes >> 2) & 3, src + pos, len - pos,
+                    ml_default_norm, max_ml_symbol, ml_default_log, max_ml_symbol, max_ml_log);
+            op = execute_sequences(src + pos, len - pos, nseq, lits, lits_len, op, limit);
+        } else if (pos != len) {
+            throw io_exception(TRACEMSG("Invalid Zstandard compressed block"));
+        }
+        if (lits_len > limit - op) throw io_exception(TRACEMSG("Invalid Zstandard compressed block"));
+        if (lits_len > 0) {
+            std::memcpy(hist.data() + op, lits, lits_len);
+        }
+        out_end = op + lits_len;
+    }
+
+    size_t decode_literals(const unsigned char* src, size_t len, const unsigned char*& lits, size_t& lits_len) {
+        unsigned type = src[0] & 3;
+        unsigned format = (src[0] >> 2) & 3;
+        size_t pos = 0;
+        size_t regen = 0;
+        if (type < 2) {
+            if (1 == format) {
+                if (len < 2) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+                regen = (src[0] >> 4) + (static_cast<size_t>(src[1]) << 4);
+                pos = 2;
+            } else if (3 == format) {
+                if (len < 3) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+                regen = (src[0] >> 4) + (static_cast<size_t>(src[1]) << 4) + (static_cast<size_t>(src[2]) << 12);
+                pos = 3;
+            } else {
+                regen = src[0] >> 3;
+                pos = 1;
+            }
+            if (regen > block_max) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+            if (0 == type) {
+                if (regen > len - pos) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+                lits = src + pos;
+                lits_len = regen;
+                return pos + regen;
+            }
+            if (pos >= len) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+            literals.resize(regen);
+            std::memset(literals.data(), src[pos], regen);
+            lits = literals.data();
+            lits_len = regen;
+            return pos + 1;
+        }
+        size_t header_len = format < 2 ? 3 : format + 2;
+        if (len < header_len) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+        uint64_t header = 0;
+        for (size_t i = 0; i < header_len; i++) {
+            header |= static_cast<uint64_t>(src[i]) << (8 * i);
+        }
+        size_t bits = 0 == format || 1 == format ? 10 : 2 == format ? 14 : 18;
+        regen = static_cast<size_t>((header >> 4) & ((1u << bits) - 1));
+        size_t csize = static_cast<size_t>((header >> (4 + bits)) & ((1u << bits) - 1));
+        if (regen > block_max || csize > len - header_len) throw io_exception(TRACEMSG(
+                "Invalid Zstandard literals section"));
+        const unsigned char* data = src + header_len;
+        size_t streams_len = csize;
+        if (2 == type) {
+            size_t tree = entropy.literals.read(data, csize);
+            data += tree;
+            streams_len -= tree;
+        } else if (!entropy.literals.is_valid()) {
+            throw io_exception(TRACEMSG("Invalid Zstandard literals section, no previous Huffman table"));
+        }
+        literals.resize(regen);
+        if (0 == format) {
+            entropy.literals.decode(data, streams_len, literals.data(), regen);
+        } else {
+            if (streams_len < 6) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+            size_t sizes[4];
+            sizes[0] = data[0] | (static_cast<size_t>(data[1]) << 8);
+            sizes[1] = data[2] | (static_cast<size_t>(data[3]) << 8);
+            sizes[2] = data[4] | (static_cast<size_t>(data[5]) << 8);
+            size_t total = sizes[0] + sizes[1] + sizes[2];
+            if (total > streams_len - 6) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+            sizes[3] = streams_len - 6 - total;
+            size_t segment = (regen + 3) / 4;
+            if (3 * segment > regen) throw io_exception(TRACEMSG("Invalid Zstandard literals section"));
+            const unsigned char* stream = data + 6;
+            for (size_t i = 0; i < 4; i++) {
+                size_t count = i < 3 ? segment : regen - 3 * segment;
+                entropy.literals.decode(stream, sizes[i], literals.data() + i * segment, count);
+                stream += sizes[i];
+            }
+        }
+        lits = literals.data();
+        lits_len = regen;
+        return header_len + csize;
+    }
+
+    static size_t read_table(fse_table& table, unsigned mode, const unsigned char* src, size_t len,
+            const short* default_norm, unsigned default_max, unsigned default_log,
+            unsigned max_symbol, unsigned max_log) {
+        switch (mode) {
+        case mode_predefined:
+            table.build(default_norm, default_max, default_log);
+            return 0;
+        case mode_rle:
+            if (0 == len || src[0] > max_symbol) throw io_exception(TRACEMSG(
+                    "Invalid Zstandard sequences header"));
+            table.build_rle(src[0]);
+            return 1;
+        case mode_compressed:
+            return table.read(src, len, max_symbol, max_log);
+        default:
+            if (!table.is_valid()) throw io_exception(TRACEMSG(
+                    "Invalid Zstandard sequences header, no previous table"));
+            return 0;
+        }
+    }
+
+    size_t execute_sequences(const unsigned char* src, size_t len, size_t nseq,
+            const unsigned char*& lits, size_t& lits_len, size_t op, size_t limit) {
+        backward_bits bits(src, len);
+        const fse_table& ll = entropy.ll;
+        const fse_table& of = entropy.of;
+        const fse_table& ml = entropy.ml;
+        size_t ll_state = bits.read(ll.get_log());
+        size_t of_state = bits.read(of.get_log());
+        size_t ml_state = bits.read(ml.get_log());
+        std::array<uint32_t, 3>& reps = entropy.reps;
+        char* out = hist.data();
+        for (size_t i = 0; i < nseq; i++) {
+            bits.reload();
+            const fse_table::entry& lle = ll.get(ll_state);
+            const fse_table::entry& ofe = of.get(of_state);
+            const fse_table::entry& mle = ml.get(ml_state);
+            uint64_t offset_value = (static_cast<uint64_t>(1) << ofe.symbol) + bits.read(ofe.symbol);
+            if (bits.available() < 32) {
+                bits.reload();
+            }
+            size_t mlen = ml_base[mle.symbol] + static_cast<size_t>(bits.read(ml_bits[mle.symbol]));
+            size_t llen = ll_base[lle.symbol] + static_cast<size_t>(bits.read(ll_bits[lle.symbol]));
+            if (bits.available() < 26) {
+                bits.reload();
+            }
+            if (i + 1 < nseq) {
+                ll_state = lle.base + static_cast<size_t>(bits.read(lle.nbits));
+                ml_state = mle.base + static_cast<size_t>(bits.read(mle.nbits));
+                of_state = ofe.base + static_cast<size_t>(bits.read(ofe.nbits));
+            }
+            uint64_t offset = 0;
+            if (offset_value > 3) {
+                offset = offset_value - 3;
+                reps[2] = reps[1];
+                reps[1] = reps[0];
+                reps[0] = static_cast<uint32_t>(offset);
+            } else {
+                size_t idx = static_cast<size_t>(offset_value) - 1 + (0 == llen ? 1 : 0);
+                if (0 == idx) {
+                    offset = reps[0];
+                } else {
+                    offset = 3 == idx ? reps[0] - 1 : reps[idx];
+                    if (1 != idx) {
+                        reps[2] = reps[1];
+                    }
+                    reps[1] = reps[0];
+                    reps[0] = static_cast<uint32_t>(offset);
+                }
+            }
+            if (llen > lits_len || llen > limit - op) throw io_exception(TRACEMSG(
+                    "Invalid Zstandard sequence, literals length: [" + sl::support::to_string(llen) + "]"));
+            if (llen <= 16 && lits_len >= 16) {
+                std::memcpy(out + op, lits, 16);
+            } else if (llen > 0) {
+                std::memcpy(out + op, lits, llen);
+            }
+            lits += llen;
+            lits_len -= llen;
+            op += llen;
+            if (0 == offset || offset > op || mlen > limit - op) throw io_exception(TRACEMSG(
+                    "Invalid Zstandard sequence, offset: [" + sl::support::to_string(offset) + "]," +
+                    " match length: [" + sl::support::to_string(mlen) + "]"));
+            copy_match(out + op, static_cast<size_t>(offset), mlen);
+            op += mlen;
+        }
+        bits.reload();
+        if (!bits.is_finished()) throw io_exception(TRACEMSG("Invalid Zstandard sequences bitstream"));
+        return op;
+    }
+
+    static void copy_match(char* dest, size_t offset, size_t mlen) {
+        const char* from = dest - offset;
+        if (offset >= 16) {
+            for (size_t i = 0; i < mlen; i += 16) {
+                std::memcpy(dest + i, from + i, 16);
+            }
+        } else if (offset >= 8) {
+            for (size_t i = 0; i < mlen; i += 8) {
+                std::memcpy(dest + i, from + i, 8);
+            }
+        } else {
+            for (size_t i = 0; i < mlen; i++) {
+                dest[i] = from[i];
+            }
+        }
+    }
+};
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ZSTD_DECOMPRESSOR_HPP */
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zstd_format.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 12:20 AM
+ */
+
+#ifndef STATICLIB_IO_ZSTD_FORMAT_HPP
+#define STATICLIB_IO_ZSTD_FORMAT_HPP
+
+#include <cstdint>
+#include <ios>
+#include <string>
+
+#include "staticlib/config.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Options of Zstandard frame compression
+ */
+struct zstd_options {
+    /**
+     * Compression level from 1 (fastest) to 9 (best compression)
+     */
+    int level = 3;
+    /**
+     * Base two logarithm of the window size, from 10 to 27
+     */
+    int window_log = 20;
+    /**
+     * Whether to append checksum of uncompressed data to the frame
+     */
+    bool checksum = true;
+    /**
+     * Uncompressed data size to store in the frame header, negative if unknown;
+     * "size_hint" operation can be used to get it from the input source
+     */
+    std::streamsize content_size = -1;
+    /**
+     * Raw content dictionary or the dictionary in Zstandard format,
+     * must be the same for decompression
+     */
+    std::string dictionary;
+    /**
+     * Number of threads that compress blocks concurrently,
+     * zero to compress blocks in the calling thread
+     */
+    size_t workers = 0;
+};
+
+namespace detail_zstd {
+
+const uint32_t frame_magic = 0xFD2FB528;
+const uint32_t skippable_magic = 0x184D2A50;
+const uint32_t skippable_mask = 0xFFFFFFF0;
+const uint32_t dictionary_magic = 0xEC30A437;
+const size_t max_block = 1 << 17;
+const size_t min_window_log = 10;
+const size_t max_window_log = 27;
+
+const unsigned max_ll_symbol = 35;
+const unsigned max_ml_symbol = 52;
+const unsigned max_of_symbol = 31;
+const unsigned max_ll_log = 9;
+const unsigned max_ml_log = 9;
+const unsigned max_of_log = 8;
+const unsigned max_huffman_bits = 11;
+
+const unsigned block_raw = 0;
+const unsigned block_rle = 1;
+const unsigned block_compressed = 2;
+
+const unsigned mode_predefined = 0;
+const unsigned mode_rle = 1;
+const unsigned mode_compressed = 2;
+const unsigned mode_repeat = 3;
+
+const uint32_t ll_base[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 18, 20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096,
+    8192, 16384, 32768, 65536
+};
+
+const unsigned char ll_bits[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16
+};
+
+const uint32_t ml_base[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051,
+    4099, 8195, 16387, 32771, 65539
+};
+
+const unsigned char ml_bits[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16
+};
+
+// predefined distributions of sequence codes
+
+const unsigned ll_default_log = 6;
+const short ll_default_norm[] = {
+    4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+    -1, -1, -1, -1
+};
+
+const unsigned ml_default_log = 6;
+const short ml_default_norm[] = {
+    1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1,
+    -1, -1, -1, -1, -1
+};
+
+const unsigned of_default_log = 5;
+const unsigned of_default_max = 28;
+const short of_default_norm[] = {
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1
+};
+
+inline unsigned highbit(uint32_t value) {
+    unsigned res = 0;
+    while (value >>= 1) {
+        res += 1;
+    }
+    return res;
+}
+
+inline uint32_t read32(const unsigned char* ptr) {
+    return static_cast<uint32_t>(ptr[0]) | (static_cast<uint32_t>(ptr[1]) << 8) |
+            (static_cast<uint32_t>(ptr[2]) << 16) | (static_cast<uint32_t>(ptr[3]) << 24);
+}
+
+inline uint64_t read64(const unsigned char* ptr) {
+    return static_cast<uint64_t>(read32(ptr)) | (static_cast<uint64_t>(read32(ptr + 4)) << 32);
+}
+
+inline void write_le(char* ptr, uint64_t value, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        ptr[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+}
+
+} // namespace
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ZSTD_FORMAT_HPP */
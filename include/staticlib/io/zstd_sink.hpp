@@ -0,0 +1,227 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zstd_sink.hpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 1:50 AM
+ */
+
+#ifndef STATICLIB_IO_ZSTD_SINK_HPP
+#define STATICLIB_IO_ZSTD_SINK_HPP
+
+#include <ios>
+#include <type_traits>
+#include <utility>
+
+#include "staticlib/config.hpp"
+
+#include "staticlib/io/zstd_compressor.hpp"
+#include "staticlib/io/zstd_format.hpp"
+#include "staticlib/io/reference_sink.hpp"
+#include "staticlib/io/span.hpp"
+
+namespace staticlib {
+namespace io {
+
+/**
+ * Sink wrapper that compresses data into Zstandard frame format,
+ * with "workers" option set the input is split into independent jobs
+ * that are compressed concurrently by worker threads, compressed frame
+ * is completed on "finish" call or on destruction
+ */
+template<typename Sink>
+class zstd_sink {
+    /**
+     * Destination sink
+     */
+    Sink sink;
+    /**
+     * Compressor
+     */
+    detail_zstd::compressor compressor;
+    /**
+     * Whether compressed frame is completed
+     */
+    bool finished = false;
+
+public:
+    /**
+     * Constructor,
+     * created sink wrapper will own specified sink
+     * 
+     * @param sink destination sink
+     * @param options compression options
+     * @throws io_exception on invalid options
+     */
+    explicit zstd_sink(Sink&& sink, zstd_options options = zstd_options()) :
+    sink(std::move(sink)),
+    compressor(std::move(options)) { }
+
+    /**
+     * Destructor, completes compressed frame
+     */
+    ~zstd_sink() STATICLIB_NOEXCEPT {
+        try {
+            finish();
+        } catch(...) {
+            // ignore
+        }
+    }
+
+    /**
+     * Deleted copy constructor
+     * 
+     * @param other instance
+     */
+    zstd_sink(const zstd_sink&) = delete;
+
+    /**
+     * Deleted copy assignment operator
+     * 
+     * @param other instance
+     * @return this instance 
+     */
+    zstd_sink& operator=(const zstd_sink&) = delete;
+
+    /**
+     * Move constructor
+     * 
+     * @param other other instance
+     */
+    zstd_sink(zstd_sink&& other) STATICLIB_NOEXCEPT :
+    sink(std::move(other.sink)),
+    compressor(std::move(other.compressor)),
+    finished(other.finished) {
+        other.finished = true;
+    }
+
+    /**
+     * Move assignment operator
+     * 
+     * @param other other instance
+     * @return this instance
+     */
+    zstd_sink& operator=(zstd_sink&& other) STATICLIB_NOEXCEPT {
+        sink = std::move(other.sink);
+        compressor = std::move(other.compressor);
+        finished = other.finished;
+        other.finished = true;
+        return *this;
+    }
+
+    /**
+     * Compressing write implementation, compressed blocks
+     * are written to the destination sink when they are complete
+     * 
+     * @param span buffer span
+     * @return number of bytes processed
+     */
+    std::streamsize write(span<const char> span) {
+        compressor.write(sink, span);
+        return span.size_signed();
+    }
+
+    /**
+     * Compresses all pending data into a (possibly short) block,
+     * so everything written so far can be decompressed on the
+     * receiving side, and flushes destination sink
+     * 
+     * @return number of bytes flushed
+     */
+    std::streamsize flush() {
+        compressor.flush(sink);
+        return sink.flush();
+    }
+
+    /**
+     * Completes compressed frame and flushes destination sink,
+     * no-op if frame is already completed
+     * 
+     * @throws io_exception if the amount of data written does not match the content size
+     */
+    void finish() {
+        if (finished) {
+            return;
+        }
+        finished = true;
+        compressor.finish(sink);
+        sink.flush();
+    }
+
+    /**
+     * Resets this sink to start the next compressed frame
+     * into the same destination sink, allocated buffers are reused
+     */
+    void reset() {
+        compressor.reset();
+        finished = false;
+    }
+
+    /**
+     * Resets this sink to start the compressed frame
+     * into the specified destination sink, allocated buffers are reused
+     * 
+     * @param dest new destination sink
+     */
+    void reset(Sink&& dest) {
+        sink = std::move(dest);
+        reset();
+    }
+
+    /**
+     * Underlying sink accessor
+     * 
+     * @return underlying sink reference
+     */
+    Sink& get_sink() {
+        return sink;
+    }
+
+};
+
+/**
+ * Factory function for creating Zstandard sinks,
+ * created sink wrapper will own specified sink
+ * 
+ * @param sink destination sink
+ * @param options compression options
+ * @return Zstandard sink
+ */
+template <typename Sink,
+        class = typename std::enable_if<!std::is_lvalue_reference<Sink>::value>::type>
+zstd_sink<Sink> make_zstd_sink(Sink&& sink, zstd_options options = zstd_options()) {
+    return zstd_sink<Sink>(std::move(sink), std::move(options));
+}
+
+/**
+ * Factory function for creating Zstandard sinks,
+ * created sink wrapper will NOT own specified sink
+ * 
+ * @param sink destination sink
+ * @param options compression options
+ * @return Zstandard sink
+ */
+template <typename Sink>
+zstd_sink<reference_sink<Sink>> make_zstd_sink(Sink& sink, zstd_options options = zstd_options()) {
+    return zstd_sink<reference_sink<Sink>>(make_reference_sink(sink), std::move(options));
+}
+
+} // namespace
+}
+
+#endif /* STATICLIB_IO_ZSTD_SINK_HPP */
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   any_sink_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#include "staticlib/io/any_sink.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/buffered_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+#include "test_utils.hpp"
+
+void test_inline() {
+    auto sink = sl::io::make_any_sink(sl::io::string_sink());
+    slassert(sink.is_inline());
+    sl::io::write_all(sink, {"foo", 3});
+    slassert(0 == sink.flush());
+    slassert("foo" == sink.target<sl::io::string_sink>()->get_string());
+    slassert(nullptr == sink.target<two_bytes_at_once_sink>());
+}
+
+void test_heap() {
+    auto dest = sl::io::string_sink();
+    auto sink = sl::io::make_any_sink(sl::io::make_buffered_sink(dest));
+    slassert(!sink.is_inline());
+    sl::io::write_all(sink, {"bar", 3});
+    slassert(0 == dest.get_string().length());
+    auto moved = std::move(sink);
+    slassert(sink.is_empty());
+    slassert(throws_exc([&sink] { sink.write({"a", 1}); }));
+    slassert(3 == moved.flush());
+    slassert("bar" == dest.get_string());
+}
+
+void test_unique() {
+    auto uq = sl::io::make_unique_sink(new sl::io::string_sink());
+    auto ptr = std::addressof(uq.get_sink());
+    auto sink = sl::io::any_sink(std::move(uq));
+    slassert(ptr == sink.target<sl::io::string_sink>());
+    sl::io::write_all(sink, {"42", 2});
+    slassert("42" == ptr->get_string());
+}
+
+int main() {
+    try {
+        test_inline();
+        test_heap();
+        test_unique();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
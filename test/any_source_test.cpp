@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   any_source_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#include "staticlib/io/any_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/buffered_source.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/shared_source.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "two_bytes_at_once_source.hpp"
+#include "test_utils.hpp"
+
+void test_inline() {
+    auto src = sl::io::make_any_source(sl::io::string_source("foo"));
+    slassert(src.is_inline());
+    slassert(nullptr != src.target<sl::io::string_source>());
+    slassert(nullptr == src.target<two_bytes_at_once_source>());
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("foo" == sink.get_string());
+
+    // move constructor may throw
+    auto throwing = sl::io::make_any_source(two_bytes_at_once_source("foo"));
+    slassert(!throwing.is_inline());
+}
+
+void test_heap() {
+    // 4096 bytes buffer does not fit inline
+    auto src = sl::io::make_any_source(sl::io::make_buffered_source(sl::io::string_source("bar")));
+    slassert(!src.is_inline());
+    auto moved = std::move(src);
+    slassert(src.is_empty());
+    slassert(throws_exc([&src] { std::array<char, 1> buf; src.read(buf); }));
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(moved, sink);
+    slassert("bar" == sink.get_string());
+}
+
+void test_lvalue() {
+    auto str = sl::io::string_source("baz");
+    auto src = sl::io::make_any_source(str);
+    std::array<char, 2> buf;
+    slassert(2 == src.read(buf));
+    slassert(2 == str.tell());
+}
+
+void test_unique() {
+    auto uq = sl::io::make_unique_source(new sl::io::string_source("42"));
+    auto ptr = std::addressof(uq.get_source());
+    auto src = sl::io::any_source(std::move(uq));
+    // adopted without moving
+    slassert(ptr == src.target<sl::io::string_source>());
+    slassert(!src.is_inline());
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("42" == sink.get_string());
+}
+
+void test_shared() {
+    auto sh = sl::io::make_shared_source(std::make_shared<sl::io::string_source>("43"));
+    auto src = sl::io::make_any_source(std::move(sh));
+    slassert(src.is_inline());
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("43" == sink.get_string());
+}
+
+void test_runtime_choice() {
+    auto vec = std::vector<sl::io::any_source>();
+    vec.emplace_back(sl::io::string_source("foo"));
+    vec.emplace_back(two_bytes_at_once_source("bar"));
+    vec.emplace_back(sl::io::make_buffered_source(sl::io::string_source("baz")));
+    auto sink = sl::io::string_sink();
+    for (auto& src : vec) {
+        sl::io::copy_all(src, sink);
+    }
+    slassert("foobarbaz" == sink.get_string());
+}
+
+int main() {
+    try {
+        test_inline();
+        test_heap();
+        test_lvalue();
+        test_unique();
+        test_shared();
+        test_runtime_choice();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
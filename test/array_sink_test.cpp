@@ -25,6 +25,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
@@ -40,9 +41,28 @@ void test_sink() {
     std::free(span.data());
 }
 
+void test_prepare() {
+    auto sink = sl::io::make_array_sink();
+    sink.write("foo");
+    auto dest = sink.prepare(2048);
+    slassert(dest.size() >= 2048);
+    dest.data()[0] = '4';
+    dest.data()[1] = '2';
+    sink.commit(2);
+    slassert("foo42" == std::string(sink.data(), sink.size()));
+    bool thrown = false;
+    try {
+        sink.commit(dest.size());
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
 int main() {
     try {
         test_sink();
+        test_prepare();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -25,6 +25,7 @@
 
 #include <array>
 #include <iostream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
@@ -42,9 +43,63 @@ void test_read() {
     slassert(throws_exc([&src] { src.read({nullptr, -1}); }))
 }
 
+void test_read_at() {
+    std::array<char, 3> arr = {{'b', 'a', 'r'}};
+    sl::io::array_source src(arr.data(), arr.size());
+    slassert(3 == src.size());
+    std::array<char, 2> out;
+    slassert(2 == src.read_at(1, out));
+    slassert('a' == out[0]);
+    slassert('r' == out[1]);
+    slassert(1 == src.read_at(2, out));
+    slassert(std::char_traits<char>::eof() == src.read_at(3, out));
+    // position is not changed
+    slassert(2 == src.read(out));
+    slassert('b' == out[0]);
+}
+
+void test_seek() {
+    std::array<char, 3> arr = {{'b', 'a', 'r'}};
+    sl::io::array_source src(arr.data(), arr.size());
+    std::array<char, 1> out;
+    slassert(2 == src.seek(2));
+    slassert(1 == src.read(out));
+    slassert('r' == out[0]);
+    slassert(3 == src.tell());
+    slassert(1 == src.seek(-2, std::ios_base::cur));
+    slassert(1 == src.read(out));
+    slassert('a' == out[0]);
+    slassert(0 == src.seek(-3, std::ios_base::end));
+    slassert(3 == src.seek(0, std::ios_base::end));
+    slassert(std::char_traits<char>::eof() == src.read(out));
+    slassert(throws_exc([&src] { src.seek(4); }));
+    slassert(throws_exc([&src] { src.seek(-1); }));
+    slassert(throws_exc([&src] { src.seek(1, std::ios_base::end); }));
+    slassert(sl::io::has_seek<sl::io::array_source>::value);
+}
+
+void test_string_view() {
+    std::string str = "bar";
+    sl::io::array_source src(str);
+    slassert(str.data() == src.get_array());
+    slassert(3 == src.size());
+    std::array<char, 1> out;
+    slassert(1 == src.read(out));
+    slassert('b' == out[0]);
+    auto chunk = src.next_chunk();
+    slassert(2 == chunk.size());
+    slassert(str.data() + 1 == chunk.data());
+    slassert(0 == src.next_chunk().size());
+    slassert(std::char_traits<char>::eof() == src.read(out));
+    slassert(sl::io::has_next_chunk<sl::io::array_source>::value);
+}
+
 int main() {
     try {
         test_read();
+        test_read_at();
+        test_seek();
+        test_string_view();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
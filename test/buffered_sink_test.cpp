@@ -62,6 +62,23 @@ void test_overwrite() {
     slassert("foo42" == sink.get_sink().get_data());
 }
 
+void test_prepare() {
+    sl::io::buffered_sink<two_bytes_at_once_sink, 4> sink{two_bytes_at_once_sink{}};
+    sink.write({"foo", 3});
+    auto dest = sink.prepare(1);
+    slassert(1 == dest.size());
+    dest = sink.prepare(2);
+    slassert(4 == dest.size());
+    slassert("foo" == sink.get_sink().get_data());
+    dest.data()[0] = '4';
+    dest.data()[1] = '2';
+    sink.commit(2);
+    slassert(throws_exc([&sink] { sink.commit(3); }));
+    slassert(throws_exc([&sink] { sink.prepare(5); }));
+    sink.flush();
+    slassert("foo42" == sink.get_sink().get_data());
+}
+
 void test_make_rvalue() {
     auto sink = sl::io::make_buffered_sink(two_bytes_at_once_sink{});
     (void) sink;
@@ -90,6 +107,7 @@ int main() {
         test_buffer_size();
         test_flush();
         test_overwrite();
+        test_prepare();
         test_make_rvalue();
         test_make_lvalue();
         test_throw();
@@ -55,6 +55,21 @@ void test_overread() {
     slassert("foo42" == dest);
 }
 
+void test_borrow_read() {
+    sl::io::buffered_source<two_bytes_at_once_source, 3> src{two_bytes_at_once_source{"foo42"}};
+    auto chunk = src.borrow_read(2);
+    slassert("fo" == std::string(chunk.data(), chunk.size()));
+    chunk = src.borrow_read(2);
+    slassert("o" == std::string(chunk.data(), chunk.size()));
+    std::array<char, 1> buf;
+    slassert(1 == src.read(buf));
+    slassert('4' == buf[0]);
+    chunk = src.borrow_read(4);
+    slassert("2" == std::string(chunk.data(), chunk.size()));
+    slassert(0 == src.borrow_read(4).size());
+    slassert(sl::io::has_borrow_read<decltype(src)>::value);
+}
+
 void test_make_rvalue() {
     auto src = sl::io::make_buffered_source(two_bytes_at_once_source{"foo42"});
     (void) src;
@@ -100,6 +115,7 @@ int main() {
     try {
         test_buffered();
         test_overread();
+        test_borrow_read();
         test_make_rvalue();
         test_make_lvalue();
         test_throw();
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   buffered_streambuf_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 4:10 PM
+ */
+
+#include "staticlib/io/buffered_streambuf.hpp"
+
+#include <array>
+#include <iostream>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/buffered_sink.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+void test_getline() {
+    auto sb = sl::io::make_buffered_istreambuf(two_bytes_at_once_source{"foo\nbar\n\nbaz"}, 4);
+    std::istream stream{std::addressof(sb)};
+    std::string line;
+    slassert(std::getline(stream, line));
+    slassert("foo" == line);
+    slassert(std::getline(stream, line));
+    slassert("bar" == line);
+    slassert(std::getline(stream, line));
+    slassert(line.empty());
+    slassert(std::getline(stream, line));
+    slassert("baz" == line);
+    slassert(!std::getline(stream, line));
+}
+
+void test_borrow() {
+    std::string data = "1 2 3";
+    auto sb = sl::io::make_buffered_istreambuf(sl::io::array_source(data), 2);
+    std::istream stream{std::addressof(sb)};
+    int a = 0, b = 0, c = 0;
+    stream >> a >> b >> c;
+    slassert(1 == a);
+    slassert(2 == b);
+    slassert(3 == c);
+    slassert(stream.eof());
+}
+
+void test_in_avail() {
+    auto sb = sl::io::make_buffered_istreambuf(sl::io::string_source("abc"));
+    slassert(0 == sb.in_avail());
+    slassert('a' == sb.sbumpc());
+    slassert(2 == sb.in_avail());
+    slassert('b' == sb.sgetc());
+    std::array<char, 8> buf;
+    slassert(2 == sb.sgetn(buf.data(), buf.size()));
+    slassert(-1 == sb.in_avail());
+    slassert(std::char_traits<char>::eof() == sb.sgetc());
+}
+
+void test_large_read() {
+    std::string data(10000, 'a');
+    data[9999] = 'b';
+    auto sb = sl::io::make_buffered_istreambuf(sl::io::string_source(data), 16);
+    std::string res(10000, '\0');
+    slassert(1 == sb.sgetn(std::addressof(res.front()), 1));
+    slassert(9999 == sb.sgetn(std::addressof(res.front()) + 1, 9999));
+    slassert(data == res);
+}
+
+void test_move() {
+    auto sb = sl::io::make_buffered_istreambuf(sl::io::string_source("abcdef"), 4);
+    slassert('a' == sb.sbumpc());
+    auto moved = std::move(sb);
+    std::array<char, 8> buf;
+    slassert(5 == moved.sgetn(buf.data(), buf.size()));
+    slassert("bcdef" == std::string(buf.data(), 5));
+    slassert(std::char_traits<char>::eof() == sb.sgetc());
+}
+
+void test_move_borrowed() {
+    // short string is stored inside the source object
+    auto sb = sl::io::make_buffered_istreambuf(sl::io::string_source(std::string("short")));
+    slassert('s' == sb.sgetc());
+    auto moved = std::move(sb);
+    std::array<char, 8> buf;
+    slassert(5 == moved.sgetn(buf.data(), buf.size()));
+    slassert("short" == std::string(buf.data(), 5));
+    slassert(std::char_traits<char>::eof() == moved.sgetc());
+}
+
+void test_ostream() {
+    auto sink = two_bytes_at_once_sink();
+    {
+        auto sb = sl::io::make_buffered_ostreambuf(sink, 8);
+        std::ostream stream{std::addressof(sb)};
+        stream << "foo" << 42 << '\n';
+        slassert(sink.get_data().empty());
+        stream << std::string(10, 'x');
+        slassert("foo42\nxxxxxxxxxx" == sink.get_data());
+        stream.flush();
+        slassert("foo42\nxxxxxxxxxx" == sink.get_data());
+        stream << "bar";
+    }
+    slassert("foo42\nxxxxxxxxxxbar" == sink.get_data());
+}
+
+void test_ostream_lending() {
+    auto sink = sl::io::string_sink();
+    auto sb = sl::io::make_buffered_ostreambuf(sink);
+    std::ostream stream{std::addressof(sb)};
+    std::string expected;
+    for (int i = 0; i < 10000; i++) {
+        stream << i << ' ';
+        expected += std::to_string(i) + ' ';
+    }
+    stream.flush();
+    slassert(expected == sink.get_string());
+}
+
+void test_ostream_buffered_sink() {
+    auto dest = sl::io::string_sink();
+    {
+        auto sb = sl::io::make_buffered_ostreambuf(sl::io::make_buffered_sink(dest));
+        std::ostream stream{std::addressof(sb)};
+        stream << std::string(5000, 'a');
+        stream << "b";
+    }
+    slassert(5001 == dest.get_string().size());
+    slassert('b' == dest.get_string().back());
+}
+
+void test_ostream_move() {
+    auto dest = sl::io::string_sink();
+    {
+        // buffered sink lends its inline buffer
+        auto sb = sl::io::make_buffered_ostreambuf(sl::io::make_buffered_sink(dest));
+        slassert(5 == sb.sputn("hello", 5));
+        auto moved = std::move(sb);
+        slassert(6 == moved.sputn(" world", 6));
+        slassert(0 == moved.pubsync());
+        slassert("hello world" == dest.get_string());
+    }
+    slassert("hello world" == dest.get_string());
+}
+
+int main() {
+    try {
+        test_getline();
+        test_borrow();
+        test_in_avail();
+        test_large_read();
+        test_move();
+        test_move_borrowed();
+        test_ostream();
+        test_ostream_lending();
+        test_ostream_buffered_sink();
+        test_ostream_move();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
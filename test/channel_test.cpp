@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   channel_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:30 PM
+ */
+
+#include "staticlib/io/channel.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/channel_sink.hpp"
+#include "staticlib/io/channel_source.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+void test_single() {
+    auto chan = sl::io::make_channel(4);
+    auto sink = sl::io::make_channel_sink(chan);
+    auto src = sl::io::make_channel_source(chan);
+    sl::io::write_all(sink, {"foo", 3});
+    auto chunk = std::string(64, 'b');
+    auto ptr = chunk.data();
+    slassert(64 == sink.write_chunk(std::move(chunk)));
+    chan->close();
+    auto buf = std::array<char, 2>();
+    slassert(2 == src.read(sl::io::make_span(buf)));
+    slassert("fo" == std::string(buf.data(), buf.size()));
+    slassert(1 == src.read(sl::io::make_span(buf)));
+    auto moved = std::string();
+    slassert(src.read_chunk(moved));
+    slassert(std::string(64, 'b') == moved);
+    slassert(ptr == moved.data());
+    slassert(!src.read_chunk(moved));
+    slassert(std::char_traits<char>::eof() == src.read(sl::io::make_span(buf)));
+    slassert(2 == sink.get_chunks_count());
+    slassert(2 == src.get_chunks_count());
+
+    auto stats = chan->get_stats();
+    slassert(2 == stats.chunks_written);
+    slassert(2 == stats.chunks_read);
+    slassert(67 == stats.bytes_written);
+    slassert(67 == stats.bytes_read);
+    slassert(2 == stats.max_depth);
+}
+
+void test_closed() {
+    auto chan = sl::io::make_channel(1);
+    auto sink = sl::io::make_channel_sink(chan);
+    chan->close();
+    bool thrown = false;
+    try {
+        sink.write({"foo", 3});
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_fan_in_fan_out() {
+    auto chan = sl::io::make_channel(2);
+    auto writers = std::vector<std::thread>();
+    for (size_t i = 0; i < 4; i++) {
+        writers.emplace_back([chan] {
+            auto sink = sl::io::make_channel_sink(chan);
+            for (size_t j = 0; j < 1000; j++) {
+                sl::io::write_all(sink, {"foo", 3});
+            }
+        });
+    }
+    auto counts = std::vector<size_t>(3);
+    auto readers = std::vector<std::thread>();
+    for (size_t i = 0; i < counts.size(); i++) {
+        readers.emplace_back([chan, &counts, i] {
+            auto src = sl::io::make_channel_source(chan);
+            auto sink = sl::io::string_sink();
+            counts[i] = sl::io::copy_all(src, sink);
+        });
+    }
+    for (auto& th : writers) {
+        th.join();
+    }
+    chan->close();
+    for (auto& th : readers) {
+        th.join();
+    }
+    size_t total = 0;
+    for (size_t cn : counts) {
+        total += cn;
+    }
+    slassert(12000 == total);
+    auto stats = chan->get_stats();
+    slassert(4000 == stats.chunks_written);
+    slassert(4000 == stats.chunks_read);
+    slassert(stats.max_depth <= 2);
+}
+
+int main() {
+    try {
+        test_single();
+        test_closed();
+        test_fan_in_fan_out();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   checksum_sink_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:40 AM
+ */
+#include "staticlib/io/checksum_sink.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+const std::string check = "123456789";
+
+void test_write() {
+    auto two_bytes = two_bytes_at_once_sink();
+    auto sink = sl::io::make_checksum_sink(two_bytes, sl::io::checksum_algorithm::crc32);
+    // only accepted bytes are checksummed
+    slassert(2 == sink.write({check.data(), check.length()}));
+    sl::io::write_all(sink, {check.data() + 2, check.length() - 2});
+    slassert(check == two_bytes.get_data());
+    slassert(0xcbf43926 == sink.get_checksum());
+}
+
+void test_algorithms() {
+    auto dest = sl::io::string_sink();
+    auto crc32c = sl::io::make_checksum_sink(dest, sl::io::checksum_algorithm::crc32c);
+    sl::io::write_all(crc32c, check);
+    slassert(0xe3069283 == crc32c.get_checksum());
+    auto adler = sl::io::make_checksum_sink(dest, sl::io::checksum_algorithm::adler32);
+    sl::io::write_all(adler, check);
+    slassert(0x091e01de == adler.get_checksum());
+    auto xxh = sl::io::make_checksum_sink(dest, sl::io::checksum_algorithm::xxh64);
+    slassert(0xef46db3751d8e999 == xxh.get_checksum());
+}
+
+void test_prepare_commit() {
+    auto sink = sl::io::make_checksum_sink(sl::io::string_sink(), sl::io::checksum_algorithm::crc32);
+    auto span = sink.prepare(check.length());
+    std::memcpy(span.data(), check.data(), check.length());
+    sink.commit(check.length());
+    slassert(check == sink.get_sink().get_string());
+    slassert(0xcbf43926 == sink.get_checksum());
+}
+
+void test_reset() {
+    auto sink = sl::io::make_checksum_sink(sl::io::string_sink(), sl::io::checksum_algorithm::crc32);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.reset_checksum();
+    sl::io::write_all(sink, check);
+    slassert(0xcbf43926 == sink.get_checksum());
+    slassert("foo" + check == sink.get_sink().get_string());
+}
+
+int main() {
+    try {
+        test_write();
+        test_algorithms();
+        test_prepare_commit();
+        test_reset();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   checksum_source_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 3:30 AM
+ */
+#include "staticlib/io/checksum_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+const std::string check = "123456789";
+
+uint64_t checksum(const std::string& data, sl::io::checksum_algorithm algorithm) {
+    auto src = sl::io::make_checksum_source(two_bytes_at_once_source(data), algorithm);
+    auto sink = sl::io::null_sink();
+    sl::io::copy_all(src, sink);
+    return src.get_checksum();
+}
+
+void test_known() {
+    slassert(0xcbf43926 == checksum(check, sl::io::checksum_algorithm::crc32));
+    slassert(0xe3069283 == checksum(check, sl::io::checksum_algorithm::crc32c));
+    slassert(0x091e01de == checksum(check, sl::io::checksum_algorithm::adler32));
+    slassert(0xef46db3751d8e999 == checksum("", sl::io::checksum_algorithm::xxh64));
+    // lower bits are stored in zstd frames
+    slassert(0xd4935fd7 == (checksum("hello hello hello hello world", sl::io::checksum_algorithm::xxh64) & 0xffffffff));
+    slassert(0 == checksum("", sl::io::checksum_algorithm::crc32));
+    slassert(1 == checksum("", sl::io::checksum_algorithm::adler32));
+}
+
+void test_crc32c_vectors() {
+    // RFC 3720, B.4
+    slassert(0x8a9136aa == checksum(std::string(32, '\0'), sl::io::checksum_algorithm::crc32c));
+    slassert(0x62a8ab43 == checksum(std::string(32, '\xff'), sl::io::checksum_algorithm::crc32c));
+    std::string ascending;
+    for (int i = 0; i < 32; i++) {
+        ascending.push_back(static_cast<char>(i));
+    }
+    slassert(0x46dd794e == checksum(ascending, sl::io::checksum_algorithm::crc32c));
+}
+
+void test_long() {
+    std::string data;
+    for (size_t i = 0; i < 40; i++) {
+        for (int j = 0; j < 256; j++) {
+            data.push_back(static_cast<char>(j));
+        }
+    }
+    slassert(0xbbce3b9d == checksum(data, sl::io::checksum_algorithm::crc32));
+    slassert(0xf475ed1e == checksum(data, sl::io::checksum_algorithm::adler32));
+    // unaligned start and odd lengths give the same result as bytewise update
+    for (auto alg : {sl::io::checksum_algorithm::crc32, sl::io::checksum_algorithm::crc32c,
+            sl::io::checksum_algorithm::adler32, sl::io::checksum_algorithm::xxh64}) {
+        auto part = data.substr(3, 1001);
+        auto src = sl::io::make_checksum_source(sl::io::string_source(part), alg);
+        std::array<char, 1> buf;
+        while (std::char_traits<char>::eof() != src.read({buf.data(), buf.size()})) { }
+        slassert(checksum(part, alg) == src.get_checksum());
+    }
+}
+
+void test_verify() {
+    auto ok = sl::io::make_checksum_source(sl::io::string_source(check),
+            sl::io::checksum_algorithm::crc32c, 0xe3069283);
+    auto sink = sl::io::null_sink();
+    slassert(9 == sl::io::copy_all(ok, sink));
+    slassert(throws_exc([] {
+        auto bad = sl::io::make_checksum_source(sl::io::string_source(check),
+                sl::io::checksum_algorithm::crc32c, 0xe3069284);
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(bad, sink);
+    }));
+    // lent chunks are checksummed and verified
+    slassert(throws_exc([] {
+        auto bad = sl::io::make_checksum_source(sl::io::array_source(check.data(), check.length()),
+                sl::io::checksum_algorithm::crc32, 42);
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(bad, sink);
+    }));
+    auto arr = sl::io::make_checksum_source(sl::io::array_source(check.data(), check.length()),
+            sl::io::checksum_algorithm::crc32, 0xcbf43926);
+    slassert(9 == sl::io::copy_all(arr, sink));
+}
+
+void test_reset() {
+    auto src = sl::io::make_checksum_source(sl::io::string_source("foo" + check), sl::io::checksum_algorithm::crc32);
+    std::array<char, 3> buf;
+    sl::io::read_exact(src, {buf.data(), buf.size()});
+    src.reset_checksum();
+    auto sink = sl::io::null_sink();
+    sl::io::copy_all(src, sink);
+    slassert(0xcbf43926 == src.get_checksum());
+}
+
+int main() {
+    try {
+        test_known();
+        test_crc32c_vectors();
+        test_long();
+        test_verify();
+        test_reset();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   combining_sink_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 5:20 PM
+ */
+
+#include "staticlib/io/combining_sink.hpp"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+
+void test_write() {
+    auto sink = sl::io::make_combining_sink(std::make_shared<two_bytes_at_once_sink>());
+    slassert(3 == sink.write({"foo", 3}));
+    slassert(0 == sink.flush());
+    slassert("foo" == sink.get_sink().get_data());
+    slassert(1 == sink.get_writes_count());
+    slassert(1 == sink.get_batches_count());
+    slassert(1 == sink.get_max_batch_size());
+}
+
+void test_threads() {
+    auto sink = sl::io::make_combining_sink(std::make_shared<sl::io::string_sink>());
+    auto threads = std::vector<std::thread>();
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([sink] {
+            auto local = sink;
+            for (size_t j = 0; j < 1000; j++) {
+                sl::io::write_all(local, {"foo\n", 4});
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto& str = sink.get_sink().get_string();
+    slassert(16000 == str.length());
+    for (size_t i = 0; i < str.length(); i += 4) {
+        slassert("foo\n" == str.substr(i, 4));
+    }
+    slassert(4000 == sink.get_writes_count());
+    slassert(sink.get_batches_count() <= 4000);
+}
+
+int main() {
+    try {
+        test_write();
+        test_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
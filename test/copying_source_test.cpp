@@ -29,6 +29,8 @@
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/array_source.hpp"
+
 #include "two_bytes_at_once_source.hpp"
 #include "two_bytes_at_once_sink.hpp"
 
@@ -63,11 +65,20 @@ void test_lvalue() {
     (void) src;
 }
 
+void test_next_chunk() {
+    auto data = std::string("42");
+    auto src = sl::io::make_copying_source(sl::io::array_source(data), two_bytes_at_once_sink{});
+    auto chunk = src.next_chunk();
+    slassert(data.data() == chunk.data());
+    slassert("42" == src.get_sink().get_data());
+}
+
 int main() {
     try {
         test_copy();
         test_omit_tail();
         test_lvalue();
+        test_next_chunk();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
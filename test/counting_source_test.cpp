@@ -29,6 +29,9 @@
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/traits.hpp"
+
 #include "two_bytes_at_once_source.hpp"
 
 void test_count() {
@@ -48,10 +51,49 @@ void test_count_overflow() {
     slassert(2 == src.get_count());
 }
 
+// source that counts bytes skipped without reading
+class skipping_source {
+    two_bytes_at_once_source src;
+
+public:
+    size_t skipped = 0;
+
+    explicit skipping_source(std::string data) :
+    src(std::move(data)) { }
+
+    std::streamsize read(sl::io::span<char> span) {
+        return src.read(span);
+    }
+
+    void skip(size_t to_skip) {
+        skipped += to_skip;
+    }
+};
+
+void test_skip() {
+    static_assert(!sl::io::has_skip<sl::io::counting_source<two_bytes_at_once_source>>::value,
+            "skip must not be advertised for non-skippable source");
+    static_assert(sl::io::has_skip<sl::io::counting_source<skipping_source>>::value,
+            "skip must be forwarded for skippable source");
+
+    auto src = sl::io::make_counting_source(two_bytes_at_once_source{"foobar"});
+    std::array<char, 1> buf;
+    sl::io::skip(src, buf, 4);
+    slassert(4 == src.get_count());
+    slassert('b' == buf[0]);
+
+    skipping_source delegate{"foobar"};
+    auto src_skip = sl::io::make_counting_source(delegate);
+    sl::io::skip(src_skip, 4);
+    slassert(4 == src_skip.get_count());
+    slassert(4 == delegate.skipped);
+}
+
 int main() {
     try {
         test_count();
         test_count_overflow();
+        test_skip();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   deflate_sink_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 9:20 PM
+ */
+
+#include "staticlib/io/deflate_sink.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/inflate_source.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+std::string inflate(const std::string& compressed, sl::io::deflate_format format) {
+    auto src = sl::io::make_inflate_source(sl::io::string_source(compressed), format);
+    return read_string(src);
+}
+
+void test_known() {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = sl::io::make_deflate_sink(dest, sl::io::deflate_format::zlib, 9);
+        sl::io::write_all(sink, {"hello hello hello hello world", 29});
+    }
+    slassert("78dacb48cdc9c957c8c020cbf38b725200a38a0af9" == sl::io::string_to_hex(dest.get_string()));
+}
+
+void test_roundtrip() {
+    auto data = make_data(100000);
+    for (auto format : {sl::io::deflate_format::raw, sl::io::deflate_format::zlib, sl::io::deflate_format::gzip}) {
+        for (int level : {0, 1, 6, 9}) {
+            for (int window_bits : {9, 15}) {
+                auto dest = sl::io::string_sink();
+                auto sink = sl::io::make_deflate_sink(dest, format, level, window_bits);
+                sl::io::write_all(sink, data);
+                sink.finish();
+                if (level > 0) {
+                    slassert(dest.get_string().length() < data.length() / 4);
+                }
+                slassert(data == inflate(dest.get_string(), format));
+            }
+        }
+    }
+}
+
+void test_empty() {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = sl::io::make_deflate_sink(dest, sl::io::deflate_format::gzip);
+    }
+    slassert(20 == dest.get_string().length());
+    slassert(inflate(dest.get_string(), sl::io::deflate_format::gzip).empty());
+}
+
+void test_flush() {
+    auto two_bytes = two_bytes_at_once_sink();
+    auto sink = sl::io::make_deflate_sink(two_bytes);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.flush();
+    // stream is not completed, but written data can be decompressed
+    auto src = sl::io::make_inflate_source(sl::io::string_source(two_bytes.get_data()));
+    std::string res(3, '\0');
+    sl::io::read_exact(src, {std::addressof(res.front()), res.length()});
+    slassert("foo" == res);
+    slassert(throws_exc([&src] {
+        char ch;
+        src.read({std::addressof(ch), 1});
+    }));
+    sl::io::write_all(sink, {"bar", 3});
+    sink.finish();
+    slassert("foobar" == inflate(two_bytes.get_data(), sl::io::deflate_format::zlib));
+    // no-op after finish
+    sink.finish();
+    slassert(throws_exc([&sink] {
+        sl::io::write_all(sink, {"baz", 3});
+    }));
+}
+
+void test_reset() {
+    auto dest = sl::io::string_sink();
+    auto sink = sl::io::make_deflate_sink(dest, sl::io::deflate_format::gzip);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.finish();
+    // next gzip member is written into the same sink
+    sink.reset();
+    sl::io::write_all(sink, {"bar", 3});
+    sink.finish();
+    slassert("foobar" == inflate(dest.get_string(), sl::io::deflate_format::gzip));
+
+    auto other = sl::io::string_sink();
+    sink.reset(sl::io::make_reference_sink(other));
+    sl::io::write_all(sink, {"baz", 3});
+    sink.finish();
+    slassert("baz" == inflate(other.get_string(), sl::io::deflate_format::gzip));
+}
+
+void test_invalid() {
+    auto dest = sl::io::string_sink();
+    slassert(throws_exc([&dest] {
+        sl::io::make_deflate_sink(dest, sl::io::deflate_format::zlib, 10);
+    }));
+    slassert(throws_exc([&dest] {
+        sl::io::make_deflate_sink(dest, sl::io::deflate_format::zlib, 6, 8);
+    }));
+}
+
+int main() {
+    try {
+        test_known();
+        test_roundtrip();
+        test_empty();
+        test_flush();
+        test_reset();
+        test_invalid();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   digest_sink_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 6:10 AM
+ */
+#include "staticlib/io/digest_sink.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/blake3.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/sha256.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+std::string make_bytes(size_t len) {
+    std::string res;
+    res.resize(len);
+    for (size_t i = 0; i < len; i++) {
+        res[i] = static_cast<char>(i % 251);
+    }
+    return res;
+}
+
+// writes data in pieces of different sizes
+template<typename Digest>
+std::string digest_hex(const std::string& data, Digest digest = Digest()) {
+    auto sink = sl::io::make_digest_sink(sl::io::null_sink(), std::move(digest));
+    size_t piece = 1;
+    for (size_t off = 0; off < data.length(); off += piece, piece = piece * 3 + 1) {
+        size_t len = piece < data.length() - off ? piece : data.length() - off;
+        sl::io::write_all(sink, {data.data() + off, len});
+    }
+    return sl::io::string_to_hex(sink.get_digest());
+}
+
+void test_sha256() {
+    slassert("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" == digest_hex<sl::io::sha256>(""));
+    slassert("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" == digest_hex<sl::io::sha256>("abc"));
+    slassert("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" ==
+            digest_hex<sl::io::sha256>(std::string(1000000, 'a')));
+    slassert("cd2df694e424bc7968cc37f47751019e5ca0cd1bdf2e479ea537c3a1c32ee1aa" ==
+            digest_hex<sl::io::sha256>(make_bytes(100000)));
+}
+
+void test_blake3() {
+    slassert("af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262" == digest_hex<sl::io::blake3>(""));
+    slassert("6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85" == digest_hex<sl::io::blake3>("abc"));
+    slassert("d93c23eedaf165a7e0be908ba86f1a7a520d568d2d13cde787c8580c5c72cc54" ==
+            digest_hex<sl::io::blake3>(make_bytes(100000)));
+}
+
+void test_blake3_workers() {
+    auto data = make_bytes(3 * 1048576 + 12345);
+    std::string expected = "ce1148523b8586723c3fd8b1fe92fe16394888a360c96965bf3b1900421f3e19";
+    slassert(expected == digest_hex<sl::io::blake3>(data));
+    slassert(expected == digest_hex(data, sl::io::blake3(2)));
+    // last full subtree is the root side of the tree
+    auto even = make_bytes(2 * 1048576);
+    std::string even_expected = "96fbba37478c16b7614c890b26832f67b541cf14e69ab8ebf0c739818588c9f1";
+    slassert(even_expected == digest_hex<sl::io::blake3>(even));
+    slassert(even_expected == digest_hex(even, sl::io::blake3(3)));
+    // small inputs are hashed inline
+    slassert("6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85" ==
+            digest_hex(std::string("abc"), sl::io::blake3(2)));
+}
+
+void test_write() {
+    auto two_bytes = two_bytes_at_once_sink();
+    auto sink = sl::io::make_digest_sink<sl::io::sha256>(two_bytes);
+    // only accepted bytes are digested
+    slassert(2 == sink.write({"abc", 3}));
+    sl::io::write_all(sink, {"c", 1});
+    slassert("abc" == two_bytes.get_data());
+    slassert("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ==
+            sl::io::string_to_hex(sink.get_digest()));
+    slassert(throws_exc([&sink] {
+        sink.write({"d", 1});
+    }));
+}
+
+void test_prepare_commit() {
+    auto sink = sl::io::make_digest_sink<sl::io::blake3>(sl::io::string_sink());
+    auto span = sink.prepare(3);
+    std::memcpy(span.data(), "abc", 3);
+    sink.commit(3);
+    slassert("abc" == sink.get_sink().get_string());
+    slassert("6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85" ==
+            sl::io::string_to_hex(sink.get_digest()));
+}
+
+void test_reset() {
+    auto sink = sl::io::make_digest_sink(sl::io::string_sink(), sl::io::blake3(2));
+    sl::io::write_all(sink, make_bytes(1500000));
+    sink.reset_digest();
+    sl::io::write_all(sink, {"abc", 3});
+    slassert("6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85" ==
+            sl::io::string_to_hex(sink.get_digest()));
+    sink.reset_digest();
+    slassert("af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262" ==
+            sl::io::string_to_hex(sink.get_digest()));
+}
+
+int main() {
+    try {
+        test_sha256();
+        test_blake3();
+        test_blake3_workers();
+        test_write();
+        test_prepare_commit();
+        test_reset();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
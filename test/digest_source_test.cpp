@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   digest_source_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 6:30 AM
+ */
+#include "staticlib/io/digest_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/blake3.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/sha256.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+const std::string abc_sha256 = "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+const std::string abc_blake3 = "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85";
+
+void test_read() {
+    auto src = sl::io::make_digest_source<sl::io::sha256>(two_bytes_at_once_source("abc"));
+    auto sink = sl::io::null_sink();
+    slassert(3 == sl::io::copy_all(src, sink));
+    slassert(abc_sha256 == sl::io::string_to_hex(src.get_digest()));
+    auto b3 = sl::io::make_digest_source<sl::io::blake3>(sl::io::string_source("abc"));
+    sl::io::copy_all(b3, sink);
+    slassert(abc_blake3 == sl::io::string_to_hex(b3.get_digest()));
+}
+
+void test_verify() {
+    auto ok = sl::io::make_digest_verify_source<sl::io::sha256>(sl::io::string_source("abc"),
+            sl::io::string_from_hex(abc_sha256));
+    auto sink = sl::io::null_sink();
+    slassert(3 == sl::io::copy_all(ok, sink));
+    slassert(throws_exc([] {
+        auto bad = sl::io::make_digest_verify_source<sl::io::sha256>(sl::io::string_source("abd"),
+                sl::io::string_from_hex(abc_sha256));
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(bad, sink);
+    }));
+    // lent chunks are digested and verified
+    std::string abc = "abc";
+    auto arr = sl::io::make_digest_verify_source<sl::io::blake3>(sl::io::array_source(abc.data(), abc.length()),
+            sl::io::string_from_hex(abc_blake3));
+    slassert(3 == sl::io::copy_all(arr, sink));
+    slassert(throws_exc([&abc] {
+        auto bad = sl::io::make_digest_verify_source<sl::io::blake3>(sl::io::array_source(abc.data(), 2),
+                sl::io::string_from_hex(abc_blake3));
+        auto sink = sl::io::null_sink();
+        sl::io::copy_all(bad, sink);
+    }));
+}
+
+void test_reset() {
+    auto src = sl::io::make_digest_source<sl::io::sha256>(sl::io::string_source("fooabc"));
+    std::array<char, 3> buf;
+    sl::io::read_exact(src, {buf.data(), buf.size()});
+    src.reset_digest();
+    auto sink = sl::io::null_sink();
+    sl::io::copy_all(src, sink);
+    slassert(abc_sha256 == sl::io::string_to_hex(src.get_digest()));
+}
+
+int main() {
+    try {
+        test_read();
+        test_verify();
+        test_reset();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   framed_sink_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 8:40 AM
+ */
+#include "staticlib/io/framed_sink.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+sl::io::frame_options make_options(sl::io::frame_format format) {
+    auto res = sl::io::frame_options();
+    res.format = format;
+    return res;
+}
+
+void test_length_prefix() {
+    auto be = sl::io::make_framed_sink(sl::io::string_sink());
+    be.write_frame({"foo", 3});
+    slassert("00000003666f6f" == sl::io::string_to_hex(be.get_sink().get_string()));
+    auto le = sl::io::make_framed_sink(sl::io::string_sink(), make_options(sl::io::frame_format::length_le32));
+    le.write_frame({"foo", 3});
+    slassert("03000000666f6f" == sl::io::string_to_hex(le.get_sink().get_string()));
+    auto varint = sl::io::make_framed_sink(sl::io::string_sink(), make_options(sl::io::frame_format::length_varint));
+    varint.write_frame({"", 0});
+    varint.write_frame({"foo", 3});
+    std::string large(300, 'a');
+    varint.write_frame(large);
+    std::string written = varint.get_sink().get_string();
+    slassert(1 + 4 + 2 + 300 == written.length());
+    slassert("0003666f6fac02" == sl::io::string_to_hex(written.substr(0, 7)));
+}
+
+void test_delimited() {
+    auto sink = sl::io::make_framed_sink(sl::io::string_sink(), make_options(sl::io::frame_format::delimited));
+    sink.write_frame({"foo", 3});
+    sink.write_frame({"", 0});
+    // each write is a frame
+    sl::io::write_all(sink, {"bar", 3});
+    slassert("foo\n\nbar\n" == sink.get_sink().get_string());
+    slassert(throws_exc([&sink] {
+        sink.write_frame({"a\nb", 3});
+    }));
+}
+
+void test_large() {
+    // large frames are written without copying, through partial writes
+    auto two_bytes = two_bytes_at_once_sink();
+    auto sink = sl::io::make_framed_sink(two_bytes);
+    std::string payload(40000, 'x');
+    sink.write_frame(payload);
+    sink.write_frame({"y", 1});
+    slassert(4 + 40000 + 4 + 1 == two_bytes.get_data().length());
+    slassert("00009c40" == sl::io::string_to_hex(two_bytes.get_data().substr(0, 4)));
+    slassert("00000001" == sl::io::string_to_hex(two_bytes.get_data().substr(40004, 4)));
+}
+
+void test_max_frame_size() {
+    auto options = sl::io::frame_options();
+    options.max_frame_size = 4;
+    auto sink = sl::io::make_framed_sink(sl::io::string_sink(), options);
+    sink.write_frame({"1234", 4});
+    slassert(throws_exc([&sink] {
+        sink.write_frame({"12345", 5});
+    }));
+    slassert(8 == sink.get_sink().get_string().length());
+    // streamed frames are not limited
+    sink.write_frame_header(5);
+    sl::io::write_all(sink.get_sink(), {"12345", 5});
+    slassert("000000053132333435" == sl::io::string_to_hex(sink.get_sink().get_string().substr(8)));
+    if (sizeof(size_t) > 4) {
+        slassert(throws_exc([&sink] {
+            sink.write_frame_header(static_cast<size_t>(0xffffffff) + 1);
+        }));
+    }
+}
+
+void test_header() {
+    auto sink = sl::io::make_framed_sink(sl::io::string_sink(), make_options(sl::io::frame_format::length_varint));
+    sink.write_frame_header(3);
+    sl::io::write_all(sink.get_sink(), {"foo", 3});
+    slassert("03666f6f" == sl::io::string_to_hex(sink.get_sink().get_string()));
+    auto delimited = sl::io::make_framed_sink(sl::io::string_sink(), make_options(sl::io::frame_format::delimited));
+    slassert(throws_exc([&delimited] {
+        delimited.write_frame_header(3);
+    }));
+}
+
+int main() {
+    try {
+        test_length_prefix();
+        test_delimited();
+        test_large();
+        test_max_frame_size();
+        test_header();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   framed_source_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 9:00 AM
+ */
+#include "staticlib/io/framed_source.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/framed_sink.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+sl::io::frame_options make_options(sl::io::frame_format format) {
+    auto res = sl::io::frame_options();
+    res.format = format;
+    return res;
+}
+
+template<typename Source>
+std::string frame_string(Source& src) {
+    auto frame = src.get_frame();
+    return std::string(frame.data(), frame.size());
+}
+
+std::vector<std::string> make_frames() {
+    std::vector<std::string> res;
+    for (size_t len : {0, 1, 127, 128, 300, 20000, 5}) {
+        std::string frame;
+        for (size_t i = 0; i < len; i++) {
+            frame.push_back(static_cast<char>('a' + (i + len) % 26));
+        }
+        res.push_back(frame);
+    }
+    return res;
+}
+
+std::string write_frames(const std::vector<std::string>& frames, sl::io::frame_options options) {
+    auto sink = sl::io::make_framed_sink(sl::io::string_sink(), options);
+    for (auto& fr : frames) {
+        sink.write_frame(fr);
+    }
+    return sink.get_sink().get_string();
+}
+
+void test_roundtrip() {
+    auto frames = make_frames();
+    for (auto format : {sl::io::frame_format::length_be32, sl::io::frame_format::length_le32,
+            sl::io::frame_format::length_varint, sl::io::frame_format::delimited}) {
+        auto options = make_options(format);
+        auto src = sl::io::make_framed_source(two_bytes_at_once_source(write_frames(frames, options)), options);
+        for (auto& expected : frames) {
+            slassert(src.next_frame());
+            slassert(expected == frame_string(src));
+        }
+        slassert(!src.next_frame());
+        slassert(!src.next_frame());
+    }
+}
+
+void test_delimited() {
+    auto options = make_options(sl::io::frame_format::delimited);
+    options.delimiter = '\0';
+    std::string data("foo\0\0bar", 8);
+    auto src = sl::io::make_framed_source(sl::io::string_source(data), options);
+    slassert(src.next_frame());
+    slassert("foo" == frame_string(src));
+    slassert(src.next_frame());
+    slassert(0 == src.get_frame().size());
+    // last frame without delimiter
+    slassert(src.next_frame());
+    slassert("bar" == frame_string(src));
+    slassert(!src.next_frame());
+    slassert(throws_exc([&src] {
+        size_t len = 0;
+        src.next_frame_header(len);
+    }));
+}
+
+void test_max_frame_size() {
+    auto options = make_options(sl::io::frame_format::length_varint);
+    auto data = write_frames({"1234", "12345"}, options);
+    options.max_frame_size = 4;
+    auto src = sl::io::make_framed_source(sl::io::string_source(data), options);
+    slassert(src.next_frame());
+    slassert(throws_exc([&src] {
+        src.next_frame();
+    }));
+    auto delimited = make_options(sl::io::frame_format::delimited);
+    delimited.max_frame_size = 4;
+    slassert(throws_exc([&delimited] {
+        auto src = sl::io::make_framed_source(two_bytes_at_once_source("1234\n12345\n"), delimited);
+        while (src.next_frame()) { }
+    }));
+}
+
+void test_truncated() {
+    auto data = write_frames({"foo"}, sl::io::frame_options());
+    slassert(throws_exc([&data] {
+        auto src = sl::io::make_framed_source(sl::io::string_source(data.substr(0, 5)));
+        src.next_frame();
+    }));
+    slassert(throws_exc([&data] {
+        auto src = sl::io::make_framed_source(sl::io::string_source(data.substr(0, 2)));
+        src.next_frame();
+    }));
+    // over-long varint
+    slassert(throws_exc([] {
+        auto src = sl::io::make_framed_source(sl::io::string_source(std::string(11, '\xff')),
+                make_options(sl::io::frame_format::length_varint));
+        src.next_frame();
+    }));
+}
+
+void test_payload_source() {
+    auto options = sl::io::frame_options();
+    auto data = write_frames({std::string(50000, 'x'), "foo", "skipped", "bar"}, options);
+    options.max_frame_size = 1024;
+    auto src = sl::io::make_framed_source(two_bytes_at_once_source(data), options);
+    size_t len = 0;
+    slassert(src.next_frame_header(len));
+    slassert(50000 == len);
+    // large frame is streamed without buffering
+    auto payload = src.frame_payload_source();
+    auto sink = sl::io::string_sink();
+    slassert(50000 == sl::io::copy_all(payload, sink));
+    slassert(std::string(50000, 'x') == sink.get_string());
+    slassert(src.next_frame());
+    slassert("foo" == frame_string(src));
+    // unread frame is skipped
+    slassert(src.next_frame_header(len));
+    slassert(7 == len);
+    slassert(src.next_frame());
+    slassert("bar" == frame_string(src));
+    slassert(!src.next_frame_header(len));
+}
+
+int main() {
+    try {
+        test_roundtrip();
+        test_delimited();
+        test_max_frame_size();
+        test_truncated();
+        test_payload_source();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
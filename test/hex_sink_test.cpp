@@ -25,9 +25,14 @@
 #include "staticlib/io/operations.hpp"
 
 #include <iostream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/string_sink.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+
 void test_sink() {
     // hello in russian
     auto src = sl::io::string_source("\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82");
@@ -40,9 +45,30 @@ void test_sink() {
     slassert("d0bfd180d0b8d0b2d0b5d182" == dest_sink.get_string());
 }
 
+void test_direct() {
+    auto dest_sink = sl::io::string_sink();
+    auto sink = sl::io::make_hex_sink(dest_sink);
+    auto data = std::string(10000, '\x2a');
+    sl::io::write_all(sink, data);
+    sl::io::write_all(sink, {"\xff", 1});
+    auto& res = dest_sink.get_string();
+    slassert(20002 == res.length());
+    slassert("2a2a" == res.substr(0, 4));
+    slassert("2aff" == res.substr(19998));
+
+    // buffered
+    auto two_bytes = two_bytes_at_once_sink();
+    {
+        auto buffered = sl::io::make_hex_sink(two_bytes);
+        sl::io::write_all(buffered, data);
+    }
+    slassert(res.substr(0, 20000) == two_bytes.get_data());
+}
+
 int main() {
     try {
         test_sink();
+        test_direct();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   inflate_source_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 9:35 PM
+ */
+
+#include "staticlib/io/inflate_source.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+const std::string hello = "hello hello hello hello world";
+// compressed with zlib
+const std::string hello_raw = "cb48cdc9c957c8c020cbf38b725200";
+const std::string hello_zlib = "78dacb48cdc9c957c8c020cbf38b725200a38a0af9";
+const std::string hello_gzip = "1f8b0800000000000203cb48cdc9c957c8c020cbf38b725200336534341d000000";
+
+void test_formats() {
+    auto raw = sl::io::make_inflate_source(sl::io::string_source(sl::io::string_from_hex(hello_raw)),
+            sl::io::deflate_format::raw);
+    slassert(hello == read_string(raw));
+    auto zlib = sl::io::make_inflate_source(sl::io::string_source(sl::io::string_from_hex(hello_zlib)));
+    slassert(hello == read_string(zlib));
+    auto gzip = sl::io::make_inflate_source(sl::io::string_source(sl::io::string_from_hex(hello_gzip)),
+            sl::io::deflate_format::gzip);
+    slassert(hello == read_string(gzip));
+}
+
+void test_chunks() {
+    auto src = sl::io::make_inflate_source(two_bytes_at_once_source(sl::io::string_from_hex(hello_gzip)),
+            sl::io::deflate_format::gzip);
+    std::string res;
+    char ch = '\0';
+    while (std::char_traits<char>::eof() != src.read({std::addressof(ch), 1})) {
+        res.push_back(ch);
+    }
+    slassert(hello == res);
+}
+
+void test_multi_member() {
+    auto data = sl::io::string_from_hex(
+            "1f8b08000000000002034bcbcf07002165738c03000000"
+            "1f8b08000000000002034b4a2c0200aa8cff7603000000");
+    auto src = sl::io::make_inflate_source(sl::io::string_source(data), sl::io::deflate_format::gzip);
+    slassert("foobar" == read_string(src));
+}
+
+void test_reset() {
+    auto data = sl::io::string_from_hex(hello_zlib + hello_zlib);
+    auto src = sl::io::make_inflate_source(sl::io::string_source(data));
+    slassert(hello == read_string(src));
+    // input that follows the first stream is kept
+    src.reset();
+    slassert(hello == read_string(src));
+    src.reset(sl::io::string_source(sl::io::string_from_hex(hello_zlib)));
+    slassert(hello == read_string(src));
+}
+
+void test_invalid() {
+    auto data = sl::io::string_from_hex(hello_zlib);
+    slassert(throws_exc([&data] {
+        auto src = sl::io::make_inflate_source(sl::io::string_source(data.substr(0, data.length() - 1)));
+        read_string(src);
+    }));
+    slassert(throws_exc([&data] {
+        auto corrupted = data;
+        corrupted[corrupted.length() - 1] ^= 1;
+        auto src = sl::io::make_inflate_source(sl::io::string_source(corrupted));
+        read_string(src);
+    }));
+    slassert(throws_exc([&data] {
+        auto src = sl::io::make_inflate_source(sl::io::string_source(data), sl::io::deflate_format::gzip);
+        read_string(src);
+    }));
+    slassert(throws_exc([] {
+        auto src = sl::io::make_inflate_source(sl::io::string_source(""));
+        read_string(src);
+    }));
+}
+
+int main() {
+    try {
+        test_formats();
+        test_chunks();
+        test_multi_member();
+        test_reset();
+        test_invalid();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   instrumented_sink_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 3:05 PM
+ */
+
+#include "staticlib/io/instrumented_sink.hpp"
+
+#include <cstring>
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/memory_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/traits.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+class throwing_sink {
+public:
+    std::streamsize write(sl::io::span<const char>) {
+        throw sl::io::io_exception("write failed");
+    }
+
+    std::streamsize flush() {
+        throw sl::io::io_exception("flush failed");
+    }
+};
+
+void test_write() {
+    auto sink = sl::io::make_instrumented_sink(two_bytes_at_once_sink());
+    sl::io::write_all(sink, {"foo42", 5});
+    sink.flush();
+    slassert("foo42" == sink.get_sink().get_data());
+    auto snap = sink.get_write_snapshot();
+    slassert(3 == snap.calls);
+    slassert(5 == snap.bytes);
+    slassert(2 == snap.short_calls);
+    slassert(0 == snap.exceptions);
+    slassert(1 == sink.get_flush_snapshot().calls);
+}
+
+void test_exception() {
+    auto sink = sl::io::make_instrumented_sink(throwing_sink());
+    slassert(throws_exc([&sink] { sink.write({"42", 2}); }));
+    slassert(throws_exc([&sink] { sink.flush(); }));
+    slassert(throws_exc([&sink] { sink.flush(); }));
+    slassert(1 == sink.get_write_snapshot().exceptions);
+    slassert(2 == sink.get_flush_snapshot().exceptions);
+    slassert(2 == sink.get_flush_snapshot().calls);
+}
+
+void test_reference() {
+    auto dest = sl::io::string_sink();
+    auto metrics = std::make_shared<sl::io::sink_metrics>();
+    {
+        auto sink = sl::io::make_instrumented_sink(dest, metrics);
+        sl::io::write_all(sink, {"42", 2});
+    }
+    slassert("42" == dest.get_string());
+    slassert(2 == metrics->write.snapshot().bytes);
+    slassert(0 == metrics->write.snapshot().short_calls);
+}
+
+void test_forward() {
+    static_assert(!sl::io::has_prepare<sl::io::instrumented_sink<two_bytes_at_once_sink>>::value,
+            "prepare not advertised");
+    auto sink = sl::io::make_instrumented_sink(sl::io::string_sink());
+    auto buf = sink.prepare(3);
+    slassert(buf.size() >= 3);
+    std::memcpy(buf.data(), "foo", 3);
+    sink.commit(3);
+    slassert("foo" == sink.get_sink().get_string());
+    slassert(1 == sink.get_prepare_snapshot().calls);
+    auto snap = sink.get_write_snapshot();
+    slassert(1 == snap.calls);
+    slassert(3 == snap.bytes);
+
+    std::array<char, 4> arr;
+    auto mem = sl::io::make_instrumented_sink(sl::io::memory_sink(sl::io::make_span(arr)));
+    slassert(2 == mem.write_at(2, {"42", 2}));
+    slassert(4 == mem.size());
+    slassert(2 == mem.seek(2));
+    slassert(2 == mem.tell());
+    slassert('4' == arr[2]);
+    slassert(2 == mem.get_write_snapshot().bytes);
+    slassert(3 == mem.get_seek_snapshot().calls);
+}
+
+int main() {
+    try {
+        test_write();
+        test_exception();
+        test_reference();
+        test_forward();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
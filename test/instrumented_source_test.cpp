@@ -0,0 +1,170 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   instrumented_source_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:50 PM
+ */
+
+#include "staticlib/io/instrumented_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/null_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+#include "staticlib/io/traits.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+class throwing_source {
+public:
+    std::streamsize read(sl::io::span<char>) {
+        throw sl::io::io_exception("read failed");
+    }
+};
+
+void test_read() {
+    auto src = sl::io::make_instrumented_source(two_bytes_at_once_source{"foo42"});
+    std::array<char, 4> arr;
+    slassert(2 == src.read(arr));
+    slassert(2 == src.read(arr));
+    slassert(1 == src.read(arr));
+    slassert(std::char_traits<char>::eof() == src.read(arr));
+    auto snap = src.get_read_snapshot();
+    slassert(4 == snap.calls);
+    slassert(5 == snap.bytes);
+    slassert(3 == snap.short_calls);
+    slassert(1 == snap.eofs);
+    slassert(0 == snap.exceptions);
+    uint64_t hist_total = 0;
+    for (uint64_t cnt : snap.latency_histogram) {
+        hist_total += cnt;
+    }
+    slassert(4 == hist_total);
+    slassert(snap.get_latency_percentile_ns(0.5) > 0);
+    slassert(snap.get_latency_percentile_ns(0.5) <= snap.get_latency_percentile_ns(1.0));
+}
+
+void test_exception() {
+    auto src = sl::io::make_instrumented_source(throwing_source());
+    std::array<char, 4> arr;
+    slassert(throws_exc([&src, &arr] { src.read(arr); }));
+    auto snap = src.get_read_snapshot();
+    slassert(1 == snap.calls);
+    slassert(1 == snap.exceptions);
+    slassert(0 == snap.bytes);
+}
+
+void test_shared_metrics() {
+    auto metrics = std::make_shared<sl::io::source_metrics>();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([metrics] {
+            auto src = sl::io::make_instrumented_source(sl::io::string_source(std::string(1000, 'a')), metrics);
+            auto sink = sl::io::null_sink();
+            std::array<char, 100> buf;
+            sl::io::copy_all(src, sink, buf);
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto snap = metrics->read.snapshot();
+    slassert(4000 == snap.bytes);
+    // copy goes through the lending path of the string source
+    slassert(8 == snap.calls);
+    slassert(4 == snap.eofs);
+    metrics->read.reset();
+    slassert(0 == metrics->read.snapshot().calls);
+}
+
+void test_reference() {
+    two_bytes_at_once_source delegate{"42"};
+    auto src = sl::io::make_instrumented_source(delegate);
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("42" == sink.get_string());
+    slassert(2 == src.get_metrics()->read.snapshot().bytes);
+}
+
+void test_forward() {
+    static_assert(sl::io::has_seek<sl::io::instrumented_source<sl::io::string_source>>::value,
+            "seek forwarded");
+    static_assert(!sl::io::has_seek<sl::io::instrumented_source<two_bytes_at_once_source>>::value,
+            "seek not advertised");
+    static_assert(!sl::io::has_borrow_read<sl::io::instrumented_source<two_bytes_at_once_source>>::value,
+            "borrow_read not advertised");
+    auto src = sl::io::make_instrumented_source(sl::io::string_source("foobar"));
+    auto chunk = src.borrow_read(4);
+    slassert("foob" == std::string(chunk.data(), chunk.size()));
+    std::array<char, 4> arr;
+    slassert(2 == src.read_at(4, arr));
+    slassert(6 == src.size());
+    slassert(1 == src.seek(1));
+    slassert(1 == src.tell());
+    auto rest = src.next_chunk();
+    slassert("oobar" == std::string(rest.data(), rest.size()));
+    slassert(0 == src.next_chunk().size());
+    auto snap = src.get_read_snapshot();
+    slassert(4 == snap.calls);
+    slassert(11 == snap.bytes);
+    slassert(1 == snap.short_calls);
+    slassert(1 == snap.eofs);
+    auto seek_snap = src.get_seek_snapshot();
+    slassert(3 == seek_snap.calls);
+    slassert(0 == seek_snap.bytes);
+}
+
+void test_percentile() {
+    sl::io::operation_metrics metrics;
+    for (size_t i = 0; i < 99; i++) {
+        metrics.record(1, 1, 100);
+    }
+    metrics.record(1, 1, 1000000);
+    auto snap = metrics.snapshot();
+    slassert(0 == sl::io::operation_snapshot().get_latency_percentile_ns(0.99));
+    slassert(128 == snap.get_latency_percentile_ns(0.5));
+    slassert(128 == snap.get_latency_percentile_ns(0.98));
+    slassert(1048576 == snap.get_latency_percentile_ns(0.999));
+    slassert(100 * 99 + 1000000 == snap.latency_total_ns);
+}
+
+int main() {
+    try {
+        test_read();
+        test_exception();
+        test_shared_metrics();
+        test_reference();
+        test_forward();
+        test_percentile();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
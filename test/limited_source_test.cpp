@@ -29,6 +29,9 @@
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/operations.hpp"
+
 #include "two_bytes_at_once_source.hpp"
 #include "test_utils.hpp"
 
@@ -50,9 +53,60 @@ void test_limit() {
     slassert(std::char_traits<char>::eof() == one_byte_src.read({arr.data(), 1}));
 }
 
+void test_seek() {
+    auto arr = std::string("foobar");
+    auto inner = sl::io::array_source(arr.data(), arr.length());
+    slassert(1 == inner.seek(1));
+    auto src = sl::io::make_limited_source(inner, 3);
+    slassert(sl::io::has_seek<decltype(src)>::value);
+    slassert(3 == src.size());
+    slassert(2 == src.seek(2));
+    std::array<char, 4> out;
+    slassert(1 == src.read(out));
+    slassert('b' == out[0]);
+    slassert(std::char_traits<char>::eof() == src.read(out));
+    slassert(0 == src.seek(0));
+    slassert(1 == inner.tell());
+    slassert(3 == src.read(out));
+    slassert("oob" == std::string(out.data(), 3));
+    slassert(1 == src.seek(-2, std::ios_base::end));
+    slassert(1 == src.get_count());
+    slassert(throws_exc([&src] { src.seek(4); }));
+
+    // not seekable
+    slassert(!sl::io::has_seek<sl::io::limited_source<two_bytes_at_once_source>>::value);
+}
+
+void test_skip() {
+    auto src = sl::io::make_limited_source(two_bytes_at_once_source{"foobar"}, 4);
+    sl::io::skip(src, 3);
+    slassert(3 == src.get_count());
+    std::array<char, 2> arr;
+    slassert(1 == src.read(arr));
+    slassert('b' == arr[0]);
+    slassert(std::char_traits<char>::eof() == src.read(arr));
+
+    auto src_over = sl::io::make_limited_source(two_bytes_at_once_source{"foobar"}, 4);
+    slassert(throws_exc([&src_over] { sl::io::skip(src_over, 5); }));
+}
+
+void test_borrow_read() {
+    auto data = std::string("foobar");
+    auto src = sl::io::make_limited_source(sl::io::array_source(data), 4);
+    auto chunk = src.borrow_read(3);
+    slassert("foo" == std::string(chunk.data(), chunk.size()));
+    chunk = src.borrow_read(3);
+    slassert("b" == std::string(chunk.data(), chunk.size()));
+    slassert(4 == src.get_count());
+    slassert(0 == src.borrow_read(3).size());
+}
+
 int main() {
     try {
         test_limit();
+        test_seek();
+        test_skip();
+        test_borrow_read();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
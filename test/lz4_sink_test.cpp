@@ -0,0 +1,214 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_sink_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:59 PM
+ */
+#include "staticlib/io/lz4_sink.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/limited_source.hpp"
+#include "staticlib/io/lz4_source.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+std::string decompress(const std::string& compressed, const std::string& dictionary = "") {
+    auto src = sl::io::make_lz4_source(sl::io::string_source(compressed), dictionary);
+    return read_string(src);
+}
+
+std::string compress(const std::string& data, const sl::io::lz4_options& options) {
+    return write_string(data, [&options](sl::io::string_sink& dest) {
+        return sl::io::make_lz4_sink(dest, options);
+    });
+}
+
+void test_known() {
+    // same as produced by "lz4 -B4 -BI"
+    auto compressed = compress("hello hello hello hello world", sl::io::lz4_options());
+    slassert("04224d186440a70f0000006e68656c6c6f20060050776f726c6400000000e5fc6ad1" ==
+            sl::io::string_to_hex(compressed));
+}
+
+void test_roundtrip() {
+    auto data = make_data(300000);
+    for (size_t block_size : {1 << 16, 1 << 18, 1 << 20, 1 << 22}) {
+        for (bool checksums : {false, true}) {
+            auto opts = sl::io::lz4_options();
+            opts.block_size = block_size;
+            opts.block_checksum = checksums;
+            opts.content_checksum = checksums;
+            auto compressed = compress(data, opts);
+            slassert(compressed.length() < data.length() / 4);
+            slassert(data == decompress(compressed));
+        }
+    }
+    auto opts = sl::io::lz4_options();
+    opts.acceleration = 8;
+    slassert(data == decompress(compress(data, opts)));
+}
+
+void test_incompressible() {
+    std::string data;
+    uint32_t state = 42;
+    for (size_t i = 0; i < 100000; i++) {
+        state = state * 1103515245 + 12345;
+        data.push_back(static_cast<char>(state >> 24));
+    }
+    auto compressed = compress(data, sl::io::lz4_options());
+    // blocks are stored uncompressed
+    slassert(compressed.length() < data.length() + 32);
+    slassert(data == decompress(compressed));
+}
+
+void test_empty() {
+    auto compressed = compress("", sl::io::lz4_options());
+    slassert(15 == compressed.length());
+    slassert(decompress(compressed).empty());
+}
+
+void test_dictionary() {
+    auto data = make_data(300000);
+    auto opts = sl::io::lz4_options();
+    opts.dictionary = data.substr(30000, 30000);
+    opts.dictionary_id = 42;
+    auto part = data.substr(10000, 1000);
+    auto compressed = compress(part, opts);
+    slassert(compressed.length() < compress(part, sl::io::lz4_options()).length() / 4);
+    slassert(part == decompress(compressed, opts.dictionary));
+    slassert(throws_exc([&compressed] {
+        decompress(compressed);
+    }));
+}
+
+void test_workers() {
+    auto data = make_data(300000) + make_data(300000) + make_data(300000) + make_data(300000);
+    auto opts = sl::io::lz4_options();
+    opts.block_checksum = true;
+    auto expected = compress(data, opts);
+    for (size_t workers : {1, 2, 4}) {
+        opts.workers = workers;
+        // blocks are independent, output does not depend on the number of workers
+        slassert(expected == compress(data, opts));
+    }
+}
+
+void test_content_size() {
+    auto data = make_data(300000);
+    auto src = sl::io::make_limited_source(sl::io::array_source(data.data(), data.length()), 1000);
+    auto opts = sl::io::lz4_options();
+    opts.content_size = sl::io::size_hint(src);
+    slassert(1000 == opts.content_size);
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = sl::io::make_lz4_sink(dest, opts);
+        sl::io::copy_all(src, sink);
+    }
+    auto lz4src = sl::io::make_lz4_source(sl::io::string_source(dest.get_string()));
+    char ch = '\0';
+    lz4src.read({std::addressof(ch), 1});
+    slassert(1000 == lz4src.get_content_size());
+    slassert(data.substr(0, 1000) == decompress(dest.get_string()));
+    // size mismatch
+    slassert(throws_exc([&dest, &opts] {
+        auto sink = sl::io::make_lz4_sink(dest, opts);
+        sl::io::write_all(sink, {"foo", 3});
+        sink.finish();
+    }));
+}
+
+void test_flush() {
+    auto two_bytes = two_bytes_at_once_sink();
+    auto sink = sl::io::make_lz4_sink(two_bytes);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.flush();
+    // frame is not completed, but written data can be decompressed
+    auto src = sl::io::make_lz4_source(sl::io::string_source(two_bytes.get_data()));
+    std::string res(3, '\0');
+    sl::io::read_exact(src, {std::addressof(res.front()), res.length()});
+    slassert("foo" == res);
+    slassert(throws_exc([&src] {
+        char ch;
+        src.read({std::addressof(ch), 1});
+    }));
+    sl::io::write_all(sink, {"bar", 3});
+    sink.finish();
+    slassert("foobar" == decompress(two_bytes.get_data()));
+    // no-op after finish
+    sink.finish();
+    slassert(throws_exc([&sink] {
+        sl::io::write_all(sink, {"baz", 3});
+    }));
+}
+
+void test_reset() {
+    auto dest = sl::io::string_sink();
+    auto sink = sl::io::make_lz4_sink(dest);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.finish();
+    // next frame is written into the same sink
+    sink.reset();
+    sl::io::write_all(sink, {"bar", 3});
+    sink.finish();
+    slassert("foobar" == decompress(dest.get_string()));
+
+    auto other = sl::io::string_sink();
+    sink.reset(sl::io::make_reference_sink(other));
+    sl::io::write_all(sink, {"baz", 3});
+    sink.finish();
+    slassert("baz" == decompress(other.get_string()));
+}
+
+void test_invalid() {
+    auto dest = sl::io::string_sink();
+    slassert(throws_exc([&dest] {
+        auto opts = sl::io::lz4_options();
+        opts.block_size = 100000;
+        sl::io::make_lz4_sink(dest, opts);
+    }));
+}
+
+int main() {
+    try {
+        test_known();
+        test_roundtrip();
+        test_incompressible();
+        test_empty();
+        test_dictionary();
+        test_workers();
+        test_content_size();
+        test_flush();
+        test_reset();
+        test_invalid();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
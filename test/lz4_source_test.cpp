@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   lz4_source_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 11:59 PM
+ */
+#include "staticlib/io/lz4_source.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+const std::string hello = "hello hello hello hello world";
+// compressed with lz4 tool
+const std::string hello_lz4 = "04224d186440a70f0000006e68656c6c6f20060050776f726c6400000000e5fc6ad1";
+const std::string hello_content_size = "04224d186c401d000000000000003e0f0000006e68656c6c6f20060050776f726c6400000000e5fc6ad1";
+const std::string hello_block_checksum = "04224d187040ad0f0000006e68656c6c6f20060050776f726c64788ee6e400000000";
+const std::string fox = "quick brown fox jumps over the lazy dog!";
+const std::string fox_dictionary = "the quick brown fox jumps over the lazy dog";
+const std::string fox_lz4 = "04224d186440a70a0000000f2700105020646f672100000000ef541ef6";
+
+std::string decompress(const std::string& hex, const std::string& dictionary = "") {
+    auto src = sl::io::make_lz4_source(sl::io::string_source(sl::io::string_from_hex(hex)), dictionary);
+    return read_string(src);
+}
+
+void test_known() {
+    slassert(hello == decompress(hello_lz4));
+    slassert(hello == decompress(hello_block_checksum));
+    auto src = sl::io::make_lz4_source(sl::io::string_source(sl::io::string_from_hex(hello_content_size)));
+    slassert(-1 == src.get_content_size());
+    slassert(hello == read_string(src));
+    slassert(29 == src.get_content_size());
+}
+
+void test_dictionary() {
+    slassert(fox == decompress(fox_lz4, fox_dictionary));
+}
+
+void test_chunks() {
+    auto src = sl::io::make_lz4_source(two_bytes_at_once_source(sl::io::string_from_hex(hello_block_checksum)));
+    std::string res;
+    char ch = '\0';
+    while (std::char_traits<char>::eof() != src.read({std::addressof(ch), 1})) {
+        res.push_back(ch);
+    }
+    slassert(hello == res);
+}
+
+void test_multi_frame() {
+    // "foo" and "bar" frames with skippable frame between them
+    slassert("foobar" == decompress(
+            "04224d186440a703000080666f6f00000000d90d0fe2"
+            "502a4d1804000000deadbeef"
+            "04224d186440a703000080626172000000002c2ba241"));
+}
+
+void test_reset() {
+    auto src = sl::io::make_lz4_source(sl::io::string_source(sl::io::string_from_hex(hello_lz4)));
+    slassert(hello == read_string(src));
+    src.reset(sl::io::string_source(sl::io::string_from_hex(hello_content_size)));
+    slassert(hello == read_string(src));
+}
+
+void test_invalid() {
+    slassert(throws_exc([] {
+        decompress(hello_lz4.substr(0, hello_lz4.length() - 2));
+    }));
+    slassert(throws_exc([] {
+        // content checksum
+        decompress(hello_lz4.substr(0, hello_lz4.length() - 2) + "d0");
+    }));
+    slassert(throws_exc([] {
+        // block checksum
+        decompress(hello_block_checksum.substr(0, 50) + "00" + hello_block_checksum.substr(52));
+    }));
+    slassert(throws_exc([] {
+        // header checksum
+        decompress("04224d186440a8" + hello_lz4.substr(14));
+    }));
+    slassert(throws_exc([] {
+        decompress(fox_lz4);
+    }));
+    slassert(throws_exc([] {
+        decompress("");
+    }));
+    slassert(throws_exc([] {
+        decompress("0102030405060708");
+    }));
+}
+
+int main() {
+    try {
+        test_known();
+        test_dictionary();
+        test_chunks();
+        test_multi_frame();
+        test_reset();
+        test_invalid();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
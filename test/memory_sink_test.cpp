@@ -54,9 +54,57 @@ void test_write() {
     slassert(thrown);
 }
 
+void test_partial() {
+    auto dest = std::array<char, 4>();
+    auto sink = sl::io::memory_sink(sl::io::make_span(dest), true);
+    slassert(3 == sink.write({"foo", 3}));
+    slassert(1 == sink.write({"bar", 3}));
+    slassert(0 == sink.write({"baz", 3}));
+    slassert(4 == sink.get_count());
+    slassert(0 == sink.get_available());
+    slassert("foob" == std::string(dest.data(), dest.size()));
+
+    // reuse
+    sink.reset();
+    slassert(4 == sink.get_available());
+    slassert(2 == sink.write({"42", 2}));
+    slassert("42ob" == std::string(dest.data(), dest.size()));
+}
+
+void test_write_at() {
+    auto dest = std::array<char, 4>();
+    auto sink = sl::io::memory_sink(sl::io::make_span(dest));
+    slassert(2 == sink.write_at(2, {"ar", 2}));
+    slassert(2 == sink.write_at(0, {"ba", 2}));
+    slassert(0 == sink.get_count());
+    slassert("baar" == std::string(dest.data(), dest.size()));
+    bool thrown = false;
+    try {
+        sink.write_at(3, {"42", 2});
+    } catch(const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+void test_seek() {
+    auto dest = std::array<char, 4>();
+    auto sink = sl::io::memory_sink(sl::io::make_span(dest));
+    sl::io::write_all(sink, {"foob", 4});
+    slassert(4 == sink.tell());
+    slassert(4 == sink.size());
+    slassert(1 == sink.seek(1));
+    sl::io::write_all(sink, {"aa", 2});
+    slassert("faab" == std::string(dest.data(), dest.size()));
+    slassert(3 == sink.tell());
+}
+
 int main() {
     try {
         test_write();
+        test_partial();
+        test_write_at();
+        test_seek();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
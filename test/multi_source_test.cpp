@@ -26,9 +26,12 @@
 #include <iostream>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/buffered_source.hpp"
 #include "staticlib/io/operations.hpp"
 #include "staticlib/io/string_source.hpp"
 
@@ -73,9 +76,135 @@ void test_multi() {
     slassert("foobar1baz" == sink2.get_string());
 }
 
+void test_skip() {
+    auto data = std::string("foobar");
+    auto vec = std::vector<sl::io::array_source>();
+    vec.emplace_back(data.data(), 3);
+    vec.emplace_back(data.data() + 3, 3);
+    auto multi = sl::io::make_multi_source(std::move(vec));
+    sl::io::skip(multi, 4);
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(multi, sink);
+    slassert("ar" == sink.get_string());
+
+    auto list = std::list<two_bytes_at_once_source>();
+    list.push_back(two_bytes_at_once_source("foo"));
+    list.push_back(two_bytes_at_once_source("bar"));
+    auto multi_read = sl::io::make_multi_source(std::move(list));
+    sl::io::skip(multi_read, 5);
+    std::array<char, 2> buf;
+    slassert(1 == multi_read.read({buf.data(), 2}));
+    slassert('r' == buf[0]);
+    bool thrown = false;
+    try {
+        sl::io::skip(multi_read, 1);
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+// skips without reading, reading is not allowed
+class skipping_source {
+    size_t len;
+    size_t pos = 0;
+
+public:
+    explicit skipping_source(size_t len) :
+    len(len) { }
+
+    std::streamsize read(sl::io::span<char>) {
+        throw sl::io::io_exception("read not allowed");
+    }
+
+    void skip(size_t to_skip) {
+        if (to_skip > len - pos) throw sl::io::io_exception("skip beyond end");
+        pos += to_skip;
+    }
+
+    size_t seek(std::streamsize offset, std::ios_base::seekdir) {
+        pos += static_cast<size_t>(offset);
+        return pos;
+    }
+
+    size_t tell() {
+        return pos;
+    }
+
+    size_t size() {
+        return len;
+    }
+};
+
+// always returns zero bytes
+class stalled_source {
+public:
+    std::streamsize read(sl::io::span<char>) {
+        return 0;
+    }
+};
+
+void test_skip_children() {
+    auto skipping = std::vector<skipping_source>();
+    skipping.emplace_back(3);
+    skipping.emplace_back(3);
+    auto multi_skip = sl::io::make_multi_source(std::move(skipping));
+    sl::io::skip(multi_skip, 5);
+    bool thrown = false;
+    try {
+        sl::io::skip(multi_skip, 2);
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+
+    auto buffered = std::list<sl::io::buffered_source<two_bytes_at_once_source>>();
+    buffered.emplace_back(two_bytes_at_once_source("foo"));
+    buffered.emplace_back(two_bytes_at_once_source("bar"));
+    auto multi_buf = sl::io::make_multi_source(std::move(buffered));
+    std::array<char, 1> ch;
+    slassert(1 == multi_buf.read(ch));
+    slassert('f' == ch[0]);
+    sl::io::skip(multi_buf, 3);
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(multi_buf, sink);
+    slassert("ar" == sink.get_string());
+
+    auto stalled = std::vector<stalled_source>();
+    stalled.emplace_back();
+    auto multi_stalled = sl::io::make_multi_source(std::move(stalled));
+    bool stalled_thrown = false;
+    try {
+        sl::io::skip(multi_stalled, 1);
+    } catch (const sl::io::io_exception&) {
+        stalled_thrown = true;
+    }
+    slassert(stalled_thrown);
+}
+
+void test_borrow_read() {
+    auto data = std::string("foobar");
+    auto vec = std::vector<sl::io::array_source>();
+    vec.emplace_back(data.data(), 3);
+    vec.emplace_back(data.data(), 0);
+    vec.emplace_back(data.data() + 3, 3);
+    auto multi = sl::io::make_multi_source(std::move(vec));
+    auto chunk = multi.borrow_read(2);
+    slassert(data.data() == chunk.data());
+    slassert(2 == chunk.size());
+    slassert(1 == multi.borrow_read(4).size());
+    chunk = multi.borrow_read(4);
+    slassert("bar" == std::string(chunk.data(), chunk.size()));
+    slassert(0 == multi.borrow_read(4).size());
+    slassert(!sl::io::has_borrow_read<sl::io::multi_source<std::list<two_bytes_at_once_source>>>::value);
+}
+
 int main() {
     try {
         test_multi();
+        test_skip();
+        test_skip_children();
+        test_borrow_read();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -24,13 +24,25 @@
 #include "staticlib/io/operations.hpp"
 
 #include <array>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/buffered_source.hpp"
+#include "staticlib/io/counting_source.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/limited_source.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
 #include "two_bytes_at_once_source.hpp"
 #include "two_bytes_at_once_sink.hpp"
+#include "test_utils.hpp"
 
 void test_write_not_all() {
     two_bytes_at_once_sink sink{};
@@ -106,6 +118,25 @@ void test_copy_stackbuf() {
     slassert("abc" == sink.get_data());
 }
 
+void test_copy_next_chunk() {
+    two_bytes_at_once_sink sink{};
+    auto data = std::string("abc");
+    auto src = sl::io::array_source(data);
+    // buffer is not used
+    auto copied = sl::io::copy_all(src, sink, sl::io::span<char>(nullptr, 0));
+    slassert(3 == copied);
+    slassert("abc" == sink.get_data());
+}
+
+void test_copy_borrow_read() {
+    two_bytes_at_once_sink sink{};
+    auto src = sl::io::make_buffered_source(two_bytes_at_once_source{"abc"});
+    // buffer is not used
+    auto copied = sl::io::copy_all(src, sink, sl::io::span<char>(nullptr, 0));
+    slassert(3 == copied);
+    slassert("abc" == sink.get_data());
+}
+
 void test_skip() {
     two_bytes_at_once_source src{"abc"};
     std::array<char, 1> buf;
@@ -119,6 +150,180 @@ void test_replace() {
     slassert("42bar43" == sl::io::str_replace("42{{foo}}43", {{"foo", "bar"}}));
 }
 
+void test_skip_dispatch() {
+    // seek
+    auto data = std::string("abcdef");
+    auto arr = sl::io::array_source(data.data(), data.length());
+    sl::io::skip(arr, 4);
+    slassert(4 == arr.tell());
+    slassert(throws_exc([&arr] { sl::io::skip(arr, 3); }));
+
+    // consume buffer, then seek underlying source
+    auto buffered = sl::io::make_buffered_source(sl::io::array_source(data.data(), data.length()));
+    std::array<char, 1> buf;
+    slassert(1 == buffered.read({buf.data(), 1}));
+    slassert(6 == buffered.get_source().tell());
+    sl::io::skip(buffered, 3);
+    slassert(1 == buffered.read({buf.data(), 1}));
+    slassert('e' == buf[0]);
+
+    // empty buffer with non-seekable source
+    two_bytes_at_once_source src{"abc"};
+    slassert(throws_exc([&src] { sl::io::skip(src, sl::io::span<char>(nullptr, 0), 1); }));
+}
+
+void test_size_hint() {
+    auto data = std::string("abcdef");
+    auto arr = sl::io::array_source(data.data(), data.length());
+    slassert(6 == sl::io::size_hint(arr));
+    std::array<char, 2> buf;
+    arr.read({buf.data(), 2});
+    slassert(4 == sl::io::size_hint(arr));
+    auto limited = sl::io::make_limited_source(sl::io::array_source(data.data(), data.length()), 3);
+    slassert(3 == sl::io::size_hint(limited));
+    auto counting = sl::io::make_counting_source(sl::io::array_source(data.data(), data.length()));
+    slassert(6 == sl::io::size_hint(counting));
+    // unknown size
+    two_bytes_at_once_source two_bytes{"abc"};
+    slassert(-1 == sl::io::size_hint(two_bytes));
+}
+
+void test_read_write_endian() {
+    auto sink = sl::io::string_sink();
+    sl::io::write_le<uint16_t>(sink, 0x1234);
+    sl::io::write_be<uint16_t>(sink, 0x1234);
+    sl::io::write_le<int32_t>(sink, -2);
+    sl::io::write_be<uint64_t>(sink, 0x0102030405060708);
+    sl::io::write_be(sink, 1.5);
+    sl::io::write_le(sink, 0.25f);
+    slassert("34121234feffffff0102030405060708" "3ff8000000000000" "0000803e" ==
+            sl::io::string_to_hex(sink.get_string()));
+    // lending and non-lending sources
+    auto borrowing = sl::io::string_source(sink.get_string());
+    auto two_bytes = two_bytes_at_once_source(sink.get_string());
+    slassert(0x1234 == sl::io::read_le<uint16_t>(borrowing));
+    slassert(0x1234 == sl::io::read_le<uint16_t>(two_bytes));
+    slassert(0x1234 == sl::io::read_be<uint16_t>(borrowing));
+    slassert(0x1234 == sl::io::read_be<uint16_t>(two_bytes));
+    slassert(-2 == sl::io::read_le<int32_t>(borrowing));
+    slassert(-2 == sl::io::read_le<int32_t>(two_bytes));
+    slassert(0x0102030405060708 == sl::io::read_be<uint64_t>(borrowing));
+    slassert(0x0102030405060708 == sl::io::read_be<uint64_t>(two_bytes));
+    slassert(1.5 == sl::io::read_be<double>(borrowing));
+    slassert(1.5 == sl::io::read_be<double>(two_bytes));
+    slassert(0.25f == sl::io::read_le<float>(borrowing));
+    slassert(0.25f == sl::io::read_le<float>(two_bytes));
+    slassert(throws_exc([&borrowing] {
+        sl::io::read_le<uint8_t>(borrowing);
+    }));
+    slassert(throws_exc([&two_bytes] {
+        sl::io::read_le<uint8_t>(two_bytes);
+    }));
+}
+
+void test_read_buffer_boundary() {
+    auto sink = sl::io::string_sink();
+    sl::io::write_le<uint8_t>(sink, 42);
+    for (uint64_t i = 0; i < 1000; i++) {
+        sl::io::write_be(sink, i * 0x0101010101010101);
+    }
+    // values cross the end of the internal buffer
+    auto src = sl::io::make_buffered_source(two_bytes_at_once_source(sink.get_string()));
+    slassert(42 == sl::io::read_le<uint8_t>(src));
+    for (uint64_t i = 0; i < 1000; i++) {
+        slassert(i * 0x0101010101010101 == sl::io::read_be<uint64_t>(src));
+    }
+}
+
+template<typename T, typename Sink>
+std::string write_array_scalar(Sink& sink, const std::vector<T>& values, bool little_endian) {
+    for (T val : values) {
+        if (little_endian) {
+            sl::io::write_le(sink, val);
+        } else {
+            sl::io::write_be(sink, val);
+        }
+    }
+    return sink.get_string();
+}
+
+template<typename T>
+void check_array(const std::vector<T>& values) {
+    auto scalar_le = sl::io::string_sink();
+    auto scalar_be = sl::io::string_sink();
+    write_array_scalar(scalar_le, values, true);
+    write_array_scalar(scalar_be, values, false);
+    // sink buffer is used
+    auto sink_le = sl::io::string_sink();
+    sl::io::write_le_array<T>(sink_le, {values.data(), values.size()});
+    slassert(scalar_le.get_string() == sink_le.get_string());
+    auto sink_be = sl::io::string_sink();
+    sl::io::write_be_array<T>(sink_be, {values.data(), values.size()});
+    slassert(scalar_be.get_string() == sink_be.get_string());
+    // stack buffer is used
+    auto two_bytes = two_bytes_at_once_sink();
+    sl::io::write_be_array<T>(two_bytes, {values.data(), values.size()});
+    slassert(scalar_be.get_string() == two_bytes.get_data());
+    std::vector<T> read(values.size());
+    auto src_be = two_bytes_at_once_source(scalar_be.get_string());
+    sl::io::read_be_array<T>(src_be, {read.data(), read.size()});
+    slassert(values == read);
+    auto src_le = sl::io::string_source(scalar_le.get_string());
+    sl::io::read_le_array<T>(src_le, {read.data(), read.size()});
+    slassert(values == read);
+}
+
+void test_arrays() {
+    std::vector<uint16_t> u16;
+    std::vector<int32_t> i32;
+    std::vector<uint64_t> u64;
+    std::vector<double> dbl;
+    for (size_t i = 0; i < 2053; i++) {
+        u16.push_back(static_cast<uint16_t>(i * 0x9e37));
+        i32.push_back(static_cast<int32_t>(i * 0x9e3779b9));
+        u64.push_back(static_cast<uint64_t>(i) * 0x9e3779b97f4a7c15);
+        dbl.push_back(static_cast<double>(i) / 3);
+    }
+    check_array(u16);
+    check_array(i32);
+    check_array(u64);
+    check_array(dbl);
+    slassert(throws_exc([] {
+        std::array<uint32_t, 2> arr;
+        auto src = sl::io::string_source(std::string(7, 'a'));
+        sl::io::read_le_array<uint32_t>(src, {arr.data(), arr.size()});
+    }));
+}
+
+void test_varint_zigzag() {
+    auto sink = sl::io::string_sink();
+    sl::io::write_varint(sink, 0);
+    sl::io::write_varint(sink, 300);
+    sl::io::write_varint(sink, std::numeric_limits<uint64_t>::max());
+    slassert("00ac02ffffffffffffffffff01" == sl::io::string_to_hex(sink.get_string()));
+    auto src = two_bytes_at_once_source(sink.get_string());
+    slassert(0 == sl::io::read_varint(src));
+    slassert(300 == sl::io::read_varint(src));
+    slassert(std::numeric_limits<uint64_t>::max() == sl::io::read_varint(src));
+    slassert(throws_exc([] {
+        auto src = sl::io::string_source(std::string(10, '\xff') + '\x02');
+        sl::io::read_varint(src);
+    }));
+    slassert(throws_exc([] {
+        auto src = sl::io::string_source(std::string(1, '\x80'));
+        sl::io::read_varint(src);
+    }));
+    slassert(0 == sl::io::zigzag_encode(0));
+    slassert(1 == sl::io::zigzag_encode(-1));
+    slassert(2 == sl::io::zigzag_encode(1));
+    slassert(3 == sl::io::zigzag_encode(-2));
+    slassert(std::numeric_limits<uint64_t>::max() == sl::io::zigzag_encode(std::numeric_limits<int64_t>::min()));
+    for (int64_t val : {int64_t(0), int64_t(-1), int64_t(63), int64_t(-64), std::numeric_limits<int64_t>::max(),
+            std::numeric_limits<int64_t>::min()}) {
+        slassert(val == sl::io::zigzag_decode(sl::io::zigzag_encode(val)));
+    }
+}
+
 int main() {
     try {
         test_write_not_all();
@@ -129,8 +334,16 @@ int main() {
         test_read_exact();
         test_copy();
         test_copy_stackbuf();
+        test_copy_next_chunk();
+        test_copy_borrow_read();
         test_skip();
         test_replace();
+        test_skip_dispatch();
+        test_size_hint();
+        test_read_write_endian();
+        test_read_buffer_boundary();
+        test_arrays();
+        test_varint_zigzag();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   parallel_block_compress_sink_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 2:40 AM
+ */
+#include "staticlib/io/parallel_block_compress_sink.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/deflate_sink.hpp"
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/inflate_source.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_sink.hpp"
+
+std::string inflate(const std::string& compressed) {
+    auto src = sl::io::make_inflate_source(sl::io::string_source(compressed), sl::io::deflate_format::gzip);
+    return read_string(src);
+}
+
+std::string compress(const std::string& data, const sl::io::parallel_block_options& options) {
+    // uneven writes
+    return write_string(data, [&options](sl::io::string_sink& dest) {
+        return sl::io::make_parallel_block_compress_sink(dest, options);
+    }, 1000);
+}
+
+void test_roundtrip() {
+    auto data = make_data(1000000);
+    auto single = sl::io::string_sink();
+    {
+        auto sink = sl::io::make_deflate_sink(single, sl::io::deflate_format::gzip);
+        sl::io::write_all(sink, data);
+    }
+    for (size_t workers : {1, 2, 4}) {
+        for (size_t block_size : {1000, 1 << 17, 1 << 20}) {
+            auto opts = sl::io::parallel_block_options();
+            opts.workers = workers;
+            opts.block_size = block_size;
+            auto compressed = compress(data, opts);
+            slassert(data == inflate(compressed));
+            if (block_size > 1000) {
+                slassert(compressed.length() < single.get_string().length() * 2);
+            }
+        }
+    }
+    // output does not depend on the number of workers
+    auto opts = sl::io::parallel_block_options();
+    opts.workers = 1;
+    auto expected = compress(data, opts);
+    opts.workers = 3;
+    opts.max_in_flight = 4;
+    slassert(expected == compress(data, opts));
+}
+
+void test_levels() {
+    auto data = make_data(1000000);
+    for (int level : {0, 1, 9}) {
+        auto opts = sl::io::parallel_block_options();
+        opts.level = level;
+        opts.workers = 2;
+        slassert(data == inflate(compress(data, opts)));
+    }
+}
+
+void test_bgzf() {
+    auto data = make_data(1000000);
+    auto opts = sl::io::parallel_block_options();
+    opts.format = sl::io::parallel_block_format::bgzf;
+    opts.workers = 2;
+    opts.collect_index = true;
+    auto dest = sl::io::string_sink();
+    auto sink = sl::io::make_parallel_block_compress_sink(dest, opts);
+    sl::io::write_all(sink, data);
+    sink.finish();
+    const std::string& compressed = dest.get_string();
+    slassert(data == inflate(compressed));
+    // EOF block
+    slassert("1f8b08040000000000ff0600424302001b0003000000000000000000" ==
+            sl::io::string_to_hex(compressed.substr(compressed.length() - 28)));
+    // BSIZE fields and index match
+    auto& index = sink.get_index();
+    slassert(index.size() == (data.length() + 0xff00 - 1) / 0xff00);
+    size_t pos = 0;
+    for (size_t i = 0; i < index.size(); i++) {
+        slassert(pos == index[i].compressed_offset);
+        slassert(i * 0xff00 == index[i].uncompressed_offset);
+        size_t bsize = static_cast<unsigned char>(compressed[pos + 16]) |
+                (static_cast<unsigned char>(compressed[pos + 17]) << 8);
+        // random access to a single block
+        auto block = inflate(compressed.substr(pos, bsize + 1));
+        slassert(data.substr(i * 0xff00, 0xff00) == block);
+        pos += bsize + 1;
+    }
+    slassert(compressed.length() - 28 == pos);
+}
+
+void test_bgzf_incompressible() {
+    std::string data;
+    uint32_t state = 42;
+    for (size_t i = 0; i < 200000; i++) {
+        state = state * 1103515245 + 12345;
+        data.push_back(static_cast<char>(state >> 24));
+    }
+    auto opts = sl::io::parallel_block_options();
+    opts.format = sl::io::parallel_block_format::bgzf;
+    opts.workers = 2;
+    auto compressed = compress(data, opts);
+    slassert(data == inflate(compressed));
+}
+
+void test_empty() {
+    auto compressed = compress("", sl::io::parallel_block_options());
+    slassert(20 == compressed.length());
+    slassert(inflate(compressed).empty());
+    auto opts = sl::io::parallel_block_options();
+    opts.format = sl::io::parallel_block_format::bgzf;
+    // EOF block only
+    slassert(28 == compress("", opts).length());
+}
+
+void test_flush() {
+    auto two_bytes = two_bytes_at_once_sink();
+    auto sink = sl::io::make_parallel_block_compress_sink(two_bytes);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.flush();
+    // all written data is compressed into complete members
+    slassert("foo" == inflate(two_bytes.get_data()));
+    sl::io::write_all(sink, {"bar", 3});
+    sink.finish();
+    slassert("foobar" == inflate(two_bytes.get_data()));
+    // no-op after finish
+    sink.finish();
+    slassert(throws_exc([&sink] {
+        sl::io::write_all(sink, {"baz", 3});
+    }));
+}
+
+void test_reset() {
+    auto dest = sl::io::string_sink();
+    auto sink = sl::io::make_parallel_block_compress_sink(dest);
+    sl::io::write_all(sink, {"foo", 3});
+    sink.finish();
+    sink.reset();
+    sl::io::write_all(sink, {"bar", 3});
+    sink.finish();
+    slassert("foobar" == inflate(dest.get_string()));
+
+    auto other = sl::io::string_sink();
+    sink.reset(sl::io::make_reference_sink(other));
+    sl::io::write_all(sink, {"baz", 3});
+    sink.finish();
+    slassert("baz" == inflate(other.get_string()));
+}
+
+void test_move() {
+    auto dest = sl::io::string_sink();
+    auto sink = sl::io::make_parallel_block_compress_sink(dest);
+    sl::io::write_all(sink, {"foo", 3});
+    auto moved = std::move(sink);
+    sl::io::write_all(moved, {"bar", 3});
+    moved.finish();
+    slassert("foobar" == inflate(dest.get_string()));
+}
+
+void test_invalid() {
+    auto dest = sl::io::string_sink();
+    slassert(throws_exc([&dest] {
+        auto opts = sl::io::parallel_block_options();
+        opts.level = 10;
+        sl::io::make_parallel_block_compress_sink(dest, opts);
+    }));
+    slassert(throws_exc([&dest] {
+        auto opts = sl::io::parallel_block_options();
+        opts.block_size = 0;
+        sl::io::make_parallel_block_compress_sink(dest, opts);
+    }));
+}
+
+int main() {
+    try {
+        test_roundtrip();
+        test_levels();
+        test_bgzf();
+        test_bgzf_incompressible();
+        test_empty();
+        test_flush();
+        test_reset();
+        test_move();
+        test_invalid();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
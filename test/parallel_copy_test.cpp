@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   parallel_copy_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 6:45 PM
+ */
+
+#include "staticlib/io/parallel_copy.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/memory_sink.hpp"
+
+void test_copy() {
+    auto data = std::string();
+    for (size_t i = 0; i < 100000; i++) {
+        data.push_back(static_cast<char>('a' + (i * 7 % 26)));
+    }
+    auto src = sl::io::array_source(data.data(), data.length());
+    auto dest = std::vector<char>(data.length());
+    auto sink = sl::io::memory_sink(sl::io::make_span(dest));
+    auto copied = sl::io::parallel_copy(src, sink, 4, 1000, 300);
+    slassert(data.length() == copied);
+    slassert(data == std::string(dest.data(), dest.size()));
+}
+
+void test_empty() {
+    auto src = sl::io::array_source(nullptr, 0);
+    auto sink = sl::io::memory_sink(sl::io::span<char>(nullptr, 0));
+    slassert(0 == sl::io::parallel_copy(src, sink, 4));
+}
+
+void test_error() {
+    auto data = std::string(10000, 'a');
+    auto src = sl::io::array_source(data.data(), data.length());
+    auto dest = std::vector<char>(5000);
+    auto sink = sl::io::memory_sink(sl::io::make_span(dest));
+    bool thrown = false;
+    try {
+        sl::io::parallel_copy(src, sink, 4, 1000, 300);
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+}
+
+// reports larger size, than it can read
+class short_source {
+    sl::io::array_source src;
+
+public:
+    explicit short_source(const std::string& data, size_t available) :
+    src(data.data(), available) { }
+
+    std::streamsize read_at(size_t offset, sl::io::span<char> span) {
+        std::streamsize res = src.read_at(offset, span);
+        return std::char_traits<char>::eof() != res ? res : 0;
+    }
+
+    size_t size() {
+        return 10000;
+    }
+};
+
+void test_short_read() {
+    auto data = std::string(10000, 'a');
+    auto src = short_source(data, 5000);
+    auto dest = std::vector<char>(10000);
+    auto sink = sl::io::memory_sink(sl::io::make_span(dest));
+    bool thrown = false;
+    try {
+        sl::io::parallel_copy(src, sink, 4, 1000, 300);
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    slassert(thrown);
+
+    // data ends inside the last range
+    auto src_last = short_source(data, 9500);
+    slassert(9500 == sl::io::parallel_copy(src_last, sink, 4, 1000, 300));
+}
+
+int main() {
+    try {
+        test_copy();
+        test_empty();
+        test_error();
+        test_short_read();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
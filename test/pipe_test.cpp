@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipe_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 12:25 PM
+ */
+
+#include "staticlib/io/pipe.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+void test_copy() {
+    auto pipe = sl::io::make_pipe(7);
+    auto expected = std::string();
+    for (size_t i = 0; i < 100000; i++) {
+        expected.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    auto writer = std::thread([&pipe, &expected] {
+        auto sink = std::move(pipe.first);
+        auto src = sl::io::string_source(expected);
+        auto buf = std::array<char, 5>();
+        sl::io::copy_all(src, sink, buf);
+    });
+    auto sink = sl::io::string_sink();
+    auto buf = std::array<char, 3>();
+    sl::io::copy_all(pipe.second, sink, buf);
+    writer.join();
+    slassert(expected == sink.get_string());
+}
+
+void test_error() {
+    auto pipe = sl::io::make_pipe(16);
+    auto writer = std::thread([&pipe] {
+        auto sink = std::move(pipe.first);
+        sl::io::write_all(sink, {"foo", 3});
+        sink.close_with_error(std::make_exception_ptr(sl::io::io_exception("fail")));
+    });
+    writer.join();
+    auto buf = std::array<char, 16>();
+    slassert(3 == pipe.second.read(sl::io::make_span(buf)));
+    bool thrown = false;
+    try {
+        pipe.second.read(sl::io::make_span(buf));
+    } catch (const sl::io::io_exception& e) {
+        thrown = "fail" == std::string(e.what());
+    }
+    slassert(thrown);
+}
+
+void test_reader_close() {
+    auto pipe = sl::io::make_pipe(2);
+    auto reader = std::thread([&pipe] {
+        auto buf = std::array<char, 1>();
+        pipe.second.read(sl::io::make_span(buf));
+        pipe.second.close();
+    });
+    bool thrown = false;
+    try {
+        for (;;) {
+            sl::io::write_all(pipe.first, {"foo", 3});
+        }
+    } catch (const sl::io::io_exception&) {
+        thrown = true;
+    }
+    reader.join();
+    slassert(thrown);
+}
+
+int main() {
+    try {
+        test_copy();
+        test_error();
+        test_reader_close();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
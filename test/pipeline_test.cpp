@@ -0,0 +1,161 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   pipeline_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 2:40 PM
+ */
+
+#include "staticlib/io/pipeline.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/memory_sink.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+void test_source() {
+    auto src = sl::io::string_source("666f6f626172") | sl::io::limit(8) | sl::io::hex_decode() | sl::io::count();
+    static_assert(std::is_same<decltype(src), sl::io::counting_source<sl::io::hex_source<
+            sl::io::limited_source<sl::io::string_source>>>>::value, "pipeline type");
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("foob" == sink.get_string());
+    slassert(4 == src.get_count());
+}
+
+void test_collapse() {
+    auto limited = sl::io::string_source("foobar") | sl::io::limit(3) | sl::io::count();
+    static_assert(std::is_same<decltype(limited), sl::io::limited_source<sl::io::string_source>>::value,
+            "count after limit");
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(limited, sink);
+    slassert("foo" == sink.get_string());
+    slassert(3 == limited.get_count());
+
+    auto lending = sl::io::string_source("foo") | sl::io::buffer();
+    static_assert(std::is_same<decltype(lending), sl::io::string_source>::value, "buffer of lending source");
+    auto buffered = two_bytes_at_once_source("foo") | sl::io::buffer() | sl::io::hex_decode();
+    static_assert(std::is_same<decltype(buffered), sl::io::hex_source<
+            sl::io::buffered_source<two_bytes_at_once_source>>>::value, "buffer of plain source");
+}
+
+void test_count_wraps() {
+    std::array<char, 8> arr;
+    auto mem = sl::io::memory_sink(sl::io::make_span(arr));
+    auto sink = mem | sl::io::count();
+    static_assert(std::is_same<decltype(sink), sl::io::counting_sink<
+            sl::io::reference_sink<sl::io::memory_sink>>>::value, "memory sink is wrapped");
+    sl::io::write_all(sink, {"foo", 3});
+    mem.seek(1);
+    slassert(3 == sink.get_count());
+
+    auto prior = sl::io::make_counting_source(sl::io::string_source("foobar"));
+    std::array<char, 2> buf;
+    sl::io::read_exact(prior, buf);
+    auto src = std::move(prior) | sl::io::count();
+    static_assert(std::is_same<decltype(src), sl::io::counting_source<
+            sl::io::counting_source<sl::io::string_source>>>::value, "counting source is wrapped");
+    auto dest = sl::io::string_sink();
+    sl::io::copy_all(src, dest);
+    slassert(4 == src.get_count());
+}
+
+void test_lvalue() {
+    auto str = sl::io::string_source("foobar");
+    auto src = str | sl::io::limit(2);
+    static_assert(std::is_same<decltype(src), sl::io::limited_source<
+            sl::io::reference_source<sl::io::string_source>>>::value, "lvalue source");
+    std::array<char, 4> buf;
+    slassert(2 == sl::io::read_all(src, buf));
+    slassert(2 == str.tell());
+}
+
+void test_sink() {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = dest | sl::io::count() | sl::io::hex_encode();
+        sl::io::write_all(sink, {"foo", 3});
+        slassert(6 == sink.get_sink().get_count());
+    }
+    slassert("666f6f" == dest.get_string());
+
+    auto two_bytes = two_bytes_at_once_sink();
+    {
+        auto buffered = two_bytes | sl::io::buffer() | sl::io::count();
+        static_assert(std::is_same<decltype(buffered), sl::io::counting_sink<
+                sl::io::buffered_sink<sl::io::reference_sink<two_bytes_at_once_sink>>>>::value, "buffered sink");
+        sl::io::write_all(buffered, {"bar", 3});
+        slassert(0 == two_bytes.get_data().length());
+    }
+    slassert("bar" == two_bytes.get_data());
+}
+
+void test_deflate() {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = dest | sl::io::hex_encode() | sl::io::deflate(sl::io::deflate_format::gzip, 9);
+        static_assert(std::is_same<decltype(sink), sl::io::deflate_sink<
+                sl::io::hex_sink<sl::io::reference_sink<sl::io::string_sink>>>>::value, "deflate sink");
+        sl::io::write_all(sink, {"foobar", 6});
+    }
+    auto src = sl::io::string_source(dest.get_string()) | sl::io::hex_decode() |
+            sl::io::inflate(sl::io::deflate_format::gzip);
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("foobar" == sink.get_string());
+}
+
+void test_lz4_zstd() {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = dest | sl::io::zstd_compress() | sl::io::lz4_compress();
+        static_assert(std::is_same<decltype(sink), sl::io::lz4_sink<
+                sl::io::zstd_sink<sl::io::reference_sink<sl::io::string_sink>>>>::value, "lz4 sink");
+        sl::io::write_all(sink, {"foobar", 6});
+    }
+    auto src = sl::io::string_source(dest.get_string()) | sl::io::zstd_decompress() | sl::io::lz4_decompress();
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("foobar" == sink.get_string());
+}
+
+int main() {
+    try {
+        test_source();
+        test_collapse();
+        test_count_wraps();
+        test_lvalue();
+        test_sink();
+        test_deflate();
+        test_lz4_zstd();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
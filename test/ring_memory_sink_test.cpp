@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   ring_memory_sink_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 10:05 AM
+ */
+
+#include "staticlib/io/ring_memory_sink.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+void test_write() {
+    auto area = std::array<char, 4>();
+    sl::io::memory_ring ring(sl::io::make_span(area));
+    auto sink = sl::io::make_ring_memory_sink(ring);
+    slassert(3 == sink.write({"foo", 3}));
+    slassert(1 == sink.write({"bar", 3}));
+    slassert(0 == sink.write({"baz", 3}));
+    slassert(4 == ring.get_available());
+
+    // free some space and wrap around
+    auto buf = std::array<char, 3>();
+    slassert(3 == ring.read(sl::io::make_span(buf)));
+    slassert("foo" == std::string(buf.data(), buf.size()));
+    slassert(3 == sink.write({"baz", 3}));
+    auto out = std::array<char, 4>();
+    slassert(4 == ring.read(sl::io::make_span(out)));
+    slassert("bbaz" == std::string(out.data(), out.size()));
+}
+
+void test_close() {
+    auto area = std::array<char, 4>();
+    sl::io::memory_ring ring(sl::io::make_span(area));
+    auto sink = sl::io::make_ring_memory_sink(ring);
+    slassert(!ring.is_closed());
+    sink.close();
+    slassert(ring.is_closed());
+}
+
+int main() {
+    try {
+        test_write();
+        test_close();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   ring_memory_source_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 10:18 AM
+ */
+
+#include "staticlib/io/ring_memory_source.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/ring_memory_sink.hpp"
+
+void test_read() {
+    auto area = std::array<char, 4>();
+    sl::io::memory_ring ring(sl::io::make_span(area));
+    auto src = sl::io::make_ring_memory_source(ring);
+    auto buf = std::array<char, 3>();
+    slassert(0 == src.read(sl::io::make_span(buf)));
+    slassert(3 == ring.write({"foo", 3}));
+    slassert(3 == src.read(sl::io::make_span(buf)));
+    slassert("foo" == std::string(buf.data(), buf.size()));
+    slassert(2 == ring.write({"42", 2}));
+    ring.close();
+    slassert(2 == src.read(sl::io::make_span(buf)));
+    slassert("42" == std::string(buf.data(), 2));
+    slassert(std::char_traits<char>::eof() == src.read(sl::io::make_span(buf)));
+}
+
+void test_threads() {
+    auto area = std::array<char, 7>();
+    sl::io::memory_ring ring(sl::io::make_span(area));
+    auto expected = std::string();
+    for (size_t i = 0; i < 10000; i++) {
+        expected.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    auto writer = std::thread([&ring, &expected] {
+        auto sink = sl::io::make_ring_memory_sink(ring);
+        size_t idx = 0;
+        while (idx < expected.length()) {
+            size_t len = expected.length() - idx < 5 ? expected.length() - idx : 5;
+            idx += static_cast<size_t>(sink.write({expected.data() + idx, len}));
+        }
+        sink.close();
+    });
+    auto src = sl::io::make_ring_memory_source(ring);
+    auto res = std::string();
+    auto buf = std::array<char, 3>();
+    for (;;) {
+        auto read = src.read(sl::io::make_span(buf));
+        if (std::char_traits<char>::eof() == read) {
+            break;
+        }
+        res.append(buf.data(), static_cast<size_t>(read));
+    }
+    writer.join();
+    slassert(expected == res);
+}
+
+int main() {
+    try {
+        test_read();
+        test_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
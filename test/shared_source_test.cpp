@@ -26,9 +26,14 @@
 #include <array>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/string_source.hpp"
+
 #include "non_copyable_source.hpp"
 
 void test_copyable() {
@@ -48,9 +53,32 @@ void test_copyable() {
     slassert(5 == shared2.get_source().get_count());
 }
 
+void test_read_at_threads() {
+    auto data = std::string();
+    for (size_t i = 0; i < 4096; i++) {
+        data.push_back(static_cast<char>('a' + (i % 26)));
+    }
+    auto src = sl::io::make_shared_source(std::make_shared<sl::io::string_source>(std::string(data)));
+    auto parts = std::vector<std::string>(4);
+    auto threads = std::vector<std::thread>();
+    for (size_t i = 0; i < parts.size(); i++) {
+        threads.emplace_back([src, &parts, i] {
+            auto local = src;
+            auto buf = std::array<char, 1024>();
+            slassert(1024 == local.read_at(i * 1024, buf));
+            parts[i] = std::string(buf.data(), buf.size());
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(data == parts[0] + parts[1] + parts[2] + parts[3]);
+}
+
 int main() {
     try {
         test_copyable();
+        test_read_at_threads();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   sink_ostream_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 5:45 PM
+ */
+
+#include "staticlib/io/sink_ostream.hpp"
+
+#include <array>
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/memory_sink.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+
+void test_write() {
+    auto sink = two_bytes_at_once_sink();
+    {
+        auto ostream = sl::io::make_sink_ostream_ptr(sink, 4);
+        *ostream << "foo" << 42;
+        slassert(5 == ostream->tellp());
+        ostream->flush();
+        slassert("foo42" == sink.get_data());
+        *ostream << "bar";
+        slassert(8 == ostream->tellp());
+        // only current position can be requested
+        ostream->seekp(2);
+        slassert(ostream->fail());
+    }
+    slassert("foo42bar" == sink.get_data());
+}
+
+void test_lending() {
+    auto sink = sl::io::string_sink();
+    {
+        auto ostream = sl::io::make_sink_ostream_ptr(sink);
+        for (int i = 0; i < 1000; i++) {
+            *ostream << "foo" << '\n';
+        }
+        slassert(4000 == ostream->tellp());
+    }
+    slassert(4000 == sink.get_string().size());
+}
+
+void test_seek() {
+    std::array<char, 8> arr;
+    arr.fill('x');
+    auto sink = sl::io::memory_sink(arr);
+    auto ostream = sl::io::make_sink_ostream_ptr(std::move(sink));
+    *ostream << "foo42";
+    ostream->seekp(1);
+    *ostream << "OO";
+    ostream->seekp(-1, std::ios_base::end);
+    *ostream << "!";
+    ostream->flush();
+    slassert("fOO42xx!" == std::string(arr.data(), arr.size()));
+    slassert(8 == ostream->tellp());
+    ostream->seekp(9);
+    slassert(ostream->fail());
+}
+
+int main() {
+    try {
+        test_write();
+        test_lending();
+        test_seek();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
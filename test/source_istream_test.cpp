@@ -25,9 +25,13 @@
 
 #include <array>
 #include <iostream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/array_source.hpp"
+#include "staticlib/io/string_source.hpp"
+
 #include "two_bytes_at_once_source.hpp"
 
 void test_istream() {
@@ -36,17 +40,134 @@ void test_istream() {
     std::streambuf* sb = istream->rdbuf();
     std::array<char, 16> buf;
     auto read = sb->sgetn(buf.data(), buf.size());
-    slassert(2 == read);
+    slassert(3 == read);
     slassert('a' == buf[0]);
     slassert('b' == buf[1]);
+    slassert('c' == buf[2]);
     auto read2 = sb->sgetn(buf.data(), buf.size());
-    slassert(1 == read2);
-    slassert('c' == buf[0]);
+    slassert(0 == read2);
+}
+
+void test_formatted() {
+    two_bytes_at_once_source src{"42 foo\nbar baz\n"};
+    auto istream = sl::io::make_source_istream_ptr(std::move(src), 3);
+    int num = 0;
+    std::string word;
+    *istream >> num >> word;
+    slassert(42 == num);
+    slassert("foo" == word);
+    std::string line;
+    std::getline(*istream, line);
+    slassert(line.empty());
+    std::getline(*istream, line);
+    slassert("bar baz" == line);
+    slassert(!std::getline(*istream, line));
+    slassert(istream->eof());
+}
+
+void test_seek() {
+    auto istream = sl::io::make_source_istream_ptr(sl::io::string_source("foo42bar"), 4);
+    slassert(0 == istream->tellg());
+    std::string str;
+    str.resize(3);
+    istream->read(std::addressof(str.front()), 3);
+    slassert("foo" == str);
+    slassert(3 == istream->tellg());
+    // inside get area
+    istream->seekg(1);
+    slassert(1 == istream->tellg());
+    slassert('o' == istream->get());
+    // outside get area
+    istream->seekg(-3, std::ios_base::end);
+    slassert(5 == istream->tellg());
+    std::getline(*istream, str);
+    slassert("bar" == str);
+    istream->clear();
+    istream->seekg(-2, std::ios_base::cur);
+    slassert('a' == istream->get());
+    istream->seekg(42);
+    slassert(istream->fail());
+}
+
+void test_seek_borrow() {
+    std::string data = "foo42bar";
+    auto istream = sl::io::make_source_istream_ptr(sl::io::array_source(data), 2);
+    istream->seekg(6);
+    slassert('a' == istream->get());
+    istream->seekg(0);
+    slassert('f' == istream->get());
+    slassert(1 == istream->tellg());
+}
+
+// seekable source that does not lend its data
+class plain_source {
+    sl::io::string_source src;
+
+public:
+    explicit plain_source(std::string data) :
+    src(std::move(data)) { }
+
+    std::streamsize read(sl::io::span<char> span) {
+        return src.read(span);
+    }
+
+    size_t seek(std::streamsize offset, std::ios_base::seekdir whence = std::ios_base::beg) {
+        return src.seek(offset, whence);
+    }
+
+    size_t tell() {
+        return src.tell();
+    }
+
+    size_t size() {
+        return src.size();
+    }
+};
+
+void test_seek_after_direct_read() {
+    auto istream = sl::io::make_source_istream_ptr(plain_source("0123456789abcdef"), 4);
+    slassert('0' == istream->get());
+    slassert('1' == istream->get());
+    std::string str;
+    str.resize(8);
+    istream->read(std::addressof(str.front()), 2);
+    slassert("23" == str.substr(0, 2));
+    // read directly from source bypassing the get area
+    istream->read(std::addressof(str.front()), 8);
+    slassert("456789ab" == str);
+    slassert(12 == istream->tellg());
+    istream->seekg(9);
+    slassert('9' == istream->get());
+    slassert(istream->good());
+}
+
+void test_tell_forward_only() {
+    auto istream = sl::io::make_source_istream_ptr(two_bytes_at_once_source{"foo42bar"}, 4);
+    slassert('f' == istream->get());
+    slassert(1 == istream->tellg());
+    istream->seekg(2, std::ios_base::cur);
+    slassert(3 == istream->tellg());
+    slassert('4' == istream->get());
+    // forward seek past the get area
+    istream->seekg(6);
+    slassert('a' == istream->get());
+    slassert(7 == istream->tellg());
+    // backward seek past the get area
+    istream->seekg(0);
+    slassert(istream->fail());
+    istream->clear();
+    istream->seekg(0, std::ios_base::end);
+    slassert(istream->fail());
 }
 
 int main() {
     try {
         test_istream();
+        test_formatted();
+        test_seek();
+        test_seek_borrow();
+        test_seek_after_direct_read();
+        test_tell_forward_only();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
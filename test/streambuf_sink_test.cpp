@@ -25,9 +25,16 @@
 
 #include <iostream>
 #include <sstream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/buffered_sink.hpp"
+#include "staticlib/io/buffered_streambuf.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "two_bytes_at_once_sink.hpp"
+
 void test_write() {
     std::ostringstream stream{};
     sl::io::streambuf_sink sink{stream.rdbuf()};
@@ -36,9 +43,34 @@ void test_write() {
     slassert("foo" == stream.str());
 }
 
+void test_put_area() {
+    auto dest = sl::io::string_sink();
+    auto sb = sl::io::make_buffered_ostreambuf(sl::io::make_buffered_sink(dest), 4);
+    sl::io::streambuf_sink sink{std::addressof(sb)};
+    slassert(3 == sink.write({"foo", 3}));
+    slassert(dest.get_string().empty());
+    slassert(6 == sink.write({"42barr", 6}));
+    sink.flush();
+    slassert("foo42barr" == dest.get_string());
+}
+
+void test_put_area_own_buffer() {
+    auto dest = two_bytes_at_once_sink();
+    {
+        auto sb = sl::io::make_buffered_ostreambuf(dest, 4);
+        sl::io::streambuf_sink sink{std::addressof(sb)};
+        slassert(2 == sink.write({"fo", 2}));
+        slassert(dest.get_data().empty());
+        slassert(7 == sink.write({"o42barr", 7}));
+    }
+    slassert("foo42barr" == dest.get_data());
+}
+
 int main() {
     try {
         test_write();
+        test_put_area();
+        test_put_area_own_buffer();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
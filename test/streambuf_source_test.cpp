@@ -23,12 +23,42 @@
 
 #include "staticlib/io/streambuf_source.hpp"
 
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <string>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/buffered_streambuf.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+#include "two_bytes_at_once_source.hpp"
+
+// streambuf without get area and without putback support
+class no_putback_streambuf : public std::streambuf {
+    std::string data;
+    size_t pos = 0;
+
+public:
+    no_putback_streambuf(std::string data) :
+    data(std::move(data)) { }
+
+protected:
+    virtual int_type underflow() override {
+        return pos < data.size() ? traits_type::to_int_type(data[pos]) : traits_type::eof();
+    }
+
+    virtual int_type uflow() override {
+        return pos < data.size() ? traits_type::to_int_type(data[pos++]) : traits_type::eof();
+    }
+
+    virtual int_type pbackfail(int_type) override {
+        throw std::ios_base::failure("putback is not supported");
+    }
+};
+
 void test_read() {
     std::istringstream stream{"foo"};
     sl::io::streambuf_source src{stream.rdbuf()};
@@ -39,9 +69,44 @@ void test_read() {
     slassert("foo" == dest);
 }
 
+void test_eof() {
+    std::istringstream stream{"foo"};
+    sl::io::streambuf_source src{stream.rdbuf()};
+    std::string dest{};
+    dest.resize(8);
+    slassert(3 == src.read(dest));
+    slassert(std::char_traits<char>::eof() == src.read(dest));
+    slassert(0 == src.read({std::addressof(dest.front()), 0}));
+}
+
+void test_no_putback() {
+    no_putback_streambuf sb{"foo42"};
+    sl::io::streambuf_source src{std::addressof(sb)};
+    auto sink = sl::io::string_sink();
+    std::array<char, 2> buf;
+    sl::io::copy_all(src, sink, buf);
+    slassert("foo42" == sink.get_string());
+}
+
+void test_get_area() {
+    auto sb = sl::io::make_buffered_istreambuf(two_bytes_at_once_source{"foo42bar"}, 4);
+    slassert('f' == sb.sgetc());
+    sl::io::streambuf_source src{std::addressof(sb)};
+    std::string dest{};
+    dest.resize(3);
+    slassert(3 == src.read(dest));
+    slassert("foo" == dest);
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    slassert("42bar" == sink.get_string());
+}
+
 int main() {
     try {
         test_read();
+        test_eof();
+        test_no_putback();
+        test_get_area();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
@@ -25,9 +25,12 @@
 
 #include <array>
 #include <iostream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
+#include "staticlib/io/traits.hpp"
+
 #include "test_utils.hpp"
 
 void test_write() {
@@ -38,9 +41,33 @@ void test_write() {
     slassert(throws_exc([&sink] { sink.write({nullptr, -1}); }))
 }
 
+void test_prepare() {
+    sl::io::string_sink sink{};
+    sink.write({"foo", 3});
+    auto dest = sink.prepare(2);
+    slassert(dest.size() >= 2);
+    dest.data()[0] = '4';
+    dest.data()[1] = '2';
+    sink.commit(2);
+    dest = sink.prepare(100);
+    slassert(dest.size() >= 100);
+    dest.data()[0] = 'b';
+    sink.commit(1);
+    slassert("foo42b" == sink.get_string());
+    // uncommitted data is dropped
+    dest = sink.prepare(1);
+    dest.data()[0] = 'x';
+    sink.write({"a", 1});
+    slassert("foo42ba" == sink.get_string());
+    dest = sink.prepare(1);
+    slassert(throws_exc([&sink, &dest] { sink.commit(dest.size() + 1); }));
+    slassert(sl::io::has_prepare<sl::io::string_sink>::value);
+}
+
 int main() {
     try {
         test_write();
+        test_prepare();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
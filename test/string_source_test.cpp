@@ -25,6 +25,7 @@
 
 #include <array>
 #include <iostream>
+#include <string>
 
 #include "staticlib/config/assert.hpp"
 
@@ -42,9 +43,49 @@ void test_read() {
     slassert(throws_exc([&src] { src.read({nullptr, -1}); }))
 }
 
+void test_seek() {
+    sl::io::string_source src{std::string("foobar"), 1, 4};
+    std::array<char, 4> out;
+    slassert(3 == src.size());
+    slassert(0 == src.tell());
+    slassert(1 == src.seek(1));
+    auto res = src.read(out);
+    slassert(2 == res);
+    slassert('o' == out[0]);
+    slassert('b' == out[1]);
+    slassert(3 == src.tell());
+    slassert(0 == src.seek(-3, std::ios_base::cur));
+    slassert(3 == src.read(out));
+    slassert("oob" == std::string(out.data(), 3));
+    slassert(throws_exc([&src] { src.seek(4); }));
+}
+
+void test_read_at() {
+    sl::io::string_source src{std::string("foobar"), 1, 4};
+    std::array<char, 4> out;
+    slassert(2 == src.read_at(1, out));
+    slassert("ob" == std::string(out.data(), 2));
+    slassert(std::char_traits<char>::eof() == src.read_at(3, out));
+    slassert(0 == src.tell());
+}
+
+void test_next_chunk() {
+    sl::io::string_source src{"foobarbaz", 3, 6};
+    std::array<char, 1> out;
+    slassert(1 == src.read(out));
+    slassert('b' == out[0]);
+    auto chunk = src.next_chunk();
+    slassert("ar" == std::string(chunk.data(), chunk.size()));
+    slassert(0 == src.next_chunk().size());
+    slassert(std::char_traits<char>::eof() == src.read(out));
+}
+
 int main() {
     try {
         test_read();
+        test_seek();
+        test_read_at();
+        test_next_chunk();
     } catch (const std::exception& e) {
         std::cout << e.what() << std::endl;
         return 1;
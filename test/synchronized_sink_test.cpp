@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   synchronized_sink_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 4:50 PM
+ */
+
+#include "staticlib/io/synchronized_sink.hpp"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+
+void test_write() {
+    auto sink = sl::io::make_synchronized_sink(std::make_shared<sl::io::string_sink>());
+    auto copy = sink;
+    slassert(3 == copy.write({"foo", 3}));
+    slassert(0 == sink.flush());
+    slassert("foo" == sink.get_sink().get_string());
+    slassert(2 == sink.get_calls_count());
+    slassert(0 == sink.get_contended_count());
+}
+
+void test_threads() {
+    auto sink = sl::io::make_synchronized_sink(std::make_shared<sl::io::string_sink>());
+    auto threads = std::vector<std::thread>();
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([sink] {
+            auto local = sink;
+            for (size_t j = 0; j < 1000; j++) {
+                sl::io::write_all(local, {"foo", 3});
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(12000 == sink.get_sink().get_string().length());
+    slassert(4000 == sink.get_calls_count());
+}
+
+void test_thread_buffered() {
+    auto sink = sl::io::make_synchronized_sink(std::make_shared<sl::io::string_sink>());
+    auto threads = std::vector<std::thread>();
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([&sink] {
+            auto buffered = sl::io::make_thread_buffered_sink(sink);
+            for (size_t j = 0; j < 1000; j++) {
+                sl::io::write_all(buffered, {"foo\n", 4});
+            }
+            buffered.flush();
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto& str = sink.get_sink().get_string();
+    slassert(16000 == str.length());
+    for (size_t i = 0; i < str.length(); i += 4) {
+        slassert("foo\n" == str.substr(i, 4));
+    }
+    // buffer is written in 4096 bytes chunks and flushed once per thread
+    slassert(sink.get_calls_count() < 40);
+}
+
+int main() {
+    try {
+        test_write();
+        test_threads();
+        test_thread_buffered();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* 
+ * File:   synchronized_source_test.cpp
+ * Author: alex
+ * 
+ * Created on October 19, 2026, 5:05 PM
+ */
+
+#include "staticlib/io/synchronized_source.hpp"
+
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_source.hpp"
+
+void test_threads() {
+    auto src = sl::io::make_synchronized_source(std::make_shared<sl::io::string_source>(std::string(10000, 'a')));
+    std::atomic<size_t> total{0};
+    auto threads = std::vector<std::thread>();
+    for (size_t i = 0; i < 4; i++) {
+        threads.emplace_back([src, &total] {
+            auto local = src;
+            auto buf = std::array<char, 7>();
+            for (;;) {
+                auto read = local.read(sl::io::make_span(buf));
+                if (std::char_traits<char>::eof() == read) {
+                    break;
+                }
+                total += static_cast<size_t>(read);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    slassert(10000 == total);
+    slassert(src.get_calls_count() > 1000);
+}
+
+int main() {
+    try {
+        test_threads();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -25,8 +25,11 @@
 #define STATICLIB_IO_TEST_TEST_UTILS_HPP
 
 #include <functional>
+#include <string>
 
 #include "staticlib/io/io_exception.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
 
 bool throws_exc(std::function<void() > fun) {
     namespace si = staticlib::io;
@@ -39,5 +42,38 @@ bool throws_exc(std::function<void() > fun) {
     return false;
 }
 
+// compressible text of at least the specified length
+std::string make_data(size_t len) {
+    std::string res;
+    for (size_t i = 0; res.length() < len; i++) {
+        res += "line " + sl::support::to_string(i % 1000) + " of the text to compress\n";
+    }
+    return res;
+}
+
+template<typename Source>
+std::string read_string(Source& src) {
+    auto sink = sl::io::string_sink();
+    sl::io::copy_all(src, sink);
+    return std::move(sink.get_string());
+}
+
+// sink is created over the string sink and destroyed before returning the result
+template<typename SinkFactory>
+std::string write_string(const std::string& data, SinkFactory make_sink,
+        size_t chunk_len = std::string::npos) {
+    auto dest = sl::io::string_sink();
+    {
+        auto sink = make_sink(dest);
+        size_t pos = 0;
+        while (pos < data.length()) {
+            size_t len = data.length() - pos < chunk_len ? data.length() - pos : chunk_len;
+            sl::io::write_all(sink, {data.data() + pos, len});
+            pos += len;
+        }
+    }
+    return std::move(dest.get_string());
+}
+
 #endif /* STATICLIB_IO_TEST_TEST_UTILS_HPP */
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026, alex at staticlibs.net
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * File:   zstd_source_test.cpp
+ * Author: alex
+ *
+ * Created on October 19, 2026, 1:55 AM
+ */
+#include "staticlib/io/zstd_source.hpp"
+
+#include <iostream>
+#include <string>
+
+#include "staticlib/config/assert.hpp"
+
+#include "staticlib/io/hex_operations.hpp"
+#include "staticlib/io/operations.hpp"
+#include "staticlib/io/string_sink.hpp"
+#include "staticlib/io/string_source.hpp"
+
+#include "test_utils.hpp"
+#include "two_bytes_at_once_source.hpp"
+
+const std::string hello = "hello hello hello hello world";
+// compressed with zstd tool
+const std::string hello_zstd = "28b52ffd241d8d00005868656c6c6f20776f726c640100f14a11d75f93d4";
+const std::string hello_no_checksum = "28b52ffd201d8d00005868656c6c6f20776f726c640100f14a11";
+const std::string fox = "quick brown fox jumps over the lazy dog!";
+const std::string fox_dictionary = "the quick brown fox jumps over the lazy dog";
+const std::string fox_zstd = "28b52ffd24283d00000821010054a98011079a43";
+// compressed with "zstd -19", uses Huffman-coded literals and FSE-coded sequences
+const std::string lines_zstd =
+        "28b52ffd64ee17050600f20d2214a01b1b00199eefba03c0a0eceeee9d3c6ab45a018679af5dda6a964e2b5d"
+        "a35dd567d674608aae5b3dff54cdbed4f2a1fe7ba7be9ee9f36af7785ffd9d376fb7f8c2ddfb51d76eccad23"
+        "ee6bf1d6a5681b645001b9104f5b87262d43caaa5cc27a2a5d3993ac12a96cf3e8a66964cb2ca06906664114"
+        "21509cc0790627180a272094808221318e66a821187eff3b902db519124810f87f0481f1f7ff0c54d4642b50"
+        "cb83ca53c702c645098f166604480cdf51253c8f9d6b16805d0520c3f8c3";
+
+std::string decompress(const std::string& hex, const std::string& dictionary = "") {
+    auto src = sl::io::make_zstd_source(sl::io::string_source(sl::io::string_from_hex(hex)), dictionary);
+    return read_string(src);
+}
+
+std::string make_lines() {
+    std::string res;
+    for (size_t i = 0; i < 200; i++) {
+        res += "line " + sl::support::to_string(i * 37 % 101) + " of the text to compress\n";
+    }
+    return res;
+}
+
+void test_known() {
+    slassert(hello == decompress(hello_no_checksum));
+    auto src = sl::io::make_zstd_source(sl::io::string_source(sl::io::string_from_hex(hello_zstd)));
+    slassert(-1 == src.get_content_size());
+    slassert(hello == read_string(src));
+    slassert(29 == src.get_content_size());
+    slassert(make_lines() == decompress(lines_zstd));
+}
+
+void test_dictionary() {
+    slassert(fox == decompress(fox_zstd, fox_dictionary));
+}
+
+void test_chunks() {
+    auto src = sl::io::make_zstd_source(two_bytes_at_once_source(sl::io::string_from_hex(lines_zstd)));
+    std::string res;
+    char ch = '\0';
+    while (std::char_traits<char>::eof() != src.read({std::addressof(ch), 1})) {
+        res.push_back(ch);
+    }
+    slassert(make_lines() == res);
+}
+
+void test_multi_frame() {
+    // "foo" and "bar" frames with skippable frame between them
+    slassert("foobar" == decompress(
+            "28b52ffd0458190000666f6f3fbac459"
+            "502a4d1804000000deadbeef"
+            "28b52ffd045819000062617259a627ad"));
+}
+
+void test_reset() {
+    auto src = sl::io::make_zstd_source(sl::io::string_source(sl::io::string_from_hex(hello_zstd)));
+    slassert(hello == read_string(src));
+    src.reset(sl::io::string_source(sl::io::string_from_hex(hello_no_checksum)));
+    slassert(hello == read_string(src));
+}
+
+void test_invalid() {
+    slassert(throws_exc([] {
+        decompress(hello_zstd.substr(0, hello_zstd.length() - 2));
+    }));
+    slassert(throws_exc([] {
+        // content checksum
+        decompress(hello_zstd.substr(0, hello_zstd.length() - 2) + "d0");
+    }));
+    slassert(throws_exc([] {
+        decompress(lines_zstd.substr(0, 100) + "00" + lines_zstd.substr(102));
+    }));
+    slassert(throws_exc([] {
+        decompress(fox_zstd);
+    }));
+    slassert(throws_exc([] {
+        decompress("");
+    }));
+    slassert(throws_exc([] {
+        decompress("0102030405060708");
+    }));
+}
+
+int main() {
+    try {
+        test_known();
+        test_dictionary();
+        test_chunks();
+        test_multi_frame();
+        test_reset();
+        test_invalid();
+    } catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}